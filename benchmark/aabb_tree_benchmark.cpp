@@ -0,0 +1,351 @@
+///
+/// @file aabb_tree_benchmark.cpp
+/// @author Yasin BASAR
+/// @brief Measures the AabbTree updates and queries against linear scans of the same objects.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "aabb_tree.hpp"
+#include "frustum_culler.hpp"
+#include "frustum_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr size_t QUERY_COUNT = 1000; ///< Rays and boxes tested per query pass.
+constexpr float MOVED_SHARE = 0.1f; ///< Share of the objects moved per refit pass.
+
+///
+/// @brief Runs a function several times and returns the best time in seconds.
+///
+template <typename Run>
+static double best_time(int iterations, Run&& run)
+{
+    double best = 1e30;
+
+    for (int idx = 0; idx < iterations; idx++)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        run();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+///
+/// @brief Prints one result line.
+///
+static void print_result(const char* name, double seconds, double baseline_seconds)
+{
+    std::printf("  %-22s %10.3f ms %8.2fx\n", name, seconds * 1000.0, baseline_seconds / seconds);
+}
+
+///
+/// @brief Checks whether a box lies completely outside a frustum.
+///
+static bool is_box_outside(const YB::frustum_t& frustum, const YB::aabb_t& box)
+{
+    glm::vec3 center = (box.min + box.max) * 0.5f;
+    glm::vec3 extent = (box.max - box.min) * 0.5f;
+
+    for (const auto& plane: frustum.planes)
+    {
+        if (glm::dot(glm::vec3(plane), center) + plane.w + glm::dot(glm::abs(glm::vec3(plane)), extent) < 0.0f)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///
+/// @brief Checks whether two boxes overlap.
+///
+static bool overlaps(const YB::aabb_t& lhs, const YB::aabb_t& rhs)
+{
+    return glm::all(glm::lessThanEqual(lhs.min, rhs.max)) && glm::all(glm::lessThanEqual(rhs.min, lhs.max));
+}
+
+///
+/// @brief Intersects a ray segment with a box, returns the entry distance or a negative value on a miss.
+///
+static float intersect_ray(const YB::aabb_t& box, const glm::vec3& origin, const glm::vec3& inverse_direction, float max_distance)
+{
+    glm::vec3 near_distances = (box.min - origin) * inverse_direction;
+    glm::vec3 far_distances = (box.max - origin) * inverse_direction;
+
+    glm::vec3 entry = glm::min(near_distances, far_distances);
+    glm::vec3 exit = glm::max(near_distances, far_distances);
+
+    float enter = std::max(std::max(entry.x, entry.y), std::max(entry.z, 0.0f));
+    float leave = std::min(std::min(exit.x, exit.y), std::min(exit.z, max_distance));
+
+    return enter <= leave ? enter : -1.0f;
+}
+
+///
+/// @brief Runs every measurement for one object count.
+///
+static void run(size_t object_count, int iterations)
+{
+    // the world grows with the object count, so the density and the visible share stay the same
+    const float world_size = 4.0f * std::cbrt(static_cast<float>(object_count));
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(0.0f, world_size);
+    std::uniform_real_distribution<float> size(0.25f, 2.0f);
+    std::uniform_real_distribution<float> offset(-0.05f, 0.05f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<YB::aabb_t> boxes(object_count);
+
+    for (auto& box: boxes)
+    {
+        box.min = glm::vec3(position(random), position(random), position(random));
+        box.max = box.min + glm::vec3(size(random), size(random), size(random));
+    }
+
+    std::printf("%zu objects, best of %d\n", object_count, iterations);
+
+    // build
+    YB::AabbTree tree{};
+    std::vector<int32_t> proxies(object_count);
+
+    double build_seconds = best_time(iterations, [&]()
+    {
+        tree.clear();
+
+        for (size_t idx = 0; idx < object_count; idx++)
+        {
+            proxies[idx] = tree.insert(boxes[idx], static_cast<uint32_t>(idx));
+        }
+    });
+
+    std::printf("  build                  %10.3f ms  height %d\n", build_seconds * 1000.0, tree.get_height());
+
+    // refit, most small moves stay within the fat boxes
+    const auto moved_count = static_cast<size_t>(static_cast<float>(object_count) * MOVED_SHARE);
+    size_t reinserted = 0;
+
+    double refit_seconds = best_time(iterations, [&]()
+    {
+        reinserted = 0;
+
+        for (size_t idx = 0; idx < moved_count; idx++)
+        {
+            size_t object = (idx * 7919) % object_count;
+            glm::vec3 step(offset(random), offset(random), offset(random));
+
+            boxes[object].min += step;
+            boxes[object].max += step;
+
+            reinserted += tree.move(proxies[object], boxes[object]) ? 1 : 0;
+        }
+    });
+
+    std::printf("  move %zu objects     %10.3f ms  %zu reinserted\n", moved_count, refit_seconds * 1000.0, reinserted);
+
+    // frustum, a camera in the middle of the world looking along a diagonal
+    glm::vec3 eye(world_size * 0.5f);
+    glm::mat4 view_projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, world_size * 0.5f)
+                                * glm::lookAt(eye, eye + glm::vec3(1.0f, 0.2f, 0.6f), glm::vec3(0.0f, 1.0f, 0.0f));
+    YB::frustum_t frustum = YB::extract_frustum(view_projection);
+
+    YB::FrustumCuller culler{};
+    size_t linear_visible = 0;
+
+    // without a tree the spheres of every object are gathered and tested each frame
+    double linear_frustum_seconds = best_time(iterations, [&]()
+    {
+        culler.clear();
+
+        for (const auto& box: boxes)
+        {
+            culler.add({(box.min + box.max) * 0.5f, glm::length(box.max - box.min) * 0.5f});
+        }
+
+        linear_visible = object_count - culler.cull(frustum);
+    });
+
+    size_t tree_visible = 0;
+    size_t tree_inside = 0;
+
+    double tree_frustum_seconds = best_time(iterations, [&]()
+    {
+        tree_visible = 0;
+        tree_inside = 0;
+
+        tree.query_frustum(frustum, [&](uint32_t, bool inside)
+        {
+            tree_visible++;
+            tree_inside += inside ? 1 : 0;
+        });
+    });
+
+    size_t box_visible = 0;
+
+    for (const auto& box: boxes)
+    {
+        box_visible += is_box_outside(frustum, box) ? 0 : 1;
+    }
+
+    std::printf("  frustum: %zu boxes visible, tree reports %zu (%zu accepted whole), spheres %zu\n",
+                box_visible, tree_visible, tree_inside, linear_visible);
+    print_result("frustum linear SIMD", linear_frustum_seconds, linear_frustum_seconds);
+    print_result("frustum tree", tree_frustum_seconds, linear_frustum_seconds);
+
+    // rays, nearest hit along segments through the world
+    std::vector<glm::vec3> origins(QUERY_COUNT);
+    std::vector<glm::vec3> directions(QUERY_COUNT);
+
+    for (size_t idx = 0; idx < QUERY_COUNT; idx++)
+    {
+        origins[idx] = glm::vec3(position(random), position(random), position(random));
+        directions[idx] = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)));
+    }
+
+    const float ray_length = world_size * 0.25f;
+    std::vector<float> linear_hits(QUERY_COUNT);
+    std::vector<float> tree_hits(QUERY_COUNT);
+
+    double linear_ray_seconds = best_time(iterations, [&]()
+    {
+        for (size_t ray = 0; ray < QUERY_COUNT; ray++)
+        {
+            glm::vec3 inverse_direction = 1.0f / directions[ray];
+            float nearest = ray_length;
+
+            for (const auto& box: boxes)
+            {
+                float distance = intersect_ray(box, origins[ray], inverse_direction, nearest);
+
+                if (distance >= 0.0f)
+                {
+                    nearest = distance;
+                }
+            }
+
+            linear_hits[ray] = nearest;
+        }
+    });
+
+    double tree_ray_seconds = best_time(iterations, [&]()
+    {
+        for (size_t ray = 0; ray < QUERY_COUNT; ray++)
+        {
+            glm::vec3 inverse_direction = 1.0f / directions[ray];
+            float nearest = ray_length;
+
+            tree.query_ray(origins[ray], directions[ray], ray_length, [&](uint32_t object, float)
+            {
+                // the fat box is only a bound, the exact box decides the hit
+                float distance = intersect_ray(boxes[object], origins[ray], inverse_direction, nearest);
+
+                if (distance >= 0.0f)
+                {
+                    nearest = distance;
+                }
+
+                return nearest;
+            });
+
+            tree_hits[ray] = nearest;
+        }
+    });
+
+    size_t ray_mismatches = 0;
+
+    for (size_t ray = 0; ray < QUERY_COUNT; ray++)
+    {
+        ray_mismatches += std::abs(linear_hits[ray] - tree_hits[ray]) > 1e-4f ? 1 : 0;
+    }
+
+    std::printf("  %zu rays, %zu mismatches\n", QUERY_COUNT, ray_mismatches);
+    print_result("ray linear", linear_ray_seconds, linear_ray_seconds);
+    print_result("ray tree", tree_ray_seconds, linear_ray_seconds);
+
+    // boxes, overlaps of small query boxes
+    std::vector<YB::aabb_t> queries(QUERY_COUNT);
+
+    for (auto& query: queries)
+    {
+        query.min = glm::vec3(position(random), position(random), position(random));
+        query.max = query.min + glm::vec3(4.0f);
+    }
+
+    size_t linear_overlaps = 0;
+    size_t tree_overlaps = 0;
+
+    double linear_box_seconds = best_time(iterations, [&]()
+    {
+        linear_overlaps = 0;
+
+        for (const auto& query: queries)
+        {
+            for (const auto& box: boxes)
+            {
+                linear_overlaps += overlaps(box, query) ? 1 : 0;
+            }
+        }
+    });
+
+    double tree_box_seconds = best_time(iterations, [&]()
+    {
+        tree_overlaps = 0;
+
+        for (const auto& query: queries)
+        {
+            tree.query_box(query, [&](uint32_t object)
+            {
+                tree_overlaps += overlaps(boxes[object], query) ? 1 : 0;
+                return true;
+            });
+        }
+    });
+
+    std::printf("  %zu boxes, %zu overlaps linear, %zu tree\n", QUERY_COUNT, linear_overlaps, tree_overlaps);
+    print_result("box linear", linear_box_seconds, linear_box_seconds);
+    print_result("box tree", tree_box_seconds, linear_box_seconds);
+}
+
+int main(int argc, char** argv)
+{
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 3;
+
+    std::printf("frustum culling %s AVX2\n", YB::FrustumCuller::is_simd_enabled() ? "with" : "without");
+
+    for (size_t object_count: {10000u, 100000u, 1000000u})
+    {
+        run(object_count, iterations);
+    }
+
+    return 0;
+}
+
+/* End of File */
@@ -0,0 +1,129 @@
+///
+/// @file obj_parser_benchmark.cpp
+/// @author Yasin BASAR
+/// @brief Measures the parse throughput of ObjParser against tinyobj::LoadObj.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include "obj_parser.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <tiny_obj_loader.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+///
+/// @brief Runs a parse function several times and returns the best time in seconds.
+///
+template <typename Parse>
+static double best_time(int iterations, Parse&& parse)
+{
+    double best = 1e30;
+
+    for (int idx = 0; idx < iterations; idx++)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        if (!parse())
+        {
+            return -1.0;
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+///
+/// @brief Prints one result line.
+///
+static void print_result(const char* name, double seconds, double megabytes, double baseline_seconds)
+{
+    if (seconds < 0.0)
+    {
+        std::printf("%-22s failed\n", name);
+        return;
+    }
+
+    std::printf("%-22s %9.2f ms %9.1f MB/s %7.2fx\n",
+                name,
+                seconds * 1000.0,
+                megabytes / seconds,
+                baseline_seconds / seconds);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::printf("usage: %s <file.obj> [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    std::string file_path = argv[1];
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+
+    std::string base_path = std::filesystem::path(file_path).parent_path().string() + "/";
+    double megabytes = static_cast<double>(std::filesystem::file_size(file_path)) / (1024.0 * 1024.0);
+
+    std::printf("%s: %.1f MB, best of %d\n", file_path.c_str(), megabytes, iterations);
+
+    double tinyobj_seconds = best_time(iterations, [&]()
+    {
+        tinyobj::attrib_t attrib{};
+        std::vector<tinyobj::shape_t> shapes{};
+        std::vector<tinyobj::material_t> materials{};
+        std::string error{};
+
+        return tinyobj::LoadObj(&attrib, &shapes, &materials, &error,
+                                file_path.c_str(), base_path.c_str(), true);
+    });
+
+    print_result("tinyobj", tinyobj_seconds, megabytes, tinyobj_seconds);
+
+    // the calling thread takes part in the parse, so n workers means n + 1 threads
+    size_t max_workers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+    for (size_t worker_count = 1; worker_count <= max_workers; worker_count *= 2)
+    {
+        YB::ThreadPool thread_pool(worker_count);
+        YB::ObjParser obj_parser(thread_pool);
+
+        double seconds = best_time(iterations, [&]()
+        {
+            tinyobj::attrib_t attrib{};
+            std::vector<tinyobj::shape_t> shapes{};
+            std::vector<tinyobj::material_t> materials{};
+            std::string error{};
+
+            return obj_parser.parse(file_path, base_path, attrib, shapes, materials, error);
+        });
+
+        std::string name = "ObjParser " + std::to_string(worker_count + 1) + " threads";
+        print_result(name.c_str(), seconds, megabytes, tinyobj_seconds);
+    }
+
+    return 0;
+}
+
+/* End of File */
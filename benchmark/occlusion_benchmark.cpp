@@ -0,0 +1,249 @@
+///
+/// @file occlusion_benchmark.cpp
+/// @author Yasin BASAR
+/// @brief Checks the culling counts of OcclusionBuffer on reference scenes and measures its rasterization.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "occlusion_buffer.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr float WALL_DISTANCE = 10.0f; ///< Distance of the wall from the camera.
+constexpr float WALL_HALF_WIDTH = 6.0f; ///< Half width of the wall.
+constexpr float WALL_HALF_HEIGHT = 3.0f; ///< Half height of the wall.
+
+///
+/// @struct scene_s
+/// @brief A reference scene, a tessellated wall in front of the camera and boxes whose visibility is known.
+///
+typedef struct scene_s
+{
+    std::vector<glm::vec3> wall_vertices; ///< Corners of the wall cells.
+    std::vector<uint32_t> wall_indices; ///< Two triangles per wall cell.
+    std::vector<YB::aabb_t> boxes; ///< Boxes to test.
+    size_t hidden_count; ///< Boxes completely behind the wall, the expected culling count.
+} scene_t;
+
+///
+/// @brief Runs a function several times and returns the best time in seconds.
+///
+template <typename Run>
+static double best_time(int iterations, Run&& run)
+{
+    double best = 1e30;
+
+    for (int idx = 0; idx < iterations; idx++)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        run();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+
+    return best;
+}
+
+///
+/// @brief Builds a unit box around a center.
+///
+static YB::aabb_t unit_box(const glm::vec3& center)
+{
+    return {center - glm::vec3(0.5f), center + glm::vec3(0.5f)};
+}
+
+///
+/// @brief Builds the reference scene, the camera sits at the origin and looks down -z.
+/// @param cells Number of wall cells along each side.
+/// @param box_count Number of boxes of each kind.
+///
+static scene_t build_scene(uint32_t cells, size_t box_count)
+{
+    scene_t scene{};
+
+    for (uint32_t y = 0; y <= cells; y++)
+    {
+        for (uint32_t x = 0; x <= cells; x++)
+        {
+            scene.wall_vertices.emplace_back(-WALL_HALF_WIDTH + 2.0f * WALL_HALF_WIDTH * static_cast<float>(x) / static_cast<float>(cells),
+                                             -WALL_HALF_HEIGHT + 2.0f * WALL_HALF_HEIGHT * static_cast<float>(y) / static_cast<float>(cells),
+                                             -WALL_DISTANCE);
+        }
+    }
+
+    for (uint32_t y = 0; y < cells; y++)
+    {
+        for (uint32_t x = 0; x < cells; x++)
+        {
+            uint32_t corner = y * (cells + 1) + x;
+
+            scene.wall_indices.insert(scene.wall_indices.end(),
+                                      {corner, corner + 1, corner + cells + 2, corner, corner + cells + 2, corner + cells + 1});
+        }
+    }
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> far_depth(20.0f, 100.0f);
+    std::uniform_real_distribution<float> near_depth(3.0f, 8.0f);
+
+    // behind the wall, the nearest face of a box stays within 80% of the angle the wall covers
+    for (size_t idx = 0; idx < box_count; idx++)
+    {
+        float depth = far_depth(random);
+        float reach = depth - 0.5f;
+
+        glm::vec3 center(unit(random) * (0.8f * WALL_HALF_WIDTH / WALL_DISTANCE * reach - 0.5f),
+                         unit(random) * (0.8f * WALL_HALF_HEIGHT / WALL_DISTANCE * reach - 0.5f),
+                         -depth);
+
+        scene.boxes.push_back(unit_box(center));
+    }
+
+    scene.hidden_count = scene.boxes.size();
+
+    // in front of the wall
+    for (size_t idx = 0; idx < box_count; idx++)
+    {
+        float depth = near_depth(random);
+
+        scene.boxes.push_back(unit_box(glm::vec3(unit(random) * 0.3f * depth, unit(random) * 0.2f * depth, -depth)));
+    }
+
+    // behind the wall but beside it, in the view
+    for (size_t idx = 0; idx < box_count; idx++)
+    {
+        float depth = far_depth(random);
+        float side = unit(random) < 0.0f ? -1.0f : 1.0f;
+
+        scene.boxes.push_back(unit_box(glm::vec3(side * 0.85f * depth, unit(random) * 0.2f * depth, -depth)));
+    }
+
+    return scene;
+}
+
+///
+/// @brief Draws the wall of a scene into the buffer.
+///
+static void draw_occluders(YB::OcclusionBuffer& buffer,
+                           const scene_t& scene,
+                           const glm::mat4& view_projection,
+                           YB::ThreadPool* thread_pool)
+{
+    buffer.clear();
+    buffer.add_occluder(scene.wall_vertices, scene.wall_indices, view_projection);
+    buffer.rasterize(thread_pool);
+}
+
+///
+/// @brief Counts the boxes of a scene reported hidden by the buffer.
+///
+static size_t count_culled(const YB::OcclusionBuffer& buffer, const scene_t& scene, const glm::mat4& view_projection)
+{
+    size_t culled = 0;
+
+    for (const auto& box: scene.boxes)
+    {
+        culled += buffer.is_box_visible(box, view_projection) ? 0 : 1;
+    }
+
+    return culled;
+}
+
+int main(int argc, char** argv)
+{
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20;
+
+    glm::mat4 view_projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 1000.0f)
+                                * glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    std::printf("rasterization %s AVX2\n", YB::OcclusionBuffer::is_simd_enabled() ? "with" : "without");
+
+    // reference scene, the expected count is known by construction
+    scene_t scene = build_scene(4, 1000);
+    bool passed = true;
+
+    for (glm::uvec2 resolution: {glm::uvec2(128, 64), glm::uvec2(256, 128), glm::uvec2(512, 256)})
+    {
+        YB::OcclusionBuffer buffer(resolution.x, resolution.y);
+
+        draw_occluders(buffer, scene, view_projection, nullptr);
+
+        size_t culled = count_culled(buffer, scene, view_projection);
+
+        std::printf("%4ux%-4u reference: %zu boxes, %zu expected hidden, %zu culled %s\n",
+                    buffer.get_width(), buffer.get_height(), scene.boxes.size(), scene.hidden_count, culled,
+                    culled == scene.hidden_count ? "ok" : "MISMATCH");
+
+        passed = passed && culled == scene.hidden_count;
+    }
+
+    // heavier occluders, the wall split into many cells
+    scene_t heavy_scene = build_scene(64, 10000);
+    size_t max_workers = std::max(2u, std::thread::hardware_concurrency()) - 1;
+
+    for (glm::uvec2 resolution: {glm::uvec2(256, 128), glm::uvec2(512, 256)})
+    {
+        YB::OcclusionBuffer buffer(resolution.x, resolution.y);
+
+        double single_seconds = best_time(iterations, [&]()
+        {
+            draw_occluders(buffer, heavy_scene, view_projection, nullptr);
+        });
+
+        size_t culled = 0;
+
+        double test_seconds = best_time(iterations, [&]()
+        {
+            culled = count_culled(buffer, heavy_scene, view_projection);
+        });
+
+        std::printf("%4ux%-4u %zu occluder triangles\n", buffer.get_width(), buffer.get_height(), buffer.get_triangle_count());
+        std::printf("  %-18s %8.3f ms\n", "draw 1 thread", single_seconds * 1000.0);
+
+        for (size_t worker_count = 1; worker_count <= max_workers; worker_count *= 2)
+        {
+            YB::ThreadPool thread_pool(worker_count);
+
+            double seconds = best_time(iterations, [&]()
+            {
+                draw_occluders(buffer, heavy_scene, view_projection, &thread_pool);
+            });
+
+            std::string name = "draw " + std::to_string(worker_count + 1) + " threads";
+            std::printf("  %-18s %8.3f ms %6.2fx\n", name.c_str(), seconds * 1000.0, single_seconds / seconds);
+        }
+
+        std::printf("  %-18s %8.3f ms  %zu of %zu boxes culled\n",
+                    "test boxes", test_seconds * 1000.0, culled, heavy_scene.boxes.size());
+    }
+
+    return passed ? 0 : 1;
+}
+
+/* End of File */
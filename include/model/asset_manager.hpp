@@ -0,0 +1,183 @@
+///
+/// @file asset_manager.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the AssetManager class, the engine-wide registry of loaded models.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_ASSET_MANAGER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_ASSET_MANAGER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "model_3d.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @brief Reference-counted, read-only handle to a loaded model, the model is unloaded with the last handle.
+    ///
+    typedef std::shared_ptr<const Model3D> model_handle_t;
+
+    ///
+    /// @brief Pending import of a model file, null once finished if the file could not be read.
+    ///
+    typedef std::shared_future<std::shared_ptr<model_data_t>> model_import_t;
+
+    ///
+    /// @class AssetManager
+    /// @brief Shares loaded models between all of their placements, keyed by canonical path.
+    ///
+    /// Every model file is imported and uploaded once, however many placements
+    /// or concurrent loads ask for it. Imports may run on any thread: a second
+    /// import of a file that is already being imported gets the pending import
+    /// of the first one instead of reading the file again. The upload happens
+    /// in acquire() on the render thread, which hands out the handles.
+    ///
+    /// Like the texture cache, the manager only holds weak references. A model
+    /// is unloaded when its last handle is dropped, and the handles stay valid
+    /// even if they outlive the manager.
+    ///
+    class AssetManager
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~AssetManager() noexcept = default; /**< Default destructor */
+        AssetManager(AssetManager &&) noexcept = delete; /**< Deleted move constructor */
+        AssetManager &operator=(AssetManager &&) noexcept = delete; /**< Deleted move assignment operator */
+        AssetManager(const AssetManager &) noexcept = delete; /**< Deleted copy constructor */
+        AssetManager &operator=(AssetManager const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs an empty manager. Does not touch OpenGL.
+        ///
+        AssetManager();
+
+        ///
+        /// @brief Imports a model file and decodes its textures, or joins the import already running. Thread-safe.
+        ///
+        /// Only the thread that runs the import reports its progress. A thread
+        /// that joins an import gets it back right away and must not block on
+        /// it from a pool task: the thread running the import helps out with
+        /// queued tasks while it waits for its decodes, and may pick up that
+        /// very task. Poll the import with wait_for() instead. An import that
+        /// fails, even by throwing, finishes with a null model.
+        ///
+        /// @param [in] file_path Path to the model file.
+        /// @param [in] on_progress Receives the bounds of the model and the progress in [0, 1], may be empty.
+        /// @return The import, invalid if the model is already loaded.
+        ///
+        model_import_t import(const std::string& file_path,
+                              const std::function<void(const aabb_t&, float)>& on_progress);
+
+        ///
+        /// @brief Gets a handle to a model, loading it if it is not loaded yet.
+        ///
+        /// Finishes the import of the file if one is running and uploads the
+        /// model. Must run on the thread that owns the OpenGL context.
+        ///
+        /// @param [in] file_path Path to the model file.
+        /// @return The model, null if the file could not be read.
+        ///
+        model_handle_t acquire(const std::string& file_path);
+
+        ///
+        /// @brief Sets the callback invoked with the memory of every asset that is loaded or unloaded.
+        /// @param [in] on_memory The callback, empty to remove it.
+        ///
+        void set_memory_callback(const asset_memory_callback_t& on_memory);
+
+        ///
+        /// @brief Gets the loaded assets with their reference counts and memory.
+        /// @return One record per loaded model.
+        ///
+        std::vector<asset_record_t> get_records() const;
+
+        ///
+        /// @brief Gets the counters of the manager.
+        /// @return The hit, miss and memory counters.
+        ///
+        asset_manager_stats_t get_stats() const;
+
+        ///
+        /// @brief Turns a model path into the key of the registry.
+        /// @param [in] path The path of the model file.
+        /// @return The canonical path.
+        ///
+        static std::string canonicalize(const std::string& path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct asset_entry_s
+        /// @brief Defines the state of one model file.
+        ///
+        typedef struct asset_entry_s
+        {
+            std::weak_ptr<const Model3D> model; ///< The loaded model, expired if not loaded.
+            model_import_t import; ///< Import waiting for the upload, invalid if none.
+            asset_memory_t memory; ///< Memory of the loaded model.
+        } asset_entry_t;
+
+        ///
+        /// @struct registry_s
+        /// @brief Defines the lookup table, shared with the deleters of the handles.
+        ///
+        typedef struct registry_s
+        {
+            std::mutex mutex; ///< Guards the table, the counters and the callback.
+            std::unordered_map<std::string, asset_entry_t> assets; ///< Models by canonical path.
+            asset_manager_stats_t stats; ///< Hit, miss and memory counters.
+            asset_memory_callback_t on_memory; ///< Memory callback, may be empty.
+        } registry_t;
+
+        ///
+        /// @brief Uploads an imported model and registers its handle.
+        /// @param [in] canonical_path The canonical path of the model file.
+        /// @param [in,out] model_data The imported model, consumed.
+        /// @return The handle of the model.
+        ///
+        model_handle_t register_model(const std::string& canonical_path, model_data_t& model_data);
+
+        std::shared_ptr<registry_t> m_registry; /**< Lookup table of the manager. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_ASSET_MANAGER_HPP
+
+/* End of File */
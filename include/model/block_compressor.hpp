@@ -0,0 +1,117 @@
+///
+/// @file block_compressor.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the BlockCompressor class, which builds sRGB mip chains and BC1/BC3 blocks.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_BLOCK_COMPRESSOR_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_BLOCK_COMPRESSOR_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "compressed_texture.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @struct rgba_image_s
+    /// @brief Defines an uncompressed RGBA8 image.
+    ///
+    typedef struct rgba_image_s
+    {
+        int width; ///< Width of the image in pixels.
+        int height; ///< Height of the image in pixels.
+        std::vector<unsigned char> pixels; ///< RGBA8 rows.
+    } rgba_image_t;
+
+    ///
+    /// @class BlockCompressor
+    /// @brief Offline encoder used by the texture cook tool.
+    ///
+    /// Mip levels are filtered in linear space and stored in sRGB, so they keep
+    /// the brightness of the base level. Color blocks pick their endpoints along
+    /// the principal axis of the block colors.
+    ///
+    class BlockCompressor
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        BlockCompressor() noexcept = delete; /**< Deleted default constructor */
+        ~BlockCompressor() noexcept = delete; /**< Deleted destructor */
+        BlockCompressor(BlockCompressor &&) noexcept = delete; /**< Deleted move constructor */
+        BlockCompressor &operator=(BlockCompressor &&) noexcept = delete; /**< Deleted move assignment operator */
+        BlockCompressor(const BlockCompressor &) noexcept = delete; /**< Deleted copy constructor */
+        BlockCompressor &operator=(BlockCompressor const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Builds the full mip chain of an sRGB image, down to 1x1.
+        /// @param [in] base_level The sRGB image of level 0.
+        /// @return All levels, starting with a copy of the base level.
+        ///
+        static std::vector<rgba_image_t> build_mip_chain(const rgba_image_t& base_level);
+
+        ///
+        /// @brief Picks BC3 for images with transparent pixels and BC1 for the others.
+        /// @param [in] image The image to inspect.
+        /// @return The sRGB compressed internal format.
+        ///
+        static GLenum choose_format(const rgba_image_t& image);
+
+        ///
+        /// @brief Compresses an image into 4x4 blocks.
+        /// @param [in] image The image to compress.
+        /// @param [in] internal_format COMPRESSED_SRGB_BC1 or COMPRESSED_SRGB_ALPHA_BC3.
+        /// @return The blocks, row by row.
+        ///
+        static std::vector<unsigned char> compress(const rgba_image_t& image, GLenum internal_format);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Encodes the colors of 16 pixels as a 4 color BC1 block.
+        /// @param [in] block The RGBA8 pixels of the block.
+        /// @param [out] output The 8 bytes of the block.
+        ///
+        static void compress_color_block(const unsigned char* block, unsigned char* output);
+
+        ///
+        /// @brief Encodes the alpha of 16 pixels as an 8 value BC3 alpha block.
+        /// @param [in] block The RGBA8 pixels of the block.
+        /// @param [out] output The 8 bytes of the block.
+        ///
+        static void compress_alpha_block(const unsigned char* block, unsigned char* output);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_BLOCK_COMPRESSOR_HPP
+
+/* End of File */
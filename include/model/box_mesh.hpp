@@ -0,0 +1,98 @@
+///
+/// @file box_mesh.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the BoxMesh class, a unit cube used to draw bounding boxes.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_BOX_MESH_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_BOX_MESH_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class BoxMesh
+    /// @brief Holds the OpenGL buffers of the unit cube [0, 1]^3.
+    ///
+    /// The cube uses the vertex_t layout, so it can be drawn with the shaders of
+    /// the models. get_box_matrix() maps the unit cube onto a bounding box.
+    ///
+    class BoxMesh
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        BoxMesh(BoxMesh &&) noexcept = delete; /**< Deleted move constructor */
+        BoxMesh &operator=(BoxMesh &&) noexcept = delete; /**< Deleted move assignment operator */
+        BoxMesh(const BoxMesh &) noexcept = delete; /**< Deleted copy constructor */
+        BoxMesh &operator=(BoxMesh const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Creates the buffers of the unit cube.
+        ///
+        BoxMesh();
+
+        ///
+        /// @brief Deletes the buffers of the unit cube.
+        ///
+        ~BoxMesh();
+
+        ///
+        /// @brief Draws the 12 edges of the cube as lines.
+        ///
+        void draw_wireframe() const;
+
+        ///
+        /// @brief Draws the 6 faces of the cube as triangles, facing outwards.
+        ///
+        void draw_solid() const;
+
+        ///
+        /// @brief Computes the matrix that maps the unit cube onto a box.
+        /// @param [in] bounds The box to cover.
+        /// @return The matrix to multiply the model matrix with.
+        ///
+        static glm::mat4 get_box_matrix(const aabb_t& bounds);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        buffers_t m_buffers; /**< Buffers of the cube. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_BOX_MESH_HPP
+
+/* End of File */
@@ -0,0 +1,148 @@
+///
+/// @file compressed_texture.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the CompressedTexture class, which reads, writes and uploads cooked textures.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_COMPRESSED_TEXTURE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_COMPRESSED_TEXTURE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mapped_file.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    constexpr GLenum COMPRESSED_SRGB_BC1 = 0x8C4C; ///< GL_COMPRESSED_SRGB_S3TC_DXT1_EXT
+    constexpr GLenum COMPRESSED_SRGB_ALPHA_BC3 = 0x8C4F; ///< GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+
+    ///
+    /// @struct compressed_level_s
+    /// @brief Defines one mip level of a cooked texture.
+    ///
+    typedef struct compressed_level_s
+    {
+        int width; ///< Width of the level in pixels.
+        int height; ///< Height of the level in pixels.
+        const unsigned char* data; ///< Compressed blocks of the level.
+        size_t size; ///< Size of the blocks in bytes.
+    } compressed_level_t;
+
+    ///
+    /// @struct compressed_image_s
+    /// @brief Defines a cooked texture with its full mip chain.
+    ///
+    typedef struct compressed_image_s
+    {
+        GLenum internal_format; ///< COMPRESSED_SRGB_BC1 or COMPRESSED_SRGB_ALPHA_BC3.
+        uint64_t source_hash; ///< Hash of the bytes of the source image file.
+        std::vector<compressed_level_t> levels; ///< Mip levels, largest first.
+        std::shared_ptr<MappedFile> file; ///< Mapping the levels of a loaded texture point into.
+    } compressed_image_t;
+
+    ///
+    /// @class CompressedTexture
+    /// @brief Handles the `.ybtex` files written by the TextureCook tool.
+    ///
+    /// A cooked texture lives next to its source image with a `.ybtex` extension
+    /// and holds BC1 (opaque) or BC3 (transparent) blocks for every mip level, in
+    /// the bottom-up row order OpenGL expects. It is used instead of the source
+    /// when the source has not changed since cooking, or is not shipped at all.
+    ///
+    class CompressedTexture
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        CompressedTexture() noexcept = delete; /**< Deleted default constructor */
+        ~CompressedTexture() noexcept = delete; /**< Deleted destructor */
+        CompressedTexture(CompressedTexture &&) noexcept = delete; /**< Deleted move constructor */
+        CompressedTexture &operator=(CompressedTexture &&) noexcept = delete; /**< Deleted move assignment operator */
+        CompressedTexture(const CompressedTexture &) noexcept = delete; /**< Deleted copy constructor */
+        CompressedTexture &operator=(CompressedTexture const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Gets the path of the cooked texture of a source image.
+        /// @param [in] source_path Path of the source image.
+        /// @return The path of the `.ybtex` file.
+        ///
+        static std::string get_cooked_path(const std::string& source_path);
+
+        ///
+        /// @brief Memory-maps the cooked texture of a source image and validates it.
+        /// @param [in] source_path Path of the source image.
+        /// @param [out] image The cooked texture, pointing into the mapped file.
+        /// @return True if an up to date cooked texture exists.
+        ///
+        static bool load(const std::string& source_path, compressed_image_t& image);
+
+        ///
+        /// @brief Writes the cooked texture of a source image.
+        /// @param [in] source_path Path of the source image.
+        /// @param [in] image The cooked texture.
+        /// @return True if the file was written.
+        ///
+        static bool save(const std::string& source_path, const compressed_image_t& image);
+
+        ///
+        /// @brief Checks whether the driver accepts the sRGB S3TC formats. Render thread only.
+        /// @return True if cooked textures can be uploaded.
+        ///
+        static bool is_supported();
+
+        ///
+        /// @brief Uploads every mip level of a cooked texture. Render thread only.
+        /// @param [in] image The cooked texture.
+        /// @return The ID of the generated texture.
+        ///
+        static GLuint upload(const compressed_image_t& image);
+
+        ///
+        /// @brief Sums the sizes of all levels of a cooked texture.
+        /// @param [in] image The cooked texture.
+        /// @return The GPU memory of the texture in bytes.
+        ///
+        static size_t get_byte_size(const compressed_image_t& image) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Data
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_COMPRESSED_TEXTURE_HPP
+
+/* End of File */
@@ -0,0 +1,276 @@
+///
+/// @file geometry_arena.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the GeometryArena class, which suballocates mesh geometry from shared buffers.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_GEOMETRY_ARENA_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_GEOMETRY_ARENA_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class GeometryArena
+    /// @brief Stores the vertices and indices of all meshes in a few large buffers.
+    ///
+    /// There is one pool per vertex format, made of a vertex buffer, an index
+    /// buffer and the vertex array object that binds them. Meshes get ranges of
+    /// the pools through a first-fit free list. Freed ranges are merged with
+    /// their neighbours, and a full pool doubles its buffers.
+    ///
+    /// Indices stay relative to the first vertex of their mesh and are drawn
+    /// with the BaseVertex draw calls, so 16-bit indices keep working however
+    /// large the pool grows. All meshes of a format share the vertex array
+    /// object, so consecutive draws do not switch it.
+    ///
+    /// Meshes refer to their ranges through a handle, so compact() can move the
+    /// ranges together without the meshes noticing.
+    ///
+    class GeometryArena
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~GeometryArena() noexcept = default; /**< Default destructor */
+        GeometryArena(GeometryArena &&) noexcept = delete; /**< Deleted move constructor */
+        GeometryArena &operator=(GeometryArena &&) noexcept = delete; /**< Deleted move assignment operator */
+        GeometryArena(const GeometryArena &) noexcept = delete; /**< Deleted copy constructor */
+        GeometryArena &operator=(GeometryArena const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs an empty arena. Does not touch OpenGL, the pools are created on first use.
+        ///
+        GeometryArena();
+
+        ///
+        /// @brief Copies the geometry of a mesh into the pool of its vertex format.
+        /// @param [in] vertex_format The layout of the vertex data.
+        /// @param [in] vertex_data The vertices, laid out as vertex_t or compact_vertex_t.
+        /// @param [in] vertex_count Number of vertices.
+        /// @param [in] index_data The indices, relative to the first vertex.
+        /// @param [in] index_byte_size Size of the index data in bytes.
+        /// @return The handle of the ranges.
+        ///
+        uint32_t allocate(VERTEX_FORMAT vertex_format,
+                          const void* vertex_data,
+                          size_t vertex_count,
+                          const void* index_data,
+                          size_t index_byte_size);
+
+        ///
+        /// @brief Returns the ranges of a handle to the free lists.
+        /// @param [in] handle A handle returned by allocate().
+        ///
+        void release(uint32_t handle);
+
+        ///
+        /// @brief Draws index ranges of a mesh.
+        /// @param [in] handle The handle of the mesh.
+        /// @param [in] index_type GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+        /// @param [in] counts Index counts of the ranges.
+        /// @param [in] offsets Byte offsets of the ranges within the index data of the mesh.
+        /// @param [in] draw_count Number of ranges, drawn with one multi-draw call if above one.
+        /// @param [in] instance_count Number of instances, above one every range is drawn instanced.
+        ///
+        void draw(uint32_t handle,
+                  GLenum index_type,
+                  const GLsizei* counts,
+                  const size_t* offsets,
+                  size_t draw_count,
+                  GLsizei instance_count = 1);
+
+        ///
+        /// @brief Moves the ranges of every pool to the front of its buffers, closing the gaps.
+        ///
+        /// Copies the buffers on the GPU, so it is best called between frames
+        /// after many meshes were released. Offsets read through
+        /// get_base_vertex() and get_index_offset() are stale afterwards.
+        ///
+        void compact();
+
+        ///
+        /// @brief Feeds a per-instance draw id attribute from a buffer to every vertex array object.
+        ///
+        /// Attribute 3 reads one GLuint per instance, so an indirect draw whose
+        /// base instance is its command index tells the vertex shader which
+        /// command it belongs to.
+        ///
+        /// @param [in] buffer The buffer of draw ids, 0 to disable the attribute.
+        ///
+        void set_draw_id_buffer(GLuint buffer);
+
+        ///
+        /// @brief Gets the first vertex of the ranges of a handle.
+        /// @param [in] handle A handle returned by allocate().
+        /// @return The base vertex to draw the indices of the handle with.
+        ///
+        GLint get_base_vertex(uint32_t handle) const noexcept;
+
+        ///
+        /// @brief Gets the byte offset of the indices of a handle in the index buffer of its pool.
+        /// @param [in] handle A handle returned by allocate().
+        /// @return The byte offset, a multiple of 4.
+        ///
+        size_t get_index_offset(uint32_t handle) const noexcept;
+
+        ///
+        /// @brief Gets the bytes of the pool buffers held by the ranges of a handle.
+        /// @param [in] handle A handle returned by allocate().
+        /// @return The size of the vertex range plus the padded size of the index range.
+        ///
+        size_t get_byte_size(uint32_t handle) const noexcept;
+
+        ///
+        /// @brief Forgets which vertex array object is bound, so the next draw() binds it again.
+        ///
+        /// Must be called after code outside of the arena changed the binding.
+        ///
+        void reset_bindings() noexcept;
+
+        ///
+        /// @brief Gets the buffers of the pool of a vertex format.
+        /// @param [in] vertex_format The vertex format.
+        /// @return The shared vertex array object, vertex buffer and index buffer, 0 before first use.
+        ///
+        buffers_t get_buffers(VERTEX_FORMAT vertex_format) const noexcept;
+
+        ///
+        /// @brief Gets the memory counters of all pools.
+        /// @return The buffer, used and free range counters.
+        ///
+        geometry_arena_stats_t get_stats() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct free_range_s
+        /// @brief A free range of a buffer.
+        ///
+        typedef struct free_range_s
+        {
+            size_t offset; ///< First unit of the range.
+            size_t size; ///< Number of units of the range.
+        } free_range_t;
+
+        ///
+        /// @struct pool_s
+        /// @brief The buffers of one vertex format and their free lists.
+        ///
+        typedef struct pool_s
+        {
+            buffers_t buffers; ///< Shared vertex array object, vertex buffer and index buffer.
+            size_t vertex_size; ///< Size of one vertex in bytes.
+            size_t vertex_capacity; ///< Vertices the vertex buffer holds.
+            size_t index_capacity; ///< Bytes the index buffer holds.
+            std::vector<free_range_t> free_vertices; ///< Free vertex ranges, sorted by offset.
+            std::vector<free_range_t> free_indices; ///< Free index byte ranges, sorted by offset.
+        } pool_t;
+
+        ///
+        /// @struct allocation_s
+        /// @brief The ranges of one mesh.
+        ///
+        typedef struct allocation_s
+        {
+            VERTEX_FORMAT vertex_format; ///< Pool of the ranges.
+            size_t vertex_offset; ///< First vertex, the base vertex of the draws.
+            size_t vertex_count; ///< Number of vertices.
+            size_t index_offset; ///< Byte offset of the indices.
+            size_t index_size; ///< Byte size of the indices, padded to 4 bytes.
+            bool live; ///< False once released.
+        } allocation_t;
+
+        ///
+        /// @brief Takes a range out of a free list, first fit.
+        /// @param [in,out] free_ranges The free list.
+        /// @param [in] size Number of units to take.
+        /// @param [out] offset First unit of the taken range.
+        /// @return True if a range was large enough.
+        ///
+        static bool take_range(std::vector<free_range_t>& free_ranges, size_t size, size_t& offset);
+
+        ///
+        /// @brief Returns a range to a free list, merging it with its neighbours.
+        /// @param [in,out] free_ranges The free list.
+        /// @param [in] offset First unit of the range.
+        /// @param [in] size Number of units of the range.
+        ///
+        static void give_range(std::vector<free_range_t>& free_ranges, size_t offset, size_t size);
+
+        ///
+        /// @brief Creates a buffer and copies the first bytes of another buffer into it.
+        /// @param [in] source The buffer to copy from, 0 for none.
+        /// @param [in] copy_size Bytes to copy.
+        /// @param [in] capacity Size of the new buffer in bytes.
+        /// @return The new buffer.
+        ///
+        static GLuint create_buffer(GLuint source, size_t copy_size, size_t capacity);
+
+        ///
+        /// @brief Points the vertex array object of a pool at its current buffers.
+        /// @param [in] vertex_format The vertex format of the pool.
+        ///
+        void setup_vertex_array(VERTEX_FORMAT vertex_format);
+
+        ///
+        /// @brief Grows the vertex buffer of a pool to hold at least the given number of vertices.
+        /// @param [in] vertex_format The vertex format of the pool.
+        /// @param [in] vertex_capacity Vertices the buffer has to hold.
+        ///
+        void grow_vertices(VERTEX_FORMAT vertex_format, size_t vertex_capacity);
+
+        ///
+        /// @brief Grows the index buffer of a pool to hold at least the given number of bytes.
+        /// @param [in] vertex_format The vertex format of the pool.
+        /// @param [in] index_capacity Bytes the buffer has to hold.
+        ///
+        void grow_indices(VERTEX_FORMAT vertex_format, size_t index_capacity);
+
+        pool_t m_pools[2]; /**< One pool per VERTEX_FORMAT. */
+        std::vector<allocation_t> m_allocations; /**< Ranges of every handle. */
+        std::vector<uint32_t> m_free_handles; /**< Released handles, reused by allocate(). */
+        std::vector<const GLvoid*> m_draw_offsets; /**< Absolute offsets of the last multi-draw. */
+        std::vector<GLint> m_draw_base_vertices; /**< Base vertices of the last multi-draw. */
+        GLuint m_bound_vertex_array; /**< Vertex array object bound by the last draw(). */
+        GLuint m_draw_id_buffer; /**< Source of the per-instance draw id attribute, 0 for none. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_GEOMETRY_ARENA_HPP
+
+/* End of File */
@@ -0,0 +1,157 @@
+///
+/// @file instanced_model.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the InstancedModel class, which draws many placements of one model.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_INSTANCED_MODEL_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_INSTANCED_MODEL_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include "asset_manager.hpp"
+#include "frustum_culler.hpp"
+#include "instanced_shader.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class InstancedModel
+    /// @brief Draws all placements of a model with instanced draw calls.
+    ///
+    /// Every instance only stores its transform. Each frame the instances
+    /// outside the view frustum are dropped on the CPU, and the model and normal
+    /// matrices of the rest are written to a texture buffer that the
+    /// InstancedShader reads by gl_InstanceID. Every mesh is then drawn once
+    /// for all visible instances, at the level of detail of the closest one.
+    ///
+    class InstancedModel
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        InstancedModel() noexcept = delete; /**< Deleted default constructor */
+        InstancedModel(InstancedModel &&) noexcept = delete; /**< Deleted move constructor */
+        InstancedModel &operator=(InstancedModel &&) noexcept = delete; /**< Deleted move assignment operator */
+        InstancedModel(const InstancedModel &) noexcept = delete; /**< Deleted copy constructor */
+        InstancedModel &operator=(InstancedModel const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Acquires the model from the asset manager and creates the instance buffer.
+        /// @param [in] file_path Path to the model file.
+        ///
+        explicit InstancedModel(const std::string& file_path);
+
+        ///
+        /// @brief Deletes the instance buffer.
+        ///
+        ~InstancedModel();
+
+        ///
+        /// @brief Places one more instance of the model.
+        /// @param [in] transform The model matrix of the instance.
+        /// @return The index of the instance.
+        ///
+        size_t add_instance(const glm::mat4& transform);
+
+        ///
+        /// @brief Moves an instance.
+        /// @param [in] instance The index returned by add_instance().
+        /// @param [in] transform The new model matrix of the instance.
+        ///
+        void set_instance(size_t instance, const glm::mat4& transform);
+
+        ///
+        /// @brief Gets the number of placed instances.
+        /// @return The instance count.
+        ///
+        size_t get_instance_count() const noexcept;
+
+        ///
+        /// @brief Gets the file the model was loaded from.
+        /// @return The canonical path of the file.
+        ///
+        const std::string& get_file_path() const noexcept;
+
+        ///
+        /// @brief Culls the instances and draws the visible ones.
+        ///
+        /// The shader program must be in use, with the per-frame block filled.
+        ///
+        /// @param [in,out] shader The instanced shader in use, its uniforms are set through its table.
+        /// @param [in] view_projection The view projection matrix of the camera.
+        /// @param [in] camera_position The camera position in world space.
+        /// @param [in] pixels_per_unit_at_one Size in pixels of one world unit at distance 1.
+        /// @param [in] settings The error threshold and hysteresis of the level of detail selection.
+        ///
+        void render(InstancedShader& shader,
+                    const glm::mat4& view_projection,
+                    const glm::vec3& camera_position,
+                    float pixels_per_unit_at_one,
+                    const lod_settings_t& settings);
+
+        ///
+        /// @brief Gets the number of triangles drawn by the last render() call.
+        /// @return The triangle count of the selected levels times the visible instances.
+        ///
+        size_t get_triangle_count() const noexcept;
+
+        ///
+        /// @brief Gets the number of instances culled by the last render() call.
+        /// @return The instances outside the view frustum.
+        ///
+        size_t get_culled_count() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        model_handle_t m_model; /**< The meshes and textures shared by all instances, null if the load failed. */
+        std::vector<mesh_draw_t> m_draws; /**< Level of detail and ranges of every mesh, drawn for all instances. */
+        std::string m_file_path; /**< Canonical path of the file the model was loaded from. */
+        std::vector<glm::mat4> m_transforms; /**< Model matrix of every instance. */
+        std::vector<float> m_scales; /**< Largest axis scale of every instance, for the bounding sphere. */
+        std::vector<glm::mat4> m_visible_matrices; /**< Model and normal matrix of every visible instance. */
+        std::vector<bounding_sphere_t> m_spheres; /**< World space bounding sphere of every instance. */
+        FrustumCuller m_culler; /**< Culls the instances in batches. */
+        GLuint m_instance_buffer; /**< Buffer behind the texture buffer. */
+        GLuint m_instance_texture; /**< Texture buffer read by the vertex shader. */
+        size_t m_triangle_count; /**< Triangles drawn by the last render() call. */
+        size_t m_culled_count; /**< Instances culled by the last render() call. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_INSTANCED_MODEL_HPP
+
+/* End of File */
@@ -0,0 +1,159 @@
+///
+/// @file material.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the Material class, which binds the textures of a mesh with pre-resolved samplers.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MATERIAL_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MATERIAL_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "types_enums.hpp"
+#include "uniform_table.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class Material
+    /// @brief Binds the textures of a mesh to their sampler uniforms.
+    ///
+    /// Every sampler name (the texture type, e.g. "diffuseTexture") gets a fixed
+    /// texture unit the first time a material uses it. The sampler uniforms are
+    /// set through the UniformTable of the program, which found them when the
+    /// program was linked and skips them once they point at their units.
+    ///
+    /// The texture bound to every unit is tracked, so bind() only touches the
+    /// units whose texture changes. Units of samplers a material does not use
+    /// are bound to 0, so they sample the same as when the textures were unbound
+    /// after every draw.
+    ///
+    class Material
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        Material() noexcept = delete; /**< Deleted default constructor */
+        ~Material() noexcept = default; /**< Default destructor */
+        Material(Material &&) noexcept = default; /**< Default move constructor */
+        Material &operator=(Material &&) noexcept = default; /**< Default move assignment operator */
+        Material(const Material &) = default; /**< Default copy constructor */
+        Material &operator=(Material const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a Material from the textures of a mesh.
+        ///
+        /// When several textures share a type, the last one is used, as the
+        /// sampler uniform can only point at one of them.
+        ///
+        /// @param[in] textures The textures of the mesh, their type names the sampler uniform.
+        ///
+        explicit Material(const std::vector<texture_t>& textures);
+
+        ///
+        /// @brief Binds the textures of the material for a draw with the program in use.
+        /// @param[in,out] uniforms The uniform table of the program in use, its samplers are pointed at their units.
+        ///
+        void bind(UniformTable& uniforms) const;
+
+        ///
+        /// @brief Checks whether two materials bind the same textures to the same units.
+        /// @param[in] other The material to compare with.
+        /// @return True if drawing with either material samples the same textures.
+        ///
+        bool operator==(const Material& other) const noexcept;
+
+        ///
+        /// @brief Gets a key that is equal for materials binding the same textures.
+        ///
+        /// Sorting draws by this key puts the draws of equal materials next to
+        /// each other. Different materials may share a key.
+        ///
+        /// @return The hash of the bindings, 20 bits.
+        ///
+        uint32_t get_sort_key() const noexcept;
+
+        ///
+        /// @brief Gets the number of textures bound by bind() since the program started.
+        /// @return The texture bind count.
+        ///
+        static size_t get_bind_count() noexcept;
+
+        ///
+        /// @brief Forgets which textures are bound, so the next bind() binds every unit again.
+        ///
+        /// Must be called after code outside of Material changed texture bindings,
+        /// e.g. texture uploads, or deleted bound textures.
+        ///
+        static void reset_bindings() noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct texture_binding_s
+        /// @brief A texture and the unit its sampler reads from.
+        ///
+        typedef struct texture_binding_s
+        {
+            GLint unit; ///< Texture unit of the sampler.
+            GLuint texture; ///< OpenGL texture ID.
+        } texture_binding_t;
+
+        ///
+        /// @brief Gets the texture unit of a sampler name, registering the name on first use.
+        /// @param[in] sampler_name Name of the sampler uniform.
+        /// @return The unit of the sampler, -1 if every unit is taken.
+        ///
+        static GLint get_texture_unit(const std::string& sampler_name);
+
+        ///
+        /// @brief Points the sampler uniforms of a program at their units.
+        /// @param[in,out] uniforms The uniform table of the program in use.
+        ///
+        static void resolve_samplers(UniformTable& uniforms);
+
+        std::vector<texture_binding_t> m_bindings; /**< One binding per used unit, sorted by unit. */
+        uint32_t m_sort_key; /**< Hash of the bindings. */
+
+        static std::vector<uint64_t> sampler_names; /**< Hashes of the registered sampler names, indexed by unit. */
+        static std::vector<GLuint> bound_textures; /**< Texture bound to every registered unit. */
+        static bool bindings_known; /**< False until bound_textures matches the OpenGL state. */
+        static size_t bind_count; /**< Textures bound by bind(). */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MATERIAL_HPP
+
+/* End of File */
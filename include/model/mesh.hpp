@@ -15,13 +15,16 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <vector>
+#include "material.hpp"
 #include "types_enums.hpp"
+#include "uniform_table.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <glad/glad.h>
+#include <glm/glm.hpp>
 
 namespace YB
 {
@@ -43,8 +46,8 @@ namespace YB
         ~Mesh() noexcept = default; /**< Default destructor */
         Mesh(Mesh &&) noexcept = default; /**< Default move constructor */
         Mesh &operator=(Mesh &&) noexcept = default; /**< Default move assignment operator */
-        Mesh(const Mesh &) noexcept = default; /**< Default copy constructor */
-        Mesh &operator=(Mesh const &) noexcept = default; /**< Default copy assignment operator */
+        Mesh(const Mesh &) noexcept = delete; /**< Deleted copy constructor */
+        Mesh &operator=(Mesh const &) noexcept = delete; /**< Deleted copy assignment operator */
 
     ////////////////////////////////////////////////////////////////////////////
     // Public Members
@@ -52,6 +55,9 @@ namespace YB
 
         ///
         /// @brief Constructs a Mesh object with given vertices, indices, and textures.
+        ///
+        /// The vertices and indices are copied and kept in memory.
+        ///
         /// @param[in] vertices A vector of vertex data.
         /// @param[in] indices A vector of index data.
         /// @param[in] textures A vector of texture data.
@@ -60,18 +66,211 @@ namespace YB
              const std::vector<GLuint>& indices,
              const std::vector<texture_t>& textures);
 
+        ///
+        /// @brief Constructs a Mesh object by taking over the given vertices, indices, and textures.
+        ///
+        /// The vertices and indices are kept in memory.
+        ///
+        /// @param[in] vertices A vector of vertex data.
+        /// @param[in] indices A vector of index data.
+        /// @param[in] textures A vector of texture data.
+        ///
+        Mesh(std::vector<vertex_t>&& vertices,
+             std::vector<GLuint>&& indices,
+             std::vector<texture_t>&& textures);
+
+        ///
+        /// @brief Constructs a Mesh object by taking over imported mesh data.
+        ///
+        /// After the upload the vectors are kept, shrunk or freed as the policy says,
+        /// without being copied.
+        ///
+        /// @param[in] vertices A vector of vertex data.
+        /// @param[in] indices A vector of index data, of all levels of detail.
+        /// @param[in] lods Levels of detail as ranges of the index data, empty for a single level.
+        /// @param[in] meshlets Meshlets of all levels of detail, empty if the mesh is not split.
+        /// @param[in] textures A vector of texture data.
+        /// @param[in] vertex_format Layout the mesh is uploaded with.
+        /// @param[in] cpu_data_policy What the mesh keeps in memory after the upload.
+        ///
+        Mesh(std::vector<vertex_t>&& vertices,
+             std::vector<GLuint>&& indices,
+             std::vector<mesh_lod_t>&& lods,
+             std::vector<meshlet_t>&& meshlets,
+             std::vector<texture_t>&& textures,
+             VERTEX_FORMAT vertex_format,
+             CPU_DATA_POLICY cpu_data_policy);
+
+        ///
+        /// @brief Constructs a Mesh object straight from vertex and index blobs.
+        ///
+        /// The blobs are uploaded to the GPU without being copied into the mesh, so they
+        /// can point into a memory mapped cache file that is released afterwards.
+        ///
+        /// With VERTEX_FORMAT::COMPACT the vertices are quantized while uploading. The
+        /// attributes are fetched normalized, so the shaders see the same inputs in
+        /// [0, 1] mesh bounds space and draw() folds the bounds into the model matrix.
+        ///
+        /// @param[in] vertices Pointer to the vertex data.
+        /// @param[in] vertex_count Number of vertices.
+        /// @param[in] indices Pointer to the index data.
+        /// @param[in] index_count Number of indices, of all levels of detail.
+        /// @param[in] lods Levels of detail as ranges of the index data, empty for a single level.
+        /// @param[in] meshlets Meshlets of all levels of detail, empty if the mesh is not split.
+        /// @param[in] textures A vector of texture data.
+        /// @param[in] vertex_format Layout the mesh is uploaded with.
+        /// @param[in] cpu_data_policy What the mesh copies out of the blobs to keep in memory.
+        ///
+        Mesh(const vertex_t* vertices,
+             size_t vertex_count,
+             const GLuint* indices,
+             size_t index_count,
+             const std::vector<mesh_lod_t>& lods,
+             const std::vector<meshlet_t>& meshlets,
+             const std::vector<texture_t>& textures,
+             VERTEX_FORMAT vertex_format,
+             CPU_DATA_POLICY cpu_data_policy);
+
         ///
         /// @brief Gets the buffers associated with this mesh.
+        ///
+        /// The buffers belong to the geometry arena and are shared by every mesh
+        /// of the same vertex format.
+        ///
         /// @return A structure containing the vertex array object (VAO), vertex buffer object (VBO),
         ///         and element buffer object (EBO) used for rendering the mesh.
         ///
         buffers_t get_buffers() const noexcept;
 
         ///
-        /// @brief Draws the mesh using the specified shader program.
-        /// @param [in] shader_program The ID of the shader program to use for rendering.
+        /// @brief Returns the geometry of the mesh to the geometry arena.
+        ///
+        /// The mesh must not be drawn afterwards.
+        ///
+        void release();
+
+        ///
+        /// @brief Gets the memory held by the mesh.
+        /// @return The geometry arena bytes and the CPU data of the mesh, the textures are not counted.
+        ///
+        asset_memory_t get_memory_usage() const noexcept;
+
+        ///
+        /// @brief Gets the vertices kept in memory.
+        /// @return The vertices with CPU_DATA_POLICY::KEEP_ALL, empty otherwise.
+        ///
+        const std::vector<vertex_t>& get_vertices() const noexcept;
+
+        ///
+        /// @brief Gets the positions kept in memory.
+        /// @return The vertex positions with CPU_DATA_POLICY::KEEP_POSITIONS, empty otherwise.
+        ///
+        const std::vector<glm::vec3>& get_positions() const noexcept;
+
+        ///
+        /// @brief Gets the indices kept in memory.
+        /// @return The indices of all levels with CPU_DATA_POLICY::KEEP_ALL, of the full level with
+        ///         CPU_DATA_POLICY::KEEP_POSITIONS, empty with CPU_DATA_POLICY::RELEASE.
+        ///
+        const std::vector<GLuint>& get_indices() const noexcept;
+
+        ///
+        /// @brief Gets the layout the mesh was uploaded with.
+        /// @return The vertex format of the mesh.
+        ///
+        VERTEX_FORMAT get_vertex_format() const noexcept;
+
+        ///
+        /// @brief Gets the handle of the geometry of the mesh in the geometry arena.
+        /// @return The handle of the vertex and index ranges.
+        ///
+        uint32_t get_geometry() const noexcept;
+
+        ///
+        /// @brief Gets the type of the uploaded indices.
+        /// @return GL_UNSIGNED_SHORT or GL_UNSIGNED_INT.
+        ///
+        GLenum get_index_type() const noexcept;
+
+        ///
+        /// @brief Gets the levels of detail of the mesh.
+        /// @return The levels as ranges of the uploaded indices, finest first.
+        ///
+        const std::vector<mesh_lod_t>& get_lods() const noexcept;
+
+        ///
+        /// @brief Gets the matrix that maps the uploaded positions to model space.
+        /// @return The bounds transform with VERTEX_FORMAT::COMPACT, identity otherwise.
+        ///
+        const glm::mat4& get_position_transform() const noexcept;
+
+        ///
+        /// @brief Gets the bounding box of the mesh in model space.
+        /// @return The box enclosing the vertices, computed at load time.
+        ///
+        const aabb_t& get_bounds() const noexcept;
+
+        ///
+        /// @brief Gets the bounding sphere of the mesh in model space.
+        /// @return The sphere around the center of the bounds enclosing the vertices.
+        ///
+        const bounding_sphere_t& get_bounding_sphere() const noexcept;
+
+        ///
+        /// @brief Gets the sampler bindings of the textures of the mesh.
+        /// @return The material of the mesh.
+        ///
+        const Material& get_material() const noexcept;
+
+        ///
+        /// @brief Picks the level of detail of one placement of the mesh.
+        ///
+        /// The coarsest level whose projected error stays under the threshold is
+        /// picked. The level of the previous selection is only left once its
+        /// error moves past the hysteresis band around the threshold, so levels
+        /// do not flicker. The ranges are reset to the whole level.
+        ///
+        /// @param [in] pixels_per_unit Size in pixels of one model space unit at the distance of the mesh.
+        /// @param [in] settings The error threshold and hysteresis of the selection.
+        /// @param [in,out] draw The draw of the placement, holding the level of the previous selection.
+        ///
+        void select_lod(float pixels_per_unit, const lod_settings_t& settings, mesh_draw_t& draw) const;
+
+        ///
+        /// @brief Drops the meshlets of the selected level that cannot be seen from the camera.
+        ///
+        /// Selecting a level draws all of its meshlets again, so this has to be
+        /// called after select_lod(). Levels without meshlets are drawn whole.
+        ///
+        /// @param [in] frustum The view frustum in model space.
+        /// @param [in] camera_position The camera position in model space.
+        /// @param [in,out] draw The draw of the placement, its ranges are replaced by the visible meshlets.
+        ///
+        void cull_meshlets(const frustum_t& frustum, const glm::vec3& camera_position, mesh_draw_t& draw) const;
+
+        ///
+        /// @brief Draws the mesh using the program in use.
+        ///
+        /// The textures stay bound after the draw, so a following mesh with the
+        /// same textures does not bind them again.
         ///
-        void draw(GLuint shader_program) const;
+        /// @param [in,out] uniforms The uniform table of the program in use.
+        /// @param [in] draw The ranges to draw, picked by select_lod() and cull_meshlets().
+        ///
+        void draw(UniformTable& uniforms, const mesh_draw_t& draw) const;
+
+        ///
+        /// @brief Draws several instances of the mesh using the program in use.
+        ///
+        /// The program reads the transforms of the instances itself. With
+        /// VERTEX_FORMAT::COMPACT it also has to map the positions back to model
+        /// space, the matrix is set as its positionTransform uniform.
+        ///
+        /// @param [in,out] uniforms The uniform table of the program in use.
+        /// @param [in] draw The ranges to draw, picked by select_lod() and cull_meshlets().
+        /// @param [in] instance_count Number of instances to draw.
+        ///
+        void draw_instances(UniformTable& uniforms, const mesh_draw_t& draw, GLsizei instance_count) const;
 
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
@@ -79,14 +278,76 @@ namespace YB
     private:
 
         ///
-        /// @brief Sets up the mesh by generating and configuring OpenGL buffers.
+        /// @brief Sets up the mesh by copying its geometry into the geometry arena.
+        /// @param[in] vertices Pointer to the vertex data to upload.
+        /// @param[in] vertex_count Number of vertices.
+        /// @param[in] indices Pointer to the index data to upload.
+        /// @param[in] index_count Number of indices.
+        ///
+        void setup_mesh(const vertex_t* vertices,
+                        size_t vertex_count,
+                        const GLuint* indices,
+                        size_t index_count);
+
+        ///
+        /// @brief Computes the bounding box and the bounding sphere of the vertices.
+        /// @param[in] vertices Pointer to the vertex data.
+        /// @param[in] vertex_count Number of vertices.
+        ///
+        void compute_bounds(const vertex_t* vertices, size_t vertex_count);
+
+        ///
+        /// @brief Quantizes the vertices to compact_vertex_t and sets the position transform.
+        /// @param[in] vertices Pointer to the vertex data to quantize.
+        /// @param[in] vertex_count Number of vertices.
+        /// @return The quantized vertices.
+        ///
+        std::vector<compact_vertex_t> quantize_vertices(const vertex_t* vertices, size_t vertex_count);
+
+        ///
+        /// @brief Keeps, shrinks or frees the CPU copies of the uploaded data as the policy says.
+        /// @param[in] vertices Pointer to the uploaded vertex data, may point into m_vertices.
+        /// @param[in] vertex_count Number of vertices.
+        /// @param[in] indices Pointer to the uploaded index data, may point into m_indices.
+        /// @param[in] index_count Number of indices.
+        ///
+        void apply_cpu_data_policy(const vertex_t* vertices,
+                                   size_t vertex_count,
+                                   const GLuint* indices,
+                                   size_t index_count);
+
+        ///
+        /// @brief Makes a draw cover the whole of its selected level.
+        /// @param[in,out] draw The draw whose ranges are replaced.
+        ///
+        void reset_draw_ranges(mesh_draw_t& draw) const;
+
+        ///
+        /// @brief Appends an index range to the ranges of a draw.
+        ///
+        /// A range that starts where the previous one ends is merged into it.
+        ///
+        /// @param[in,out] draw The draw the range is added to.
+        /// @param[in] index_offset First index of the range.
+        /// @param[in] index_count Number of indices of the range.
         ///
-        void setup_mesh();
+        void add_draw_range(mesh_draw_t& draw, uint32_t index_offset, uint32_t index_count) const;
 
         std::vector<vertex_t> m_vertices; /**< Vertex data for the mesh. */
         std::vector<GLuint> m_indices; /**< Index data for the mesh. */
+        std::vector<glm::vec3> m_positions; /**< Vertex positions kept with CPU_DATA_POLICY::KEEP_POSITIONS. */
         std::vector<texture_t> m_textures; /**< Texture data for the mesh. */
-        buffers_t m_buffers; /**< Buffers for rendering the mesh. */
+        Material m_material; /**< Sampler bindings of the textures. */
+        uint32_t m_geometry; /**< Handle of the vertex and index ranges in the geometry arena. */
+        GLsizei m_index_count; /**< Number of indices uploaded to the element buffer. */
+        GLenum m_index_type; /**< GL_UNSIGNED_SHORT or GL_UNSIGNED_INT. */
+        VERTEX_FORMAT m_vertex_format; /**< Layout of the vertex buffer. */
+        glm::mat4 m_position_transform; /**< Maps quantized positions back to model space. */
+        aabb_t m_bounds; /**< Bounding box of the vertices in model space. */
+        bounding_sphere_t m_sphere; /**< Bounding sphere of the vertices in model space. */
+        CPU_DATA_POLICY m_cpu_data_policy; /**< What the mesh keeps in memory after the upload. */
+        std::vector<mesh_lod_t> m_lods; /**< Levels of detail, finest first. */
+        std::vector<meshlet_t> m_meshlets; /**< Meshlets of all levels, culled on the CPU. */
 
     ////////////////////////////////////////////////////////////////////////////
     // Protected Members
@@ -0,0 +1,176 @@
+///
+/// @file mesh_cache.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the MeshCache class, which stores imported meshes in a binary file next to their source.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MESH_CACHE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MESH_CACHE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "mapped_file.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @struct mesh_blob_s
+    /// @brief Defines one mesh stored in a mesh cache.
+    ///
+    /// The vertex and index pointers point into the memory mapped cache file and
+    /// stay valid as long as the MeshCache that returned them is alive.
+    ///
+    typedef struct mesh_blob_s
+    {
+        const vertex_t* vertices; ///< Vertex data of the mesh.
+        size_t vertex_count; ///< Number of vertices.
+        const GLuint* indices; ///< Index data of the mesh.
+        size_t index_count; ///< Number of indices, of all levels of detail.
+        std::vector<mesh_lod_t> lods; ///< Levels of detail, ranges of the index data.
+        std::vector<meshlet_t> meshlets; ///< Meshlets of all levels of detail.
+        std::vector<texture_ref_t> textures; ///< Textures used by the mesh.
+        aabb_t bounds; ///< Bounding box of the mesh vertices.
+    } mesh_blob_t;
+
+    ///
+    /// @class MeshCache
+    /// @brief Reads and writes the binary mesh cache of a model file.
+    ///
+    /// The cache lives next to the model file with a `.ybmesh` extension. It holds
+    /// a format version, a hash of the import settings and the size and
+    /// modification time of every source file (the .obj and its .mtl libraries).
+    /// A cache whose key does not match is ignored and rebuilt by the importer.
+    ///
+    class MeshCache
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        MeshCache() noexcept = delete; /**< Deleted default constructor */
+        ~MeshCache() noexcept = default; /**< Default destructor */
+        MeshCache(MeshCache &&) noexcept = default; /**< Default move constructor */
+        MeshCache &operator=(MeshCache &&) noexcept = default; /**< Default move assignment operator */
+        MeshCache(const MeshCache &) noexcept = delete; /**< Deleted copy constructor */
+        MeshCache &operator=(MeshCache const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs the cache of the given model file.
+        /// @param[in] model_file_path Path of the source .obj file.
+        /// @param[in] settings_hash Hash of the import settings the meshes are built with.
+        ///
+        MeshCache(const std::string& model_file_path, uint64_t settings_hash);
+
+        ///
+        /// @brief Memory-maps the cache file and validates it against its sources.
+        /// @return True if the cache is up to date and its meshes can be used.
+        ///
+        bool load();
+
+        ///
+        /// @brief Gets the meshes of a loaded cache.
+        /// @return The meshes, pointing into the mapped cache file.
+        ///
+        const std::vector<mesh_blob_t>& get_meshes() const noexcept;
+
+        ///
+        /// @brief Appends a mesh to the cache that will be written by save().
+        /// @param[in] vertices Vertex data of the mesh.
+        /// @param[in] indices Index data of the mesh.
+        /// @param[in] lods Levels of detail, ranges of the index data.
+        /// @param[in] meshlets Meshlets of all levels of detail.
+        /// @param[in] textures Textures used by the mesh.
+        /// @param[in] bounds Bounding box of the mesh vertices.
+        ///
+        void add_mesh(const std::vector<vertex_t>& vertices,
+                      const std::vector<GLuint>& indices,
+                      const std::vector<mesh_lod_t>& lods,
+                      const std::vector<meshlet_t>& meshlets,
+                      const std::vector<texture_ref_t>& textures,
+                      const aabb_t& bounds);
+
+        ///
+        /// @brief Writes the added meshes to the cache file.
+        /// @return True if the cache file was written.
+        ///
+        bool save();
+
+        ///
+        /// @brief Gets the path of the cache file.
+        /// @return The path of the `.ybmesh` file.
+        ///
+        const std::string& get_cache_path() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct source_file_s
+        /// @brief Identifies the state of a source file the cache was built from.
+        ///
+        typedef struct source_file_s
+        {
+            std::string path; ///< Path of the source file.
+            int64_t size; ///< Size of the file in bytes.
+            int64_t modification_time; ///< Last write time of the file.
+        } source_file_t;
+
+        ///
+        /// @brief Collects the current state of the .obj file and its material libraries.
+        /// @return The source files of the model.
+        ///
+        std::vector<source_file_t> collect_source_files() const;
+
+        ///
+        /// @brief Reads the current size and modification time of a file.
+        /// @param[in] path Path of the file.
+        /// @param[out] source_file The state of the file.
+        /// @return True if the file exists.
+        ///
+        static bool stat_source_file(const std::string& path, source_file_t& source_file);
+
+        std::string m_model_file_path; /**< Path of the source .obj file. */
+        std::string m_cache_path; /**< Path of the cache file. */
+        uint64_t m_settings_hash; /**< Hash of the import settings. */
+        std::unique_ptr<MappedFile> m_mapped_file; /**< Mapping of a loaded cache file. */
+        std::vector<mesh_blob_t> m_meshes; /**< Meshes of a loaded cache file. */
+        std::vector<char> m_mesh_records; /**< Serialized meshes waiting for save(). */
+        uint32_t m_mesh_record_count; /**< Number of meshes waiting for save(). */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MESH_CACHE_HPP
+
+/* End of File */
@@ -0,0 +1,145 @@
+///
+/// @file mesh_optimizer.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the MeshOptimizer class, which reorders meshes for the vertex cache, overdraw and vertex fetch.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MESH_OPTIMIZER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MESH_OPTIMIZER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class MeshOptimizer
+    /// @brief Reorders the triangles and vertices of an indexed mesh without changing what it draws.
+    ///
+    /// optimize() runs four steps over a welded mesh:
+    ///  1. Triangles that repeat an index or have zero area are removed.
+    ///  2. Triangles are reordered for the post-transform vertex cache with
+    ///     Tipsify (Sander et al. 2007), which fans around the vertex that stays
+    ///     in the cache the longest.
+    ///  3. The Tipsify output is cut into clusters wherever the cache locality
+    ///     allows it, and the clusters are sorted so that outward facing ones
+    ///     are drawn first, which lets early depth testing reject more fragments.
+    ///  4. Vertices are renumbered in the order the triangles first use them, so
+    ///     vertex fetch walks the vertex buffer front to back.
+    ///
+    class MeshOptimizer
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        MeshOptimizer() noexcept = delete; /**< Deleted default constructor */
+        ~MeshOptimizer() noexcept = default; /**< Default destructor */
+        MeshOptimizer(MeshOptimizer &&) noexcept = default; /**< Default move constructor */
+        MeshOptimizer &operator=(MeshOptimizer &&) noexcept = default; /**< Default move assignment operator */
+        MeshOptimizer(const MeshOptimizer &) = default; /**< Default copy constructor */
+        MeshOptimizer &operator=(MeshOptimizer const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a MeshOptimizer for the given vertex cache size.
+        /// @param[in] cache_size Number of entries of the simulated FIFO vertex cache.
+        ///
+        explicit MeshOptimizer(size_t cache_size);
+
+        ///
+        /// @brief Runs all optimization steps on a mesh.
+        /// @param[in,out] vertices The vertex buffer, unreferenced vertices are dropped.
+        /// @param[in,out] indices The triangle list.
+        ///
+        void optimize(std::vector<vertex_t>& vertices, std::vector<GLuint>& indices) const;
+
+        ///
+        /// @brief Runs the vertex cache and overdraw steps on a triangle list that shares its vertex buffer.
+        ///
+        /// Used for the simplified levels of a mesh, whose vertices stay in the
+        /// order the full resolution level was optimized for.
+        ///
+        /// @param[in] vertices The vertex buffer.
+        /// @param[in,out] indices The triangle list.
+        ///
+        void reorder_triangles(const std::vector<vertex_t>& vertices, std::vector<GLuint>& indices) const;
+
+        ///
+        /// @brief Runs a triangle list through the simulated vertex cache.
+        /// @param[in] indices The triangle list.
+        /// @param[in] vertex_count Number of vertices the indices refer to.
+        /// @return The triangle, vertex and cache miss counts of the list.
+        ///
+        vertex_cache_stats_t analyze(const std::vector<GLuint>& indices, size_t vertex_count) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Removes triangles that repeat an index or whose corners are collinear.
+        /// @param[in] vertices The vertex buffer.
+        /// @param[in,out] indices The triangle list.
+        ///
+        static void remove_degenerate_triangles(const std::vector<vertex_t>& vertices, std::vector<GLuint>& indices);
+
+        ///
+        /// @brief Reorders triangles for the vertex cache with Tipsify.
+        /// @param[in,out] indices The triangle list.
+        /// @param[in] vertex_count Number of vertices the indices refer to.
+        /// @return First triangle of every cluster that starts after a cache flush.
+        ///
+        std::vector<size_t> optimize_vertex_cache(std::vector<GLuint>& indices, size_t vertex_count) const;
+
+        ///
+        /// @brief Splits the clusters further and draws them front-facing first.
+        /// @param[in] vertices The vertex buffer.
+        /// @param[in,out] indices The triangle list in Tipsify order.
+        /// @param[in] hard_boundaries Cluster starts returned by optimize_vertex_cache().
+        ///
+        void optimize_overdraw(const std::vector<vertex_t>& vertices,
+                               std::vector<GLuint>& indices,
+                               const std::vector<size_t>& hard_boundaries) const;
+
+        ///
+        /// @brief Renumbers the vertices in order of first use and drops unreferenced ones.
+        /// @param[in,out] vertices The vertex buffer.
+        /// @param[in,out] indices The triangle list.
+        ///
+        static void optimize_vertex_fetch(std::vector<vertex_t>& vertices, std::vector<GLuint>& indices);
+
+        size_t m_cache_size; /**< Number of entries of the simulated vertex cache. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MESH_OPTIMIZER_HPP
+
+/* End of File */
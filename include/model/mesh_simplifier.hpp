@@ -0,0 +1,144 @@
+///
+/// @file mesh_simplifier.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the MeshSimplifier class, which builds levels of detail with quadric error metrics.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MESH_SIMPLIFIER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MESH_SIMPLIFIER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class MeshSimplifier
+    /// @brief Reduces the triangle count of a mesh by collapsing edges in quadric error order.
+    ///
+    /// Every position accumulates the area weighted planes of its triangles
+    /// (Garland and Heckbert 1997). Edges are collapsed onto one of their two
+    /// endpoints, cheapest first, so the simplified index buffer still refers to
+    /// the vertex buffer of the full mesh and all levels can share it.
+    ///
+    /// Collapses work on positions rather than vertices, so attribute seams move
+    /// together; each vertex of a collapsed position is replaced by the vertex of
+    /// the target position with the closest normal and texture coordinates.
+    /// Positions on open or non-manifold edges never move, and collapses that
+    /// would flip a triangle are skipped.
+    ///
+    class MeshSimplifier
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        MeshSimplifier() noexcept = delete; /**< Deleted default constructor */
+        ~MeshSimplifier() noexcept = delete; /**< Deleted destructor */
+        MeshSimplifier(MeshSimplifier &&) noexcept = delete; /**< Deleted move constructor */
+        MeshSimplifier &operator=(MeshSimplifier &&) noexcept = delete; /**< Deleted move assignment operator */
+        MeshSimplifier(const MeshSimplifier &) noexcept = delete; /**< Deleted copy constructor */
+        MeshSimplifier &operator=(MeshSimplifier const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Simplifies a triangle list towards a target index count.
+        ///
+        /// The target may not be reached when the remaining collapses would tear
+        /// open borders or flip triangles.
+        ///
+        /// @param[in] vertices The vertex buffer of the mesh.
+        /// @param[in] indices The triangle list to simplify.
+        /// @param[in] target_index_count Number of indices to stop at.
+        /// @param[out] output The simplified triangle list, referring to the same vertices.
+        /// @return The object space error of the simplified list.
+        ///
+        static float simplify(const std::vector<vertex_t>& vertices,
+                              const std::vector<GLuint>& indices,
+                              size_t target_index_count,
+                              std::vector<GLuint>& output);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct quadric_s
+        /// @brief Sum of weighted squared plane distances, as a symmetric 4x4 matrix.
+        ///
+        typedef struct quadric_s
+        {
+            double a00, a01, a02, a11, a12, a22; ///< Upper triangle of the normal outer products.
+            double b0, b1, b2; ///< Normals scaled by the plane offsets.
+            double c; ///< Squared plane offsets.
+            double weight; ///< Sum of the plane weights.
+
+            ///
+            /// @brief Adds another quadric to this one.
+            ///
+            void add(const quadric_s& other) noexcept;
+
+            ///
+            /// @brief Evaluates the weighted mean squared distance of a point to the planes.
+            ///
+            double evaluate(const glm::vec3& point) const noexcept;
+        } quadric_t;
+
+        ///
+        /// @brief Builds the quadric of a plane through a triangle.
+        /// @param[in] p0 First corner.
+        /// @param[in] p1 Second corner.
+        /// @param[in] p2 Third corner.
+        /// @return The plane quadric weighted by the triangle area.
+        ///
+        static quadric_t make_plane_quadric(const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p2) noexcept;
+
+        ///
+        /// @brief Checks whether moving a position flips any of its triangles.
+        /// @param[in] positions The unique positions.
+        /// @param[in] triangles Triangles over unique positions.
+        /// @param[in] adjacency Triangles around every position.
+        /// @param[in] adjacency_offsets First adjacency entry of every position.
+        /// @param[in] from The position that moves.
+        /// @param[in] to The position it moves onto.
+        /// @return True if a triangle that survives the collapse would flip.
+        ///
+        static bool collapse_flips(const std::vector<glm::vec3>& positions,
+                                   const std::vector<GLuint>& triangles,
+                                   const std::vector<uint32_t>& adjacency,
+                                   const std::vector<size_t>& adjacency_offsets,
+                                   GLuint from,
+                                   GLuint to);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MESH_SIMPLIFIER_HPP
+
+/* End of File */
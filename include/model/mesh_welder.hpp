@@ -0,0 +1,178 @@
+///
+/// @file mesh_welder.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the MeshWelder class, which merges duplicate face corners into shared vertices.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MESH_WELDER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MESH_WELDER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class MeshWelder
+    /// @brief Turns a list of face corners into an indexed vertex buffer.
+    ///
+    /// The MeshWelder class receives every face corner of a shape together with the
+    /// (position, normal, texcoord) index triple it was built from, and returns the
+    /// index of a shared vertex for it. With a zero epsilon, corners are merged only
+    /// when their index triples are identical. With a positive epsilon, corners are
+    /// merged when their attribute values fall into the same epsilon sized cell.
+    ///
+    class MeshWelder
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        MeshWelder() noexcept = delete; /**< Deleted default constructor */
+        ~MeshWelder() noexcept = default; /**< Default destructor */
+        MeshWelder(MeshWelder &&) noexcept = default; /**< Default move constructor */
+        MeshWelder &operator=(MeshWelder &&) noexcept = default; /**< Default move assignment operator */
+        MeshWelder(const MeshWelder &) = default; /**< Default copy constructor */
+        MeshWelder &operator=(MeshWelder const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a MeshWelder with the given welding epsilon.
+        /// @param[in] epsilon Cell size for near-duplicate welding, 0 for exact index welding.
+        ///
+        explicit MeshWelder(float epsilon);
+
+        ///
+        /// @brief Reserves memory for the expected number of face corners.
+        /// @param[in] corner_count The number of face corners that will be added.
+        ///
+        void reserve(size_t corner_count);
+
+        ///
+        /// @brief Adds a face corner and returns the index of its welded vertex.
+        /// @param[in] attribute_indices The (position, normal, texcoord) indices of the corner.
+        /// @param[in] vertex The vertex built from the attribute indices.
+        /// @return The index of the shared vertex in the welded vertex buffer.
+        ///
+        GLuint add_corner(const glm::ivec3& attribute_indices, const vertex_t& vertex);
+
+        ///
+        /// @brief Moves the welded vertex buffer out of the welder.
+        /// @return The unique vertices referenced by the returned indices.
+        ///
+        std::vector<vertex_t> take_vertices() noexcept;
+
+        ///
+        /// @brief Gets the vertex counts before and after welding.
+        /// @return The welding statistics of the corners added so far.
+        ///
+        weld_stats_t get_stats() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct index_key_s
+        /// @brief Key of a corner in exact welding mode.
+        ///
+        typedef struct index_key_s
+        {
+            int32_t position; ///< Position index of the corner.
+            int32_t normal; ///< Normal index of the corner.
+            int32_t texcoord; ///< Texture coordinate index of the corner.
+
+            bool operator==(const index_key_s& other) const noexcept
+            {
+                return this->position == other.position &&
+                       this->normal == other.normal &&
+                       this->texcoord == other.texcoord;
+            }
+        } index_key_t;
+
+        ///
+        /// @struct value_key_s
+        /// @brief Key of a corner in epsilon welding mode, one quantized cell per attribute component.
+        ///
+        typedef struct value_key_s
+        {
+            int64_t cells[8]; ///< Quantized position, normal and texture coordinate components.
+
+            bool operator==(const value_key_s& other) const noexcept
+            {
+                for (int idx = 0; idx < 8; idx++)
+                {
+                    if (this->cells[idx] != other.cells[idx])
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+        } value_key_t;
+
+        ///
+        /// @brief Hash functor for exact welding keys.
+        ///
+        struct index_key_hash
+        {
+            size_t operator()(const index_key_t& key) const noexcept;
+        };
+
+        ///
+        /// @brief Hash functor for epsilon welding keys.
+        ///
+        struct value_key_hash
+        {
+            size_t operator()(const value_key_t& key) const noexcept;
+        };
+
+        ///
+        /// @brief Quantizes the attributes of a vertex into an epsilon welding key.
+        /// @param[in] vertex The vertex to quantize.
+        /// @return The quantized key of the vertex.
+        ///
+        value_key_t make_value_key(const vertex_t& vertex) const noexcept;
+
+        float m_epsilon; /**< Cell size for near-duplicate welding, 0 for exact welding. */
+        size_t m_corner_count; /**< Number of face corners added so far. */
+        std::vector<vertex_t> m_vertices; /**< Welded vertex buffer. */
+        std::unordered_map<index_key_t, GLuint, index_key_hash> m_index_lookup; /**< Exact mode lookup table. */
+        std::unordered_map<value_key_t, GLuint, value_key_hash> m_value_lookup; /**< Epsilon mode lookup table. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MESH_WELDER_HPP
+
+/* End of File */
@@ -0,0 +1,113 @@
+///
+/// @file meshlet_builder.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the MeshletBuilder class, which splits meshes into small cullable clusters.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MESHLET_BUILDER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MESHLET_BUILDER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class MeshletBuilder
+    /// @brief Splits the triangles of a mesh into meshlets with a bounding sphere and a normal cone.
+    ///
+    /// A meshlet is grown from a seed triangle by repeatedly adding the
+    /// neighbouring triangle that brings in the fewest new vertices and bends
+    /// the normal cone the least, until it has MAX_VERTICES vertices or
+    /// MAX_TRIANGLES triangles. The triangles of every meshlet are moved next to
+    /// each other in the index buffer, so a meshlet is drawn as one index range.
+    ///
+    /// At draw time a meshlet can be skipped when its sphere is outside the
+    /// view frustum, or when the camera lies behind every triangle of its cone.
+    ///
+    class MeshletBuilder
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        MeshletBuilder() noexcept = delete; /**< Deleted default constructor */
+        ~MeshletBuilder() noexcept = delete; /**< Deleted destructor */
+        MeshletBuilder(MeshletBuilder &&) noexcept = delete; /**< Deleted move constructor */
+        MeshletBuilder &operator=(MeshletBuilder &&) noexcept = delete; /**< Deleted move assignment operator */
+        MeshletBuilder(const MeshletBuilder &) noexcept = delete; /**< Deleted copy constructor */
+        MeshletBuilder &operator=(MeshletBuilder const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        static constexpr size_t MAX_VERTICES = 64; /**< Most vertices a meshlet may reference. */
+        static constexpr size_t MAX_TRIANGLES = 124; /**< Most triangles a meshlet may hold. */
+
+        ///
+        /// @brief Splits one level of detail of a mesh into meshlets.
+        /// @param[in] vertices The vertex buffer of the mesh.
+        /// @param[in,out] indices The index buffer, the range of the level is reordered meshlet by meshlet.
+        /// @param[in,out] lod The level to split, receives its meshlet range.
+        /// @param[in,out] meshlets The meshlets of the mesh, the new ones are appended.
+        ///
+        static void build(const std::vector<vertex_t>& vertices,
+                          std::vector<GLuint>& indices,
+                          mesh_lod_t& lod,
+                          std::vector<meshlet_t>& meshlets);
+
+        ///
+        /// @brief Checks whether a meshlet can be skipped.
+        /// @param[in] meshlet The meshlet to test.
+        /// @param[in] frustum The view frustum in model space.
+        /// @param[in] camera_position The camera position in model space.
+        /// @return True if the meshlet is outside the frustum or faces away from the camera.
+        ///
+        static bool is_culled(const meshlet_t& meshlet, const frustum_t& frustum, const glm::vec3& camera_position) noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Computes the bounding sphere and the normal cone of a meshlet.
+        /// @param[in] vertices The vertex buffer of the mesh.
+        /// @param[in] indices The indices of the meshlet triangles.
+        /// @param[in] normals The unit normals of the meshlet triangles.
+        /// @param[in,out] meshlet The meshlet whose bounds are filled in.
+        ///
+        static void compute_bounds(const std::vector<vertex_t>& vertices,
+                                   const std::vector<GLuint>& indices,
+                                   const std::vector<glm::vec3>& normals,
+                                   meshlet_t& meshlet);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MESHLET_BUILDER_HPP
+
+/* End of File */
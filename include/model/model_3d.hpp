@@ -14,8 +14,12 @@
 // Project Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <future>
+#include <memory>
 #include <string>
 #include "mesh.hpp"
+#include "mesh_cache.hpp"
+#include "texture_loader.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -23,6 +27,45 @@
 
 namespace YB
 {
+    ///
+    /// @struct mesh_data_s
+    /// @brief Defines the CPU side data of one mesh, ready to be uploaded.
+    ///
+    /// The vertex and index pointers either point into the vectors of the mesh
+    /// (freshly imported meshes) or into the mapped mesh cache of the model.
+    ///
+    typedef struct mesh_data_s
+    {
+        std::vector<vertex_t> vertices; ///< Vertices built by the importer, empty when read from the cache.
+        std::vector<GLuint> indices; ///< Indices built by the importer, empty when read from the cache.
+        const vertex_t* vertex_data; ///< Vertex data to upload.
+        size_t vertex_count; ///< Number of vertices.
+        const GLuint* index_data; ///< Index data to upload.
+        size_t index_count; ///< Number of indices, of all levels of detail.
+        std::vector<mesh_lod_t> lods; ///< Levels of detail, ranges of the index data; empty for a single level.
+        std::vector<meshlet_t> meshlets; ///< Meshlets of all levels of detail, empty if the mesh is not split.
+        std::vector<texture_ref_t> textures; ///< Textures used by the mesh.
+        aabb_t bounds; ///< Bounding box of the mesh vertices.
+    } mesh_data_t;
+
+    ///
+    /// @struct model_data_s
+    /// @brief Defines everything a model needs before its OpenGL objects are created.
+    ///
+    /// It is produced by Model3D::import_model and Model3D::decode_textures, which
+    /// do not touch OpenGL and may run on a worker thread, and consumed by the
+    /// Model3D constructor on the render thread. The texture decodes run on the
+    /// thread pool and may still be in flight when the constructor starts.
+    ///
+    typedef struct model_data_s
+    {
+        std::vector<mesh_data_t> meshes; ///< Meshes of the model.
+        std::vector<std::future<image_data_t>> images; ///< Image decodes, one per distinct texture path.
+        weld_stats_t weld_stats; ///< Vertex counts of the model before and after welding.
+        aabb_t bounds; ///< Bounding box of the model in model space.
+        std::unique_ptr<MeshCache> mesh_cache; ///< Keeps the mapped cache alive for the mesh pointers.
+    } model_data_t;
+
     ///
     /// @class Model3D
     /// @brief Represents a 3D model with meshes and textures, capable of loading from files and rendering.
@@ -30,6 +73,12 @@ namespace YB
     /// The Model3D class handles the loading of 3D model data from files, including parsing `.obj` files,
     /// and manages textures. It also provides methods for rendering the model.
     ///
+    /// A model owns ranges of the geometry arena and texture handles that are
+    /// released by its destructor, so it can be neither copied nor moved. The
+    /// AssetManager shares one model between all placements of its file; the
+    /// placements keep their transforms and level of detail selections
+    /// themselves, the model is only read while drawing.
+    ///
     class Model3D
     {
     public:
@@ -38,10 +87,10 @@ namespace YB
     ////////////////////////////////////////////////////////////////////////////
 
         Model3D() noexcept = delete; /**< Deleted default constructor */
-        Model3D(Model3D &&) noexcept = default; /**< Default move constructor */
-        Model3D &operator=(Model3D &&) noexcept = default; /**< Default move assignment operator */
-        Model3D(const Model3D &) noexcept = default; /**< Default copy constructor */
-        Model3D &operator=(Model3D const&) noexcept = default; /**< Default copy assignment operator */
+        Model3D(Model3D &&) noexcept = delete; /**< Deleted move constructor */
+        Model3D &operator=(Model3D &&) noexcept = delete; /**< Deleted move assignment operator */
+        Model3D(const Model3D &) noexcept = delete; /**< Deleted copy constructor */
+        Model3D &operator=(Model3D const&) noexcept = delete; /**< Deleted copy assignment operator */
 
     ////////////////////////////////////////////////////////////////////////////
     // Public Members
@@ -50,16 +99,18 @@ namespace YB
         ///
         /// @brief Constructs a Model3D object by loading a model from a file.
         /// @param [in] file_path Path to the model file.
-        /// @param [in] model_name Name of the model.
-        /// @param [in] position Initial position of the model.
-        /// @param [in] rotatable Whether the model can be rotated.
-        /// @param [in] scalable Whether the model can be scaled.
         ///
-        explicit Model3D(const std::string& file_path,
-                         const std::string& model_name,
-                         const glm::vec3& position,
-                         bool rotatable,
-                         bool scalable);
+        explicit Model3D(const std::string& file_path);
+
+        ///
+        /// @brief Constructs a Model3D object from imported model data.
+        ///
+        /// Creates the OpenGL buffers and textures, so it must run on the thread
+        /// that owns the OpenGL context.
+        ///
+        /// @param [in,out] model_data The imported meshes and image decodes, both are consumed.
+        ///
+        explicit Model3D(model_data_t& model_data);
 
         ///
         /// @brief Destructor that cleans up resources.
@@ -67,14 +118,103 @@ namespace YB
         ~Model3D();
 
         ///
-        /// @brief Draws the 3D model using the provided shader program.
-        /// @param [in] shader_program The ID of the shader program to use for rendering.
+        /// @brief Draws the 3D model using the program in use.
+        /// @param [in,out] uniforms The uniform table of the program in use.
+        /// @param [in] draws The ranges of every mesh, picked by select_lod() and cull_meshlets().
         ///
-        void draw(GLuint shader_program);
+        void draw(UniformTable& uniforms, const std::vector<mesh_draw_t>& draws) const;
 
-        glm::vec3 obj_position; /**< The position of the model in world coordinates. */
-        bool is_rotatable; /**< Flag indicating if the model can be rotated. */
-        bool is_scalable; /**< Flag indicating if the model can be scaled. */
+        ///
+        /// @brief Draws several instances of the 3D model using the program in use.
+        /// @param [in,out] uniforms The uniform table of the program in use, taking the samplers and the transform of compact positions to model space.
+        /// @param [in] draws The ranges of every mesh, picked by select_lod() and cull_meshlets().
+        /// @param [in] instance_count Number of instances to draw.
+        ///
+        void draw_instances(UniformTable& uniforms, const std::vector<mesh_draw_t>& draws, GLsizei instance_count) const;
+
+        ///
+        /// @brief Picks the level of detail of every mesh for one placement of the model.
+        ///
+        /// The model is shared by all placements of its file, so the selection
+        /// is kept by the placement and the model itself is not changed.
+        ///
+        /// @param [in] pixels_per_unit Size in pixels of one model space unit at the distance of the model.
+        /// @param [in] settings The error threshold and hysteresis of the selection.
+        /// @param [in,out] draws The draws of the placement, one per mesh, resized to the mesh count.
+        ///
+        void select_lod(float pixels_per_unit, const lod_settings_t& settings, std::vector<mesh_draw_t>& draws) const;
+
+        ///
+        /// @brief Drops the meshlets of every mesh that cannot be seen from the camera.
+        ///
+        /// Must be called after select_lod(), which draws whole levels again.
+        ///
+        /// @param [in] model_view_projection The model, view and projection matrices combined.
+        /// @param [in] camera_position The camera position in model space.
+        /// @param [in,out] draws The draws of the placement, one per mesh.
+        ///
+        void cull_meshlets(const glm::mat4& model_view_projection,
+                           const glm::vec3& camera_position,
+                           std::vector<mesh_draw_t>& draws) const;
+
+        ///
+        /// @brief Gets the number of triangles the draws of a placement draw.
+        /// @param [in] draws The draws of the placement, one per mesh.
+        /// @return The triangle count of the meshlets left of the selected levels of all meshes.
+        ///
+        static size_t get_triangle_count(const std::vector<mesh_draw_t>& draws) noexcept;
+
+        ///
+        /// @brief Gets the vertex counts of the model before and after welding.
+        /// @return The welding statistics summed over all meshes of the model.
+        ///
+        weld_stats_t get_weld_stats() const noexcept;
+
+        ///
+        /// @brief Gets the bounding box of the model in model space.
+        /// @return The box enclosing the vertices of all meshes.
+        ///
+        aabb_t get_bounds() const noexcept;
+
+        ///
+        /// @brief Gets the bounding sphere of the model in model space.
+        /// @return The sphere around the center of the bounds enclosing the spheres of all meshes.
+        ///
+        bounding_sphere_t get_bounding_sphere() const noexcept;
+
+        ///
+        /// @brief Gets the meshes of the model.
+        /// @return The uploaded meshes.
+        ///
+        const std::vector<Mesh>& get_meshes() const noexcept;
+
+        ///
+        /// @brief Gets the memory held by the model.
+        /// @return The geometry, texture and CPU memory of all meshes.
+        ///
+        asset_memory_t get_memory_usage() const noexcept;
+
+        ///
+        /// @brief Reads the meshes of a model file from its mesh cache or the .obj file.
+        ///
+        /// Does not touch OpenGL, so it can run on a worker thread.
+        ///
+        /// @param [in] file_path Path to the model file.
+        /// @return The imported meshes without decoded textures, null if the file could not be read.
+        ///
+        static std::unique_ptr<model_data_t> import_model(const std::string& file_path);
+
+        ///
+        /// @brief Queues the decode of the textures referenced by the meshes of imported model data.
+        ///
+        /// Every distinct texture is decoded in parallel on the thread pool, the
+        /// function returns without waiting for the decodes.
+        ///
+        /// @param [in,out] model_data The model data the image decodes are added to.
+        ///
+        static void decode_textures(model_data_t& model_data);
+
+        static import_settings_t import_settings; /**< Settings used by every model import. */
 
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
@@ -85,27 +225,43 @@ namespace YB
         /// @brief Reads and parses a .obj file to extract model data.
         /// @param [in] file_name The name of the .obj file.
         /// @param [in] base_path The base path for texture files.
+        /// @param [in,out] model_data The model data the meshes are added to.
+        /// @param [in,out] mesh_cache The cache the imported meshes are added to.
+        /// @return True if the file could be parsed.
         ///
-        void read_obj(const std::string& file_name, const std::string& base_path);
+        static bool read_obj(const std::string& file_name,
+                             const std::string& base_path,
+                             model_data_t& model_data,
+                             MeshCache& mesh_cache);
 
         ///
-        /// @brief Loads a texture from a file.
-        /// @param [in] path The path to the texture file.
-        /// @param [in] type The type of texture (e.g., "ambientTexture").
-        /// @return The loaded texture.
+        /// @brief Reads the meshes of the model from an up to date mesh cache.
+        /// @param [in,out] model_data The model data holding the loaded mesh cache.
         ///
-        texture_t load_texture(const std::string& path, const std::string& type);
+        static void read_mesh_cache(model_data_t& model_data);
 
         ///
-        /// @brief Reads pixel data from an image file and loads it into OpenGL.
-        /// @param [in] file_name The name of the image file.
-        /// @return The ID of the generated texture.
+        /// @brief Hashes the import settings that change the imported meshes.
+        /// @return The hash that keys the mesh cache.
+        ///
+        static uint64_t hash_import_settings() noexcept;
+
+        ///
+        /// @brief Creates the OpenGL buffers and textures of imported model data.
+        ///
+        /// The images are uploaded in the order they were queued, so each upload
+        /// overlaps with the decodes that are still running. The vectors of
+        /// imported meshes are moved into the meshes instead of being copied.
+        ///
+        /// @param [in,out] model_data The imported meshes and image decodes.
         ///
-        GLuint read_texture_from_file(const char* file_name);
+        void upload(model_data_t& model_data);
 
-        std::string m_model_name; /**< Name of the model. */
         std::vector<Mesh> m_meshes; /**< Collection of meshes in the model. */
-        std::vector<texture_t> m_loaded_textures; /**< Collection of loaded textures. */
+        std::vector<texture_handle_t> m_textures; /**< Shared textures used by the meshes, released with the model. */
+        weld_stats_t m_weld_stats; /**< Vertex counts of the model before and after welding. */
+        aabb_t m_bounds; /**< Bounding box of the model in model space. */
+        bounding_sphere_t m_sphere; /**< Bounding sphere of the model in model space. */
 
     ////////////////////////////////////////////////////////////////////////////
     // Protected Members
@@ -0,0 +1,155 @@
+///
+/// @file model_load_request.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the ModelLoadRequest class, the handle of an asynchronous model load.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MODEL_LOAD_REQUEST_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MODEL_LOAD_REQUEST_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "asset_manager.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class ModelLoadRequest
+    /// @brief Tracks a model that is being loaded on a worker thread.
+    ///
+    /// The worker thread runs load(), which imports the model and decodes its
+    /// textures through the asset manager, so concurrent loads of the same file
+    /// share one import. A load that joins an import of another request returns
+    /// without waiting for it, report_progress() finishes it on the render
+    /// thread once the import is done. The render thread polls the request, draws a
+    /// placeholder once the bounds are known and acquires the model from the
+    /// asset manager when the state becomes READY. The callbacks only ever run
+    /// on the render thread.
+    ///
+    class ModelLoadRequest
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ModelLoadRequest() noexcept = delete; /**< Deleted default constructor */
+        ~ModelLoadRequest() noexcept = default; /**< Default destructor */
+        ModelLoadRequest(ModelLoadRequest &&) noexcept = delete; /**< Deleted move constructor */
+        ModelLoadRequest &operator=(ModelLoadRequest &&) noexcept = delete; /**< Deleted move assignment operator */
+        ModelLoadRequest(const ModelLoadRequest &) noexcept = delete; /**< Deleted copy constructor */
+        ModelLoadRequest &operator=(ModelLoadRequest const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a queued load request.
+        /// @param [in] file_path Path to the model file.
+        /// @param [in] model_name Name of the model.
+        /// @param [in] position Initial position of the model.
+        /// @param [in] rotatable Whether the model can be rotated.
+        /// @param [in] scalable Whether the model can be scaled.
+        /// @param [in] callbacks Progress and completion callbacks.
+        ///
+        ModelLoadRequest(const std::string& file_path,
+                         const std::string& model_name,
+                         const glm::vec3& position,
+                         bool rotatable,
+                         bool scalable,
+                         const model_load_callbacks_t& callbacks);
+
+        ///
+        /// @brief Imports the model and decodes its textures. Runs on a worker thread.
+        ///
+        void load();
+
+        ///
+        /// @brief Gets the current state of the load.
+        /// @return The state of the load.
+        ///
+        LOAD_STATE get_state() const noexcept;
+
+        ///
+        /// @brief Gets the progress of the load.
+        /// @return The progress in [0, 1].
+        ///
+        float get_progress() const noexcept;
+
+        ///
+        /// @brief Gets the bounding box of the model once its meshes are imported.
+        /// @param [out] bounds The bounding box of the model in model space.
+        /// @return True if the bounds are known.
+        ///
+        bool get_bounds(aabb_t& bounds) const;
+
+        ///
+        /// @brief Gets the file the model is loaded from.
+        /// @return The path given to the constructor.
+        ///
+        const std::string& get_file_path() const noexcept;
+
+        ///
+        /// @brief Finishes a joined import that is done and invokes the progress callback if the progress changed since the last call.
+        ///
+        void report_progress();
+
+        ///
+        /// @brief Finishes the request on the render thread and invokes the completion callback.
+        /// @param [in] success Whether the model has been added to the world.
+        ///
+        void complete(bool success);
+
+        const std::string model_name; /**< Name of the model. */
+        const glm::vec3 obj_position; /**< The position of the model in world coordinates. */
+        const bool is_rotatable; /**< Flag indicating if the model can be rotated. */
+        const bool is_scalable; /**< Flag indicating if the model can be scaled. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::string m_file_path; /**< Path to the model file. */
+        model_load_callbacks_t m_callbacks; /**< Progress and completion callbacks. */
+        std::atomic<LOAD_STATE> m_state; /**< Current state of the load. */
+        std::atomic<float> m_progress; /**< Progress written by the worker thread. */
+        float m_reported_progress; /**< Progress last passed to the progress callback. */
+        mutable std::mutex m_mutex; /**< Guards the bounds and the joined import. */
+        bool m_has_bounds; /**< Set once the meshes are imported. */
+        aabb_t m_bounds; /**< Bounding box of the model in model space. */
+        model_import_t m_import; /**< Import of another request this one waits for, invalid if none. */
+
+        ///
+        /// @brief Moves the request to READY or FAILED once its joined import is done. Never blocks.
+        ///
+        void poll_import();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MODEL_LOAD_REQUEST_HPP
+
+/* End of File */
@@ -0,0 +1,119 @@
+///
+/// @file obj_parser.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the ObjParser class, a multi-threaded parser for Wavefront .obj files.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_OBJ_PARSER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_OBJ_PARSER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include "thread_pool.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <tiny_obj_loader.h>
+
+namespace YB
+{
+    ///
+    /// @class ObjParser
+    /// @brief Parses the subset of the .obj format the engine uses on a thread pool.
+    ///
+    /// The file is memory-mapped and split on line boundaries into one chunk per
+    /// thread. Every chunk is parsed independently into its own attribute arrays,
+    /// then the arrays are merged with a prefix sum over the per-chunk attribute
+    /// counts that also resolves relative (negative) indices. Supported statements
+    /// are v, vn, vt, f, o, g, usemtl and mtllib (newmtl, Ka, Kd, Ks, map_Ka, map_Kd
+    /// and map_Ks in the material library); everything else is skipped.
+    ///
+    /// The output uses the tinyobj structures, so it can be consumed exactly like
+    /// the result of tinyobj::LoadObj, which stays the fallback when parse() fails.
+    ///
+    class ObjParser
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ObjParser() noexcept = delete; /**< Deleted default constructor */
+        ~ObjParser() noexcept = default; /**< Default destructor */
+        ObjParser(ObjParser &&) noexcept = delete; /**< Deleted move constructor */
+        ObjParser &operator=(ObjParser &&) noexcept = delete; /**< Deleted move assignment operator */
+        ObjParser(const ObjParser &) noexcept = delete; /**< Deleted copy constructor */
+        ObjParser &operator=(ObjParser const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a parser that runs on the given thread pool.
+        /// @param[in] thread_pool The pool the chunks are parsed on.
+        ///
+        explicit ObjParser(ThreadPool& thread_pool);
+
+        ///
+        /// @brief Parses an .obj file and its material libraries.
+        ///
+        /// Polygons are triangulated as a fan, like tinyobj::LoadObj does with
+        /// triangulation enabled.
+        ///
+        /// @param[in] file_path Path of the .obj file.
+        /// @param[in] base_path Directory the material libraries are searched in.
+        /// @param[out] attrib Positions, normals and texture coordinates.
+        /// @param[out] shapes Shapes with their face indices and material ids.
+        /// @param[out] materials Materials of the referenced material libraries.
+        /// @param[out] error Description of the failure when false is returned.
+        /// @return True if the file was parsed, false if the caller should fall back to tinyobj.
+        ///
+        bool parse(const std::string& file_path,
+                   const std::string& base_path,
+                   tinyobj::attrib_t& attrib,
+                   std::vector<tinyobj::shape_t>& shapes,
+                   std::vector<tinyobj::material_t>& materials,
+                   std::string& error);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Parses a material library file.
+        /// @param[in] file_path Path of the .mtl file.
+        /// @param[in,out] materials Materials the library is appended to.
+        /// @param[in,out] material_names Names of the materials, parallel to materials.
+        /// @return True if the file could be read.
+        ///
+        static bool parse_material_library(const std::string& file_path,
+                                           std::vector<tinyobj::material_t>& materials,
+                                           std::vector<std::string>& material_names);
+
+        ThreadPool& m_thread_pool; /**< Pool the chunks are parsed on. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_OBJ_PARSER_HPP
+
+/* End of File */
@@ -0,0 +1,141 @@
+///
+/// @file texture_cache.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the TextureCache class, the engine-wide registry of loaded textures.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_TEXTURE_CACHE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_TEXTURE_CACHE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "texture_loader.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class TextureCache
+    /// @brief Shares textures between models, keyed by canonical path and file content.
+    ///
+    /// Lookups are thread-safe hash map lookups, so the decode tasks can skip files
+    /// that are already loaded. The cache only holds weak references: a texture is
+    /// deleted when the last model holding its handle is destroyed, and the
+    /// handles stay valid even if they outlive the cache.
+    ///
+    class TextureCache
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~TextureCache() noexcept = default; /**< Default destructor */
+        TextureCache(TextureCache &&) noexcept = delete; /**< Deleted move constructor */
+        TextureCache &operator=(TextureCache &&) noexcept = delete; /**< Deleted move assignment operator */
+        TextureCache(const TextureCache &) noexcept = delete; /**< Deleted copy constructor */
+        TextureCache &operator=(TextureCache const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs an empty cache. Does not touch OpenGL.
+        ///
+        TextureCache();
+
+        ///
+        /// @brief Looks up a loaded texture by path. Thread-safe.
+        /// @param [in] canonical_path The canonical path of the texture file.
+        /// @return The texture, null if it is not loaded.
+        ///
+        texture_handle_t find(const std::string& canonical_path);
+
+        ///
+        /// @brief Looks up a loaded texture by the hash of its file. Thread-safe.
+        ///
+        /// On a hit the path is registered as another name of the texture.
+        ///
+        /// @param [in] canonical_path The canonical path of the texture file.
+        /// @param [in] content_hash Hash of the bytes of the texture file.
+        /// @return The texture, null if no texture with the same content is loaded.
+        ///
+        texture_handle_t find_content(const std::string& canonical_path, uint64_t content_hash);
+
+        ///
+        /// @brief Gets the texture of a decoded image, uploading it if it is not loaded yet.
+        ///
+        /// Must run on the thread that owns the OpenGL context.
+        ///
+        /// @param [in] image_data The decoded image.
+        /// @return The texture, null if the image could not be decoded.
+        ///
+        texture_handle_t insert(const image_data_t& image_data);
+
+        ///
+        /// @brief Gets the counters of the cache.
+        /// @return The hit, miss and memory counters.
+        ///
+        texture_cache_stats_t get_stats() const;
+
+        ///
+        /// @brief Turns a texture path into the key of the path lookup.
+        /// @param [in] path The path of the texture file.
+        /// @return The canonical path.
+        ///
+        static std::string canonicalize(const std::string& path);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct registry_s
+        /// @brief Defines the lookup tables, shared with the deleters of the handles.
+        ///
+        typedef struct registry_s
+        {
+            std::mutex mutex; ///< Guards the tables and the counters.
+            std::unordered_map<std::string, std::weak_ptr<const cached_texture_t>> by_path; ///< Textures by canonical path.
+            std::unordered_map<uint64_t, std::weak_ptr<const cached_texture_t>> by_content; ///< Textures by file hash.
+            texture_cache_stats_t stats; ///< Hit, miss and memory counters.
+        } registry_t;
+
+        ///
+        /// @brief Counts a hit on a live texture. The registry mutex must be held.
+        /// @param [in] texture The texture that was found.
+        /// @return The texture.
+        ///
+        texture_handle_t record_hit(const texture_handle_t& texture);
+
+        std::shared_ptr<registry_t> m_registry; /**< Lookup tables of the cache. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_TEXTURE_CACHE_HPP
+
+/* End of File */
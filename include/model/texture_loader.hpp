@@ -0,0 +1,155 @@
+///
+/// @file texture_loader.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the TextureLoader class, which decodes textures on the thread pool.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_TEXTURE_LOADER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_TEXTURE_LOADER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include "compressed_texture.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @struct image_data_s
+    /// @brief Defines a decoded texture image.
+    ///
+    typedef struct image_data_s
+    {
+        std::string path; ///< The file path to the texture image.
+        int width; ///< Width of the image in pixels.
+        int height; ///< Height of the image in pixels.
+        std::shared_ptr<unsigned char> pixels; ///< RGBA8 rows in OpenGL (bottom-up) order, null if not decoded.
+        uint64_t content_hash; ///< Hash of the bytes of the texture file.
+        texture_handle_t texture; ///< The already loaded texture when the texture cache had it, null otherwise.
+        std::shared_ptr<compressed_image_t> compressed; ///< The cooked texture when an up to date one exists, null otherwise.
+    } image_data_t;
+
+    ///
+    /// @class TextureLoader
+    /// @brief Splits texture loading into a decode step for worker threads and an upload step for the render thread.
+    ///
+    /// decode_async() queues the file read, decode and vertical flip on the thread
+    /// pool of the engine, so all textures of a model decode in parallel. Uploading
+    /// the images in the order they were queued lets the decode of the next texture
+    /// overlap with the upload of the current one.
+    ///
+    class TextureLoader
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        TextureLoader() noexcept = delete; /**< Deleted default constructor */
+        ~TextureLoader() noexcept = delete; /**< Deleted destructor */
+        TextureLoader(TextureLoader &&) noexcept = delete; /**< Deleted move constructor */
+        TextureLoader &operator=(TextureLoader &&) noexcept = delete; /**< Deleted move assignment operator */
+        TextureLoader(const TextureLoader &) noexcept = delete; /**< Deleted copy constructor */
+        TextureLoader &operator=(TextureLoader const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Queues the decode of an image file on the thread pool.
+        ///
+        /// The image is decoded on the calling thread when there is no thread pool.
+        ///
+        /// @param [in] file_name The name of the image file.
+        /// @return A future that receives the decoded image.
+        ///
+        static std::future<image_data_t> decode_async(const std::string& file_name);
+
+        ///
+        /// @brief Waits for a queued decode, running queued pool tasks in the meantime.
+        /// @param [in] image The future returned by decode_async().
+        ///
+        static void wait(const std::future<image_data_t>& image);
+
+        ///
+        /// @brief Reads pixel data from an image file and flips it for OpenGL.
+        ///
+        /// The decode is skipped when the texture cache already holds the file,
+        /// looked up by path first and by the hash of the file bytes second. A cooked
+        /// texture written by the TextureCook tool is used instead of the source
+        /// image when it is up to date.
+        ///
+        /// @param [in] file_name The name of the image file.
+        /// @return The decoded image or the cached texture, neither if the file could not be read.
+        ///
+        static image_data_t decode(const std::string& file_name);
+
+        ///
+        /// @brief Loads a decoded image into OpenGL and generates its mipmaps.
+        ///
+        /// Cooked textures are uploaded with their precomputed mip chain. When the
+        /// driver lacks the sRGB S3TC formats the source image is decoded instead.
+        ///
+        /// @param [in] image_data The decoded image.
+        /// @return The ID of the generated texture, 0 if the image could not be decoded.
+        ///
+        static GLuint upload(const image_data_t& image_data);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Decodes the bytes of an image file into bottom-up RGBA8 rows.
+        /// @param [in] file_bytes The contents of the image file.
+        /// @param [in,out] image_data The image the pixels and size are written to.
+        /// @return True if the bytes could be decoded.
+        ///
+        static bool decode_pixels(const std::vector<unsigned char>& file_bytes, image_data_t& image_data);
+
+        ///
+        /// @brief Reads the bytes of a file.
+        /// @param [in] file_name The name of the file.
+        /// @return The contents of the file, empty if it could not be read.
+        ///
+        static std::vector<unsigned char> read_file(const std::string& file_name);
+
+        ///
+        /// @brief Flips an image vertically in place, one row swap at a time.
+        /// @param [in,out] pixels The rows of the image.
+        /// @param [in] row_size Size of a row in bytes.
+        /// @param [in] height Number of rows.
+        ///
+        static void flip_rows(unsigned char* pixels, size_t row_size, int height);
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_TEXTURE_LOADER_HPP
+
+/* End of File */
@@ -93,6 +93,13 @@ namespace YB
         /// 
         glm::vec3 get_camera_direction() noexcept;
 
+        ///
+        /// @brief Gets the position of the camera.
+        ///
+        /// @return The camera's position in world coordinates.
+        ///
+        glm::vec3 get_camera_position() noexcept;
+
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
     ////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,10 @@
 
 #include "window.hpp"
 #include "camera.hpp"
+#include "thread_pool.hpp"
+#include "texture_cache.hpp"
+#include "geometry_arena.hpp"
+#include "asset_manager.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -65,6 +69,38 @@ namespace YB
         ///
         static std::shared_ptr<Camera> camera;
 
+        ///
+        /// @brief Static pointer to the ThreadPool component.
+        ///
+        /// This static pointer provides access to the worker threads shared by the
+        /// loading stages of the graphics engine.
+        ///
+        static std::shared_ptr<ThreadPool> thread_pool;
+
+        ///
+        /// @brief Static pointer to the TextureCache component.
+        ///
+        /// This static pointer provides access to the textures shared by all
+        /// models of the graphics engine.
+        ///
+        static std::shared_ptr<TextureCache> texture_cache;
+
+        ///
+        /// @brief Static pointer to the GeometryArena component.
+        ///
+        /// This static pointer provides access to the vertex and index buffers
+        /// shared by all meshes of the graphics engine.
+        ///
+        static std::shared_ptr<GeometryArena> geometry_arena;
+
+        ///
+        /// @brief Static pointer to the AssetManager component.
+        ///
+        /// This static pointer provides access to the models shared by all
+        /// placements of the graphics engine.
+        ///
+        static std::shared_ptr<AssetManager> asset_manager;
+
 
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
@@ -15,6 +15,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "shader.hpp"
+#include "shader_library.hpp"
+#include "uniform_buffers.hpp"
 #include "world.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -64,6 +66,22 @@ namespace YB
 	    /// 
         static std::shared_ptr<Shader> shader;
 
+        ///
+        /// @brief Static pointer to the shader library.
+        ///
+        /// Holds every shader the world can be drawn with, `shader` points at
+        /// one of them.
+        ///
+        static std::shared_ptr<ShaderLibrary> shader_library;
+
+        ///
+        /// @brief Static pointer to the uniform buffers shared by the shader programs.
+        ///
+        /// Holds the per-frame block every program reads and the ring of
+        /// per-object blocks.
+        ///
+        static std::shared_ptr<UniformBuffers> uniform_buffers;
+
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
     ////////////////////////////////////////////////////////////////////////////
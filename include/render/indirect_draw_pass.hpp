@@ -0,0 +1,209 @@
+///
+/// @file indirect_draw_pass.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the IndirectDrawPass class, which culls on the GPU and draws with indirect commands.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_INDIRECT_DRAW_PASS_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_INDIRECT_DRAW_PASS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "asset_manager.hpp"
+#include "material.hpp"
+#include "types_enums.hpp"
+#include "uniform_table.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class IndirectDrawPass
+    /// @brief Draws all models with a few glMultiDrawElementsIndirect calls, culled by a compute shader.
+    ///
+    /// Every mesh of every model is one draw. The draws, their levels of detail
+    /// and the model transforms live in shader storage buffers. Each frame a
+    /// compute shader tests the bounding sphere of every draw against the view
+    /// frustum, picks its level of detail by screen-space error and writes its
+    /// DrawElementsIndirectCommand. Draws that share a vertex format, index
+    /// type and material are then drawn with one indirect multi-draw, so the
+    /// CPU cost of a frame does not grow with the number of models beyond
+    /// uploading their transforms.
+    ///
+    /// The base instance of every command is its draw index. The geometry arena
+    /// feeds it to the vertex shader as an instanced attribute, which reads the
+    /// transforms of its draw from the storage buffers.
+    ///
+    /// Needs OpenGL 4.3. The pass draws with its own program, which shades the
+    /// diffuse and specular textures with the directional light and the view
+    /// of the FrameBlock, so it only stands in for the directional light shader.
+    ///
+    class IndirectDrawPass
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        IndirectDrawPass(IndirectDrawPass &&) noexcept = delete; /**< Deleted move constructor */
+        IndirectDrawPass &operator=(IndirectDrawPass &&) noexcept = delete; /**< Deleted move assignment operator */
+        IndirectDrawPass(const IndirectDrawPass &) noexcept = delete; /**< Deleted copy constructor */
+        IndirectDrawPass &operator=(IndirectDrawPass const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Compiles the culling and drawing programs and creates the buffers.
+        ///
+        IndirectDrawPass();
+
+        ///
+        /// @brief Deletes the programs and buffers and removes the draw id attribute from the geometry arena.
+        ///
+        ~IndirectDrawPass();
+
+        ///
+        /// @brief Checks whether the current context can run the pass.
+        /// @return True with OpenGL 4.3 or later.
+        ///
+        static bool is_supported() noexcept;
+
+        ///
+        /// @brief Checks whether both programs compiled and linked.
+        /// @return True if the pass can draw.
+        ///
+        bool is_valid() const noexcept;
+
+        ///
+        /// @brief Culls and draws the models with the current camera.
+        ///
+        /// The draws are rebuilt when the number of models changes, so the
+        /// models must only be added or removed, not replaced in place.
+        ///
+        /// @param[in] models The models to draw.
+        /// @param[in] model_matrices The model matrix of every model.
+        /// @param[in] settings The error threshold of the level of detail selection.
+        ///
+        void render(const std::vector<model_handle_t>& models,
+                    const std::vector<glm::mat4>& model_matrices,
+                    const lod_settings_t& settings);
+
+        ///
+        /// @brief Gets the number of triangles of the finest levels of all draws.
+        ///
+        /// The culling results stay on the GPU, so this is the upper bound of
+        /// what the last render() call drew.
+        ///
+        /// @return The triangle count.
+        ///
+        size_t get_triangle_count() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct object_s
+        /// @brief Transforms of one model, as read by the shaders (std430).
+        ///
+        typedef struct object_s
+        {
+            glm::mat4 model; ///< Model matrix.
+            glm::mat4 normal; ///< Inverse transpose of the model matrix.
+        } object_t;
+
+        ///
+        /// @struct draw_record_s
+        /// @brief One mesh of a model, as read by the shaders (std430).
+        ///
+        typedef struct draw_record_s
+        {
+            glm::mat4 position_transform; ///< Maps the uploaded positions to model space.
+            glm::vec4 sphere; ///< Bounding sphere in model space, radius in w.
+            GLuint lod_offset; ///< First level of the draw in the level buffer.
+            GLuint lod_count; ///< Number of levels of the draw.
+            GLint base_vertex; ///< First vertex of the mesh in the geometry arena.
+            GLuint object; ///< Index of the model in the object buffer.
+        } draw_record_t;
+
+        ///
+        /// @struct lod_record_s
+        /// @brief One level of detail of a draw, as read by the shaders (std430).
+        ///
+        typedef struct lod_record_s
+        {
+            GLuint index_count; ///< Number of indices of the level.
+            GLuint first_index; ///< First index of the level in the index buffer of the arena.
+            float error; ///< Model space error of the level.
+            GLuint padding; ///< Keeps the record 16 bytes.
+        } lod_record_t;
+
+        ///
+        /// @struct batch_s
+        /// @brief Consecutive draws issued with one indirect multi-draw.
+        ///
+        typedef struct batch_s
+        {
+            VERTEX_FORMAT vertex_format; ///< Pool of the geometry arena of the draws.
+            GLenum index_type; ///< Type of the indices of the draws.
+            Material material; ///< Textures of the draws.
+            size_t first_draw; ///< First command of the batch.
+            size_t draw_count; ///< Number of commands of the batch.
+        } batch_t;
+
+        ///
+        /// @brief Compiles the shaders of the given stages and links them into a program.
+        /// @param[in] stages The shader types and their sources.
+        /// @return The program, 0 if a stage did not compile or the program did not link.
+        ///
+        static GLuint create_program(const std::vector<std::pair<GLenum, const char*>>& stages);
+
+        ///
+        /// @brief Rebuilds the draws, levels and batches from the meshes of the models.
+        /// @param[in] models The models to draw.
+        ///
+        void rebuild(const std::vector<model_handle_t>& models);
+
+        GLuint m_cull_program; /**< Compute program writing the commands. */
+        GLuint m_draw_program; /**< Program drawing the commands. */
+        UniformTable m_draw_uniforms; /**< Uniforms of the draw program, the samplers of the materials. */
+        GLuint m_object_buffer; /**< Storage buffer of object_t, rewritten every frame. */
+        GLuint m_draw_buffer; /**< Storage buffer of draw_record_t. */
+        GLuint m_lod_buffer; /**< Storage buffer of lod_record_t. */
+        GLuint m_command_buffer; /**< Indirect commands written by the compute program. */
+        GLuint m_draw_id_buffer; /**< Draw indices fetched through the base instance. */
+        std::vector<object_t> m_objects; /**< Transforms of the models of the current frame. */
+        std::vector<batch_t> m_batches; /**< Multi-draws of the current draws. */
+        size_t m_model_count; /**< Number of models the draws were built from. */
+        size_t m_draw_count; /**< Number of draws. */
+        size_t m_triangle_count; /**< Triangles of the finest levels of all draws. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_INDIRECT_DRAW_PASS_HPP
+
+/* End of File */
@@ -0,0 +1,212 @@
+///
+/// @file occlusion_query_pass.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the OcclusionQueryPass class, which skips hidden objects with hardware occlusion queries.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_OCCLUSION_QUERY_PASS_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_OCCLUSION_QUERY_PASS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "box_mesh.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class OcclusionQueryPass
+    /// @brief Draws objects in the order of coherent hierarchical culling (CHC++), skipping hidden ones on the GPU.
+    ///
+    /// Every object remembers whether it was visible the last time its query
+    /// result came back. The objects that were visible are drawn first, all in
+    /// one submission, which fills the depth buffer with the likely occluders.
+    /// Every few frames the draw of such an object is left out of it and
+    /// wrapped in a query instead, to notice when it becomes hidden.
+    ///
+    /// The objects that were hidden, or are drawn for the first time, then
+    /// have their bounding boxes drawn without color or depth writes, each
+    /// inside a GL_ANY_SAMPLES_PASSED query. Their draws follow inside
+    /// glBeginConditionalRender, so the GPU drops them when no sample of the
+    /// box passed. The CPU reads the results a frame later, and only those that
+    /// are available, so it never waits for the GPU. Until the result of a box
+    /// is read, no new query is issued for its object: it keeps being drawn
+    /// under the conditional render of the box still in flight.
+    ///
+    /// Needs OpenGL 3.3.
+    ///
+    class OcclusionQueryPass
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        OcclusionQueryPass(OcclusionQueryPass &&) noexcept = delete; /**< Deleted move constructor */
+        OcclusionQueryPass &operator=(OcclusionQueryPass &&) noexcept = delete; /**< Deleted move assignment operator */
+        OcclusionQueryPass(const OcclusionQueryPass &) noexcept = delete; /**< Deleted copy constructor */
+        OcclusionQueryPass &operator=(OcclusionQueryPass const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Compiles the program the bounding boxes are drawn with.
+        ///
+        OcclusionQueryPass();
+
+        ///
+        /// @brief Deletes the queries and the program.
+        ///
+        ~OcclusionQueryPass();
+
+        ///
+        /// @brief Checks whether the current context can run the pass.
+        /// @return True with OpenGL 3.3 or later.
+        ///
+        static bool is_supported() noexcept;
+
+        ///
+        /// @brief Checks whether the box program compiled and linked.
+        /// @return True if the pass can draw.
+        ///
+        bool is_valid() const noexcept;
+
+        ///
+        /// @brief Draws the objects that passed the frustum culling.
+        ///
+        /// Reads the query results that became available since the last call
+        /// first, then draws the objects that were visible, then queries and
+        /// conditionally draws the others.
+        ///
+        /// @param[in] objects The objects to draw, identifiers below the object count given to resize().
+        /// @param[in] boxes The world box of every object of the list, in the same order.
+        /// @param[in] view_projection The view projection matrix of the frame.
+        /// @param[in] callbacks Draw the objects with their own programs and state.
+        ///
+        void render(const std::vector<uint32_t>& objects,
+                    const std::vector<aabb_t>& boxes,
+                    const glm::mat4& view_projection,
+                    const occlusion_query_callbacks_t& callbacks);
+
+        ///
+        /// @brief Sets the number of objects, forgetting the visibility of the removed ones.
+        /// @param[in] object_count The number of objects.
+        ///
+        void resize(size_t object_count);
+
+        ///
+        /// @brief Gets the counters of the last render() call.
+        /// @return The query counters.
+        ///
+        const occlusion_query_stats_t& get_stats() const noexcept;
+
+        static constexpr uint64_t VISIBLE_QUERY_INTERVAL = 4; /**< Frames between the queries of an object that stays visible. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct query_state_s
+        /// @brief The query and the last known visibility of one object.
+        ///
+        typedef struct query_state_s
+        {
+            GLuint query; ///< Query object, 0 until the first query.
+            uint64_t issued_frame; ///< Frame the pending query was issued in.
+            bool pending; ///< Whether a result is expected.
+            bool conditional; ///< Whether the pending query drove a conditional draw.
+            bool visible; ///< Result of the last query read, false before the first one.
+            uint32_t conditional_draws; ///< Conditional draws made under the pending query.
+        } query_state_t;
+
+        ///
+        /// @brief Reads the results that are available without waiting and updates the visibility.
+        ///
+        void collect_results();
+
+        ///
+        /// @brief Checks whether a box reaches in front of the near plane, where its faces would be clipped away.
+        /// @param[in] box The box in world space.
+        /// @param[in] view_projection The view projection matrix of the frame.
+        /// @return True if a corner of the box is in front of the near plane.
+        ///
+        static bool crosses_near_plane(const aabb_t& box, const glm::mat4& view_projection) noexcept;
+
+        ///
+        /// @brief Hands a single object to the draw callback, for a draw wrapped in a query or a conditional draw.
+        /// @param[in] object The object.
+        /// @param[in] callbacks The callbacks of the render() call.
+        ///
+        void draw_one(uint32_t object, const occlusion_query_callbacks_t& callbacks);
+
+        ///
+        /// @brief Draws the boxes of the objects queried this frame, each inside a new query.
+        /// @param[in] objects The objects of the render() call.
+        /// @param[in] boxes The world box of every object of the list.
+        /// @param[in] view_projection The view projection matrix of the camera.
+        /// @param[in] callbacks The callbacks of the render() call.
+        ///
+        void draw_boxes(const std::vector<uint32_t>& objects,
+                        const std::vector<aabb_t>& boxes,
+                        const glm::mat4& view_projection,
+                        const occlusion_query_callbacks_t& callbacks);
+
+        ///
+        /// @brief Draws an object under the conditional render of its pending box query.
+        /// @param[in] object The object.
+        /// @param[in] callbacks The callbacks of the render() call.
+        ///
+        void draw_conditional(uint32_t object, const occlusion_query_callbacks_t& callbacks);
+
+        ///
+        /// @brief Begins a query for an object, creating its query object on first use.
+        /// @param[in] state The state of the object.
+        /// @param[in] conditional Whether a conditional draw follows the query.
+        ///
+        void begin_query(query_state_t& state, bool conditional);
+
+        std::vector<query_state_t> m_states; /**< State of every object. */
+        std::vector<size_t> m_queried; /**< Positions in the object list of the boxes queried this frame. */
+        std::vector<size_t> m_requeried; /**< Positions in the object list of the visible objects queried this frame. */
+        std::vector<size_t> m_waiting; /**< Positions in the object list of the hidden objects whose box result is still pending. */
+        std::vector<uint32_t> m_draws; /**< Objects of the list handed to the draw callback. */
+        std::shared_ptr<BoxMesh> m_box; /**< Unit cube drawn for the queries. */
+        GLuint m_program; /**< Program drawing the boxes, position only. */
+        GLint m_box_matrix_location; /**< Uniform location of the box to clip space matrix. */
+        uint64_t m_frame; /**< Number of render() calls. */
+        occlusion_query_stats_t m_stats; /**< Counters of the last render() call. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_OCCLUSION_QUERY_PASS_HPP
+
+/* End of File */
@@ -0,0 +1,218 @@
+///
+/// @file render_queue.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the RenderQueue class, which sorts draw packets by state before submitting them.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_RENDER_QUEUE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_RENDER_QUEUE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include "mesh.hpp"
+#include "shader.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class RenderQueue
+    /// @brief Collects the draws of a frame as packets and submits them sorted by the state they need.
+    ///
+    /// Every packet carries a 64-bit key, from the most to the least
+    /// significant bits:
+    ///
+    ///     | pass (2) | shader (8) | material (20) | vertex array (8) | depth (26) |
+    ///
+    /// The packets are sorted by their keys with a radix sort, so draws with
+    /// the same program, textures and vertex array follow each other, and
+    /// within them the solid draws go front to back. The submission only
+    /// switches the program, uploads matrices and binds textures when they
+    /// differ from the previous packet.
+    ///
+    /// A packet copies the index ranges of the draw of its placement when it
+    /// is added, so the caller can reuse its draws before the submission.
+    ///
+    /// When a program declares ObjectBlock, the matrices of all its packets
+    /// are written to the ring buffer of DrawComponents::uniform_buffers in
+    /// one go before the first draw, and every draw only binds its range
+    /// instead of uploading the matrices with uniform calls.
+    ///
+    class RenderQueue
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        RenderQueue() noexcept = default; /**< Default constructor */
+        ~RenderQueue() noexcept = default; /**< Default destructor */
+        RenderQueue(RenderQueue &&) noexcept = default; /**< Default move constructor */
+        RenderQueue &operator=(RenderQueue &&) noexcept = default; /**< Default move assignment operator */
+        RenderQueue(const RenderQueue &) = default; /**< Default copy constructor */
+        RenderQueue &operator=(RenderQueue const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Starts a frame, dropping the packets left over and resetting the statistics.
+        /// @param[in] view_matrix The view matrix of the frame, uploaded once per program switch.
+        ///
+        void begin_frame(const glm::mat4& view_matrix);
+
+        ///
+        /// @brief Adds the model matrix of an object, shared by the packets of its meshes.
+        /// @param[in] model_matrix The model matrix.
+        /// @return The index of the transform, passed to add_mesh().
+        ///
+        uint32_t add_transform(const glm::mat4& model_matrix);
+
+        ///
+        /// @brief Adds a packet drawing ranges of a mesh.
+        ///
+        /// Draws without ranges left after the level of detail selection and
+        /// meshlet culling add no packet.
+        ///
+        /// @param[in] shader The shader to draw with, it must outlive the submission.
+        /// @param[in] mesh The mesh, it must outlive the submission.
+        /// @param[in] draw The ranges of the mesh to draw, copied into the packet.
+        /// @param[in] transform The index returned by add_transform().
+        /// @param[in] depth The distance of the mesh from the camera.
+        /// @param[in] pass The pass of the draw.
+        ///
+        void add_mesh(Shader& shader,
+                      const Mesh& mesh,
+                      const mesh_draw_t& draw,
+                      uint32_t transform,
+                      float depth,
+                      RENDER_PASS pass = RENDER_PASS::SOLID);
+
+        ///
+        /// @brief Sorts the packets added since the last submission, draws them and removes them.
+        ///
+        void submit();
+
+        ///
+        /// @brief Forgets the program in use, so the next submission switches to its first program again.
+        ///
+        /// Must be called after code outside of the queue changed the program
+        /// in use, or the model matrix of a program the queue uses.
+        ///
+        void reset_bindings() noexcept;
+
+        ///
+        /// @brief Gets the counters of the submissions since begin_frame().
+        /// @return The draw and state change counters.
+        ///
+        const render_queue_stats_t& get_stats() const noexcept;
+
+        static constexpr size_t MAX_SHADERS = 256; /**< Distinct shaders one submission sorts apart, the others share the last key. */
+        static constexpr uint32_t NO_TRANSFORM = UINT32_MAX; /**< No transform is known to be uploaded. */
+        static constexpr uint32_t NO_OBJECT = UINT32_MAX; /**< No object block is bound, or the packet does not use one. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct draw_packet_s
+        /// @brief The draw of one mesh, everything the submission needs besides the key.
+        ///
+        typedef struct draw_packet_s
+        {
+            Shader* shader; ///< The shader to draw with.
+            const Mesh* mesh; ///< The mesh, its material, geometry and index type are read at the submission.
+            uint32_t transform; ///< Index of the model matrix in m_transforms.
+            uint32_t first_range; ///< First range of the packet in m_range_counts and m_range_offsets.
+            uint32_t range_count; ///< Number of ranges.
+        } draw_packet_t;
+
+        ///
+        /// @struct sort_entry_s
+        /// @brief A key and the packet it belongs to, the unit the radix sort moves.
+        ///
+        typedef struct sort_entry_s
+        {
+            uint64_t key; ///< Sort key of the packet.
+            uint32_t packet; ///< Index of the packet in m_packets.
+        } sort_entry_t;
+
+        ///
+        /// @brief Gets the index of a shader in the shaders of the submission, registering it on first use.
+        /// @param[in] shader The shader.
+        /// @return The index, written into the shader bits of the key, MAX_SHADERS - 1 once every index is taken.
+        ///
+        uint32_t get_shader_index(Shader& shader);
+
+        ///
+        /// @brief Writes the object blocks of the sorted packets whose program declares ObjectBlock.
+        ///
+        /// Fills m_entry_objects with the object of every entry, NO_OBJECT for
+        /// the packets drawn with uniforms.
+        ///
+        void write_objects();
+
+        ///
+        /// @brief Sorts the entries by key, eight bits per pass, skipping the bytes all keys share.
+        /// @param[in,out] entries The entries to sort.
+        /// @param[in,out] scratch Storage of the same size, its content is overwritten.
+        ///
+        static void radix_sort(std::vector<sort_entry_t>& entries, std::vector<sort_entry_t>& scratch);
+
+        ///
+        /// @brief Builds the sort key of a packet.
+        /// @param[in] pass The pass of the draw.
+        /// @param[in] shader The index of the shader.
+        /// @param[in] mesh The mesh, giving the material and the vertex array.
+        /// @param[in] depth The distance of the mesh from the camera.
+        /// @return The key.
+        ///
+        static uint64_t make_key(RENDER_PASS pass, uint32_t shader, const Mesh& mesh, float depth) noexcept;
+
+        std::vector<draw_packet_t> m_packets; /**< Packets added since the last submission. */
+        std::vector<sort_entry_t> m_entries; /**< Keys of the packets, sorted by submit(). */
+        std::vector<sort_entry_t> m_scratch; /**< Second buffer of the radix sort. */
+        std::vector<glm::mat4> m_transforms; /**< Model matrices of the packets. */
+        std::vector<GLsizei> m_range_counts; /**< Index counts of the ranges of all packets. */
+        std::vector<size_t> m_range_offsets; /**< Byte offsets of the ranges of all packets. */
+        std::vector<object_block_t> m_objects; /**< Object blocks of the submission, in the order of the sorted packets. */
+        std::vector<GLintptr> m_object_offsets; /**< Offsets of the object blocks in the ring buffer. */
+        std::vector<uint32_t> m_entry_objects; /**< Object block of every sorted entry, NO_OBJECT if it uses uniforms. */
+        std::vector<Shader*> m_shaders; /**< Shaders of the packets, in the order of the shader bits of the keys. */
+        glm::mat4 m_view_matrix{1.0f}; /**< View matrix of the frame. */
+        Shader* m_bound_shader = nullptr; /**< Shader whose program is in use, null if unknown. */
+        uint32_t m_bound_transform = NO_TRANSFORM; /**< Transform uploaded to the bound shader, NO_TRANSFORM if unknown. */
+        uint32_t m_bound_object = NO_OBJECT; /**< Object block bound to OBJECT_BLOCK_BINDING, NO_OBJECT if unknown. */
+        render_queue_stats_t m_stats{0, 0, 0, 0}; /**< Counters of the submissions since begin_frame(). */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_RENDER_QUEUE_HPP
+
+/* End of File */
@@ -0,0 +1,118 @@
+///
+/// @file uniform_blocks.hpp
+/// @author Yasin BASAR
+/// @brief Defines the std140 uniform blocks shared by the shader programs and their C++ mirrors.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_BLOCKS_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_BLOCKS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @struct frame_block_s
+    /// @brief The per-frame data, the C++ side of the FrameBlock uniform block.
+    ///
+    /// Only mat4 and vec4 members are used, so the std140 offsets are the C++
+    /// offsets without any padding rules to get wrong. vec3 values are stored
+    /// in the xyz of a vec4.
+    ///
+    typedef struct frame_block_s
+    {
+        glm::mat4 view; ///< View matrix.
+        glm::mat4 projection; ///< Projection matrix.
+        glm::mat4 view_projection; ///< Projection times view.
+        glm::vec4 camera_position; ///< Camera position in world space, w unused.
+        glm::vec4 light_direction; ///< Direction towards the light, w unused.
+        glm::vec4 light_color; ///< Color of the light, w unused.
+        glm::vec4 light_position; ///< Position of the point light, w unused.
+        glm::vec4 light_attenuation; ///< Constant, linear and quadratic attenuation of the point light, w unused.
+    } frame_block_t;
+
+    ///
+    /// @struct object_block_s
+    /// @brief The per-object data, the C++ side of the ObjectBlock uniform block.
+    ///
+    typedef struct object_block_s
+    {
+        glm::mat4 model; ///< Model matrix, including the position transform of compact meshes.
+        glm::mat4 normal; ///< Normal matrix in its upper 3x3, the inverse transpose of view times model.
+    } object_block_t;
+
+    ///
+    /// @brief GLSL declaration of FrameBlock, to be pasted into the shaders that read it.
+    ///
+    constexpr const char* FRAME_BLOCK_SOURCE = R"(
+layout(std140) uniform FrameBlock
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    vec4 cameraPosition;
+    vec4 lightDir;
+    vec4 lightColor;
+    vec4 lightPosition;
+    vec4 lightAttenuation;
+} frame;
+)";
+
+    ///
+    /// @brief GLSL declaration of ObjectBlock, to be pasted into the shaders that read it.
+    ///
+    constexpr const char* OBJECT_BLOCK_SOURCE = R"(
+layout(std140) uniform ObjectBlock
+{
+    mat4 model;
+    mat4 normal;
+} object;
+)";
+
+    constexpr const char* FRAME_BLOCK_NAME = "FrameBlock"; ///< Name of the per-frame block in GLSL.
+    constexpr const char* OBJECT_BLOCK_NAME = "ObjectBlock"; ///< Name of the per-object block in GLSL.
+    constexpr GLuint FRAME_BLOCK_BINDING = 0; ///< Binding point of the per-frame block in every program.
+    constexpr GLuint OBJECT_BLOCK_BINDING = 1; ///< Binding point of the per-object block in every program.
+
+    constexpr size_t STD140_VEC4_SIZE = 4 * sizeof(float); ///< Size and alignment of a vec4 under std140.
+    constexpr size_t STD140_MAT4_SIZE = 4 * STD140_VEC4_SIZE; ///< Size of a mat4 under std140, four vec4 columns.
+
+    // the blocks are copied into the buffers byte for byte, so the C++ layout has to be the std140 one
+    static_assert(std::is_standard_layout<frame_block_t>::value, "frame_block_t must have a standard layout");
+    static_assert(sizeof(glm::mat4) == STD140_MAT4_SIZE, "glm::mat4 must be four packed vec4 columns");
+    static_assert(sizeof(glm::vec4) == STD140_VEC4_SIZE, "glm::vec4 must be four packed floats");
+    static_assert(offsetof(frame_block_t, view) == 0, "FrameBlock.view must be at offset 0");
+    static_assert(offsetof(frame_block_t, projection) == 1 * STD140_MAT4_SIZE, "FrameBlock.projection must be at offset 64");
+    static_assert(offsetof(frame_block_t, view_projection) == 2 * STD140_MAT4_SIZE, "FrameBlock.viewProjection must be at offset 128");
+    static_assert(offsetof(frame_block_t, camera_position) == 3 * STD140_MAT4_SIZE, "FrameBlock.cameraPosition must be at offset 192");
+    static_assert(offsetof(frame_block_t, light_direction) == 3 * STD140_MAT4_SIZE + 1 * STD140_VEC4_SIZE, "FrameBlock.lightDir must be at offset 208");
+    static_assert(offsetof(frame_block_t, light_color) == 3 * STD140_MAT4_SIZE + 2 * STD140_VEC4_SIZE, "FrameBlock.lightColor must be at offset 224");
+    static_assert(offsetof(frame_block_t, light_position) == 3 * STD140_MAT4_SIZE + 3 * STD140_VEC4_SIZE, "FrameBlock.lightPosition must be at offset 240");
+    static_assert(offsetof(frame_block_t, light_attenuation) == 3 * STD140_MAT4_SIZE + 4 * STD140_VEC4_SIZE, "FrameBlock.lightAttenuation must be at offset 256");
+    static_assert(sizeof(frame_block_t) == 3 * STD140_MAT4_SIZE + 5 * STD140_VEC4_SIZE, "FrameBlock must be 272 bytes");
+
+    static_assert(std::is_standard_layout<object_block_t>::value, "object_block_t must have a standard layout");
+    static_assert(offsetof(object_block_t, model) == 0, "ObjectBlock.model must be at offset 0");
+    static_assert(offsetof(object_block_t, normal) == STD140_MAT4_SIZE, "ObjectBlock.normal must be at offset 64");
+    static_assert(sizeof(object_block_t) == 2 * STD140_MAT4_SIZE, "ObjectBlock must be 128 bytes");
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_BLOCKS_HPP
+
+/* End of File */
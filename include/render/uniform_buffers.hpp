@@ -0,0 +1,126 @@
+///
+/// @file uniform_buffers.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the UniformBuffers class, which owns the per-frame and per-object uniform buffers.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_BUFFERS_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_BUFFERS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include "uniform_blocks.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class UniformBuffers
+    /// @brief Fills the buffers behind FrameBlock and ObjectBlock.
+    ///
+    /// The per-frame buffer stays bound to FRAME_BLOCK_BINDING, so every
+    /// program declaring FrameBlock reads the same data once update_frame()
+    /// has run, without a uniform call per program.
+    ///
+    /// The per-object data goes into a ring buffer. write_objects() maps the
+    /// next free range without synchronization, which is safe because that
+    /// range was not written since the buffer was last orphaned. When the ring
+    /// is full, the storage is orphaned with glBufferData, and the driver keeps
+    /// the old storage alive until the GPU has finished reading it. A draw then
+    /// only binds its range to OBJECT_BLOCK_BINDING.
+    ///
+    class UniformBuffers
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        UniformBuffers(UniformBuffers &&) noexcept = delete; /**< Deleted move constructor */
+        UniformBuffers &operator=(UniformBuffers &&) noexcept = delete; /**< Deleted move assignment operator */
+        UniformBuffers(const UniformBuffers &) noexcept = delete; /**< Deleted copy constructor */
+        UniformBuffers &operator=(UniformBuffers const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Creates the buffers and binds the per-frame one to its binding point.
+        ///
+        UniformBuffers();
+
+        ///
+        /// @brief Deletes the buffers.
+        ///
+        ~UniformBuffers();
+
+        ///
+        /// @brief Replaces the per-frame data.
+        /// @param[in] block The data of the frame.
+        ///
+        void update_frame(const frame_block_t& block);
+
+        ///
+        /// @brief Copies per-object data into the ring buffer with a single mapping.
+        /// @param[in] objects The data of the objects.
+        /// @param[out] offsets The offset of every object in the buffer, passed to bind_object().
+        ///
+        void write_objects(const std::vector<object_block_t>& objects, std::vector<GLintptr>& offsets);
+
+        ///
+        /// @brief Binds the data of one object, written by write_objects(), to OBJECT_BLOCK_BINDING.
+        /// @param[in] offset The offset of the object.
+        ///
+        void bind_object(GLintptr offset) const;
+
+        ///
+        /// @brief Points a uniform block of a program at its binding point, after checking its layout.
+        ///
+        /// The size of the block and the offsets of its members are read back
+        /// from the program and compared with the C++ struct.
+        ///
+        /// @param[in] program The linked program.
+        /// @param[in] block_name FRAME_BLOCK_NAME or OBJECT_BLOCK_NAME.
+        /// @return True if the program declares the block with the expected layout.
+        ///
+        static bool bind_block(GLuint program, const char* block_name);
+
+        static constexpr GLsizeiptr OBJECT_RING_SIZE = 1 << 20; /**< Initial size of the per-object ring in bytes. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        GLuint m_frame_buffer; /**< Buffer of the per-frame block. */
+        GLuint m_object_buffer; /**< Ring buffer of the per-object blocks. */
+        GLsizeiptr m_object_ring_size; /**< Size of the ring in bytes, grown when one write does not fit. */
+        GLintptr m_object_head; /**< Offset of the next free byte of the ring. */
+        GLintptr m_object_stride; /**< Size of one object rounded up to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_BUFFERS_HPP
+
+/* End of File */
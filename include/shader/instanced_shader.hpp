@@ -0,0 +1,98 @@
+///
+/// @file instanced_shader.hpp
+/// @author Yasin BASAR
+/// @brief Defines the InstancedShader class, which draws many instances of a model in one call.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_INSTANCED_SHADER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_INSTANCED_SHADER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include "shader.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class InstancedShader
+    /// @brief Handles the shader of instanced draws.
+    ///
+    /// Inherits from the Shader class. Instead of the model matrix uniform, the
+    /// vertex shader fetches the model and normal matrices of gl_InstanceID from
+    /// a texture buffer, so one draw call places every instance. The fragment
+    /// shader lights the diffuse and specular textures with a directional light.
+    /// The view projection matrix, the camera position and the light come from
+    /// FrameBlock, so the instances are lit like the rest of the world.
+    ///
+    class InstancedShader final : public Shader
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~InstancedShader() noexcept override = default; /**< Default destructor */
+        InstancedShader(InstancedShader &&) noexcept = default; /**< Default move constructor */
+        InstancedShader &operator=(InstancedShader &&) noexcept = default; /**< Default move assignment operator */
+        InstancedShader(const InstancedShader &) noexcept = default; /**< Default copy constructor */
+        InstancedShader &operator=(InstancedShader const &) noexcept = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructor for the InstancedShader class.
+        ///
+        /// Compiles the built-in shader sources into the shader program.
+        ///
+        explicit InstancedShader();
+
+        ///
+        /// @brief Use the shader program for rendering.
+        ///
+        /// Overrides the base class implementation to activate this shader program.
+        ///
+        void use_shader_program() override;
+
+        ///
+        /// @brief Initialize uniform variables for the shader.
+        ///
+        /// Overrides the base class implementation to point the instance
+        /// transforms at their texture unit.
+        ///
+        void init_uniforms() override;
+
+        static constexpr GLint INSTANCE_TEXTURE_UNIT = 16; /**< Unit of the instance transforms, past the units of Material. */
+        static constexpr GLint TEXELS_PER_INSTANCE = 8; /**< RGBA32F texels per instance, the model and normal matrices. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Data
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_INSTANCED_SHADER_HPP
+
+/* End of File */
@@ -69,6 +69,12 @@ namespace YB
         ///
         void init_uniforms() override;
 
+        ///
+        /// @brief Writes the light of the shader into the per-frame block.
+        /// @param[in,out] block The per-frame block being filled.
+        ///
+        void write_lights(frame_block_t& block) const override;
+
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
     ////////////////////////////////////////////////////////////////////////////
@@ -78,13 +84,6 @@ namespace YB
         glm::vec3 m_light_color; /**< Color of the light. */
         glm::vec3 m_light_position; /**< Position of the light. */
 
-        GLint m_light_dir_location; /**< Location of the light direction uniform in the shader. */
-        GLint m_light_color_location; /**< Location of the light color uniform in the shader. */
-        GLint m_light_position_location; /**< Location of the light position uniform in the shader. */
-
-        GLint m_constant; /**< Location of the constant attenuation uniform in the shader. */
-        GLint m_linear; /**< Location of the linear attenuation uniform in the shader. */
-        GLint m_quadratic; /**< Location of the quadratic attenuation uniform in the shader. */
         GLuint m_shadow_map; /**< ID of the shadow map texture. */
 
     ////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+///
+/// @file program_cache.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the ProgramCache class, which stores linked shader programs as binaries on disk.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_PROGRAM_CACHE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_PROGRAM_CACHE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+    ///
+    /// @class ProgramCache
+    /// @brief Reads and writes the program binary of a pair of shader sources.
+    ///
+    /// The binary lives in the `shader_cache` directory, in a `.ybprog` file
+    /// named after a hash of the sources and of the driver. The file also
+    /// holds the hash of the sources and the full driver string, a binary
+    /// written by another driver or for other sources is ignored and the
+    /// program is compiled again.
+    ///
+    class ProgramCache
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ProgramCache() noexcept = default; /**< Default constructor, a cache that never loads nor saves */
+        ~ProgramCache() noexcept = default; /**< Default destructor */
+        ProgramCache(ProgramCache &&) noexcept = default; /**< Default move constructor */
+        ProgramCache &operator=(ProgramCache &&) noexcept = default; /**< Default move assignment operator */
+        ProgramCache(const ProgramCache &) = default; /**< Default copy constructor */
+        ProgramCache &operator=(ProgramCache const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs the cache of a program built from the given sources.
+        /// @param[in] vertex_shader_source The source of the vertex shader.
+        /// @param[in] fragment_shader_source The source of the fragment shader.
+        ///
+        ProgramCache(const std::string& vertex_shader_source, const std::string& fragment_shader_source);
+
+        ///
+        /// @brief Loads the cached binary into a program.
+        /// @param[in] program A program without attached shaders.
+        /// @return True if the binary was accepted and the program is linked.
+        ///
+        bool load(GLuint program) const;
+
+        ///
+        /// @brief Writes the binary of a linked program to the cache file.
+        /// @param[in] program The program, linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+        /// @return True if the cache file was written.
+        ///
+        bool save(GLuint program) const;
+
+        ///
+        /// @brief Gets the path of the cache file.
+        /// @return The path of the `.ybprog` file, empty for a default constructed cache.
+        ///
+        const std::string& get_cache_path() const noexcept;
+
+        ///
+        /// @brief Checks whether the context can give program binaries back.
+        /// @return True if OpenGL 4.1 is available with at least one binary format.
+        ///
+        static bool is_supported();
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Gets the vendor, renderer and version strings of the context.
+        /// @return The strings separated by new lines.
+        ///
+        static std::string get_driver_string();
+
+        uint64_t m_source_hash = 0; /**< Hash of the vertex and fragment sources. */
+        std::string m_cache_path{}; /**< Path of the cache file. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_PROGRAM_CACHE_HPP
+
+/* End of File */
@@ -16,6 +16,9 @@
 
 #include <string>
 #include "core_components.hpp"
+#include "program_cache.hpp"
+#include "uniform_blocks.hpp"
+#include "uniform_table.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -74,18 +77,37 @@ namespace YB
         ///
         /// @brief Initializes the shader's uniform variables.
         ///
+        /// Waits for the program to be linked first, so the constructors of
+        /// several shaders can run before any of them is initialized and let
+        /// the driver compile them in parallel.
+        ///
         virtual void init_uniforms();
 
+        ///
+        /// @brief Tells whether the program was loaded from the program binary cache.
+        /// @return True if the sources were not compiled.
+        ///
+        bool is_from_program_cache() const noexcept;
+
+        ///
+        /// @brief Writes the lights of the shader into the per-frame block.
+        ///
+        /// The base implementation writes nothing, the shaders without lights
+        /// leave the light members as they are.
+        ///
+        /// @param[in,out] block The per-frame block being filled.
+        ///
+        virtual void write_lights(frame_block_t& block) const;
+
         GLuint shader_program; /**< ID of the shader program */
         glm::mat4 model_matrix; /**< Model matrix for transformations */
         glm::mat4 view_matrix; /**< View matrix for camera transformations */
         glm::mat4 projection_matrix; /**< Projection matrix for perspective calculations */
         glm::mat3 normal_matrix; /**< Normal matrix for correct normal transformations */
 
-        GLint model_matrix_location; /**< Location of the model matrix uniform */
-        GLint view_matrix_location; /**< Location of the view matrix uniform */
-        GLint projection_matrix_location; /**< Location of the projection matrix uniform */
-        GLint normal_matrix_location; /**< Location of the normal matrix uniform */
+        UniformTable uniforms; /**< Uniforms of the program, reflected by init_uniforms() and set by their name hashes */
+        bool uses_frame_block; /**< Whether the program reads view, projection and lights from FrameBlock */
+        bool uses_object_block; /**< Whether the program reads its model and normal matrices from ObjectBlock */
 
     ////////////////////////////////////////////////////////////////////////////
     // Private Members
@@ -108,11 +130,22 @@ namespace YB
         ///
         /// @brief Logs linking errors for a shader program.
         /// @param[in] shader_program_id The ID of the shader program.
+        /// @return True if the program is linked.
         ///
-        void shader_link_log(GLuint shader_program_id);
+        bool shader_link_log(GLuint shader_program_id);
+
+        ///
+        /// @brief Checks the compilation and the link issued by load_shader_sources(), and caches the binary.
+        ///
+        /// Does nothing for a program loaded from the cache or already finished.
+        ///
+        void finish_link();
 
         GLuint m_vertex_shader; /**< ID of the vertex shader */
         GLuint m_fragment_shader; /**< ID of the fragment shader */
+        ProgramCache m_program_cache; /**< Binary cache of the program, keyed by its sources */
+        bool m_link_pending; /**< Whether the link was issued but not checked yet */
+        bool m_from_program_cache; /**< Whether the program was loaded from the binary cache */
 
     ////////////////////////////////////////////////////////////////////////////
     // Protected Members
@@ -126,6 +159,19 @@ namespace YB
         ///
         void load_shader(const std::string& vertex_shader_file_name,
                          const std::string& fragment_shader_file_name);
+
+        ///
+        /// @brief Compiles vertex and fragment shader sources, and links them into a shader program.
+        ///
+        /// A program binary cached for the same sources and driver is loaded
+        /// instead when there is one. Otherwise the compilation and the link
+        /// are only issued, their results are checked by init_uniforms().
+        ///
+        /// @param[in] vertex_shader_source The source of the vertex shader.
+        /// @param[in] fragment_shader_source The source of the fragment shader.
+        ///
+        void load_shader_sources(const std::string& vertex_shader_source,
+                                 const std::string& fragment_shader_source);
     };
 
 } // namespace YB
@@ -0,0 +1,96 @@
+///
+/// @file shader_library.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the ShaderLibrary class, which builds every shader program once at start-up.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_SHADER_LIBRARY_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_SHADER_LIBRARY_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <array>
+#include <memory>
+#include "shader.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class ShaderLibrary
+    /// @brief Owns one instance of every shader the world can be drawn with.
+    ///
+    /// All programs are built by the constructor: every compilation and link
+    /// is issued before the first result is read, so a driver supporting
+    /// KHR_parallel_shader_compile builds them on its own threads at the
+    /// same time. Programs whose binary is in the ProgramCache are not
+    /// compiled at all. Switching the shader afterwards only hands out
+    /// another handle.
+    ///
+    class ShaderLibrary
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~ShaderLibrary() noexcept = default; /**< Default destructor */
+        ShaderLibrary(ShaderLibrary &&) noexcept = delete; /**< Deleted move constructor */
+        ShaderLibrary &operator=(ShaderLibrary &&) noexcept = delete; /**< Deleted move assignment operator */
+        ShaderLibrary(const ShaderLibrary &) noexcept = delete; /**< Deleted copy constructor */
+        ShaderLibrary &operator=(ShaderLibrary const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Builds and initializes every program of the library.
+        ///
+        ShaderLibrary();
+
+        ///
+        /// @brief Gets the shader of a program.
+        /// @param[in] program The handle of the program.
+        /// @return The shader, initialized and shared with the library.
+        ///
+        std::shared_ptr<Shader> get(SHADER_PROGRAM program) const;
+
+        static constexpr size_t PROGRAM_COUNT = 3; /**< Number of SHADER_PROGRAM values. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Lets the driver compile and link on its own threads when it supports it.
+        /// @return True if KHR_parallel_shader_compile or ARB_parallel_shader_compile was enabled.
+        ///
+        static bool enable_parallel_compile();
+
+        std::array<std::shared_ptr<Shader>, PROGRAM_COUNT> m_shaders; /**< Shaders, indexed by SHADER_PROGRAM. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_SHADER_LIBRARY_HPP
+
+/* End of File */
@@ -0,0 +1,204 @@
+///
+/// @file uniform_table.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the UniformTable class, which reflects the uniforms of a program and skips redundant updates.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_TABLE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_TABLE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include "hash_utils.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    constexpr uint64_t MODEL_UNIFORM = fnv1a_hash_literal("model"); ///< Model matrix.
+    constexpr uint64_t VIEW_UNIFORM = fnv1a_hash_literal("view"); ///< View matrix.
+    constexpr uint64_t PROJECTION_UNIFORM = fnv1a_hash_literal("projection"); ///< Projection matrix.
+    constexpr uint64_t NORMAL_MATRIX_UNIFORM = fnv1a_hash_literal("normalMatrix"); ///< Normal matrix.
+    constexpr uint64_t LIGHT_DIR_UNIFORM = fnv1a_hash_literal("lightDir"); ///< Direction towards the light.
+    constexpr uint64_t LIGHT_COLOR_UNIFORM = fnv1a_hash_literal("lightColor"); ///< Color of the light.
+    constexpr uint64_t LIGHT_POSITION_UNIFORM = fnv1a_hash_literal("lightPosition"); ///< Position of the light.
+    constexpr uint64_t CONSTANT_UNIFORM = fnv1a_hash_literal("constant"); ///< Constant attenuation.
+    constexpr uint64_t LINEAR_UNIFORM = fnv1a_hash_literal("linear_"); ///< Linear attenuation.
+    constexpr uint64_t QUADRATIC_UNIFORM = fnv1a_hash_literal("quadratic"); ///< Quadratic attenuation.
+    constexpr uint64_t POSITION_TRANSFORM_UNIFORM = fnv1a_hash_literal("positionTransform"); ///< Compact positions to model space.
+    constexpr uint64_t INSTANCE_TRANSFORMS_UNIFORM = fnv1a_hash_literal("instanceTransforms"); ///< Sampler of the instance transforms.
+
+    ///
+    /// @class UniformTable
+    /// @brief Holds the uniforms of a linked program, keyed by the hash of their names.
+    ///
+    /// reflect() reads the active uniforms once after the link, so the
+    /// locations are never looked up by string at draw time. The names are
+    /// hashed at compile time with fnv1a_hash_literal(), like the *_UNIFORM
+    /// constants above.
+    ///
+    /// Uniform values are program state, so the table keeps a shadow copy of
+    /// the last value sent to every uniform. The setters compare with it and
+    /// skip the GL call when nothing changed. Updates made and skipped are
+    /// counted for all tables together.
+    ///
+    /// The setters upload to the program in use, which must be the program
+    /// of the table.
+    ///
+    class UniformTable
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        UniformTable() noexcept = default; /**< Default constructor, an empty table */
+        ~UniformTable() noexcept = default; /**< Default destructor */
+        UniformTable(UniformTable &&) noexcept = default; /**< Default move constructor */
+        UniformTable &operator=(UniformTable &&) noexcept = default; /**< Default move assignment operator */
+        UniformTable(const UniformTable &) = default; /**< Default copy constructor */
+        UniformTable &operator=(UniformTable const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Fills the table with the active uniforms of a program, forgetting the shadow values.
+        ///
+        /// Members of uniform blocks have no location and are left out. Arrays
+        /// are stored under their name without the trailing "[0]".
+        ///
+        /// @param[in] program The linked program.
+        ///
+        void reflect(GLuint program);
+
+        ///
+        /// @brief Gets the location of a uniform.
+        /// @param[in] name The hash of the uniform name.
+        /// @return The location, -1 if the program has no such active uniform.
+        ///
+        GLint get_location(uint64_t name) const;
+
+        ///
+        /// @brief Sets an int or sampler uniform if its value changed.
+        /// @param[in] name The hash of the uniform name.
+        /// @param[in] value The value.
+        ///
+        void set(uint64_t name, GLint value);
+
+        ///
+        /// @brief Sets a float uniform if its value changed.
+        /// @param[in] name The hash of the uniform name.
+        /// @param[in] value The value.
+        ///
+        void set(uint64_t name, float value);
+
+        ///
+        /// @brief Sets a vec3 uniform if its value changed.
+        /// @param[in] name The hash of the uniform name.
+        /// @param[in] value The value.
+        ///
+        void set(uint64_t name, const glm::vec3& value);
+
+        ///
+        /// @brief Sets a mat3 uniform if its value changed.
+        /// @param[in] name The hash of the uniform name.
+        /// @param[in] value The value.
+        ///
+        void set(uint64_t name, const glm::mat3& value);
+
+        ///
+        /// @brief Sets a mat4 uniform if its value changed.
+        /// @param[in] name The hash of the uniform name.
+        /// @param[in] value The value.
+        ///
+        void set(uint64_t name, const glm::mat4& value);
+
+        ///
+        /// @brief Gets the updates made and skipped by all tables since reset_stats().
+        /// @return The update counters.
+        ///
+        static const uniform_stats_t& get_stats() noexcept;
+
+        ///
+        /// @brief Resets the update counters, once per frame.
+        ///
+        static void reset_stats() noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct uniform_entry_s
+        /// @brief One active uniform of the program and where its shadow value lives.
+        ///
+        typedef struct uniform_entry_s
+        {
+            uint64_t name; ///< Hash of the name.
+            GLint location; ///< Location in the program.
+            GLenum type; ///< Type reported by glGetActiveUniform.
+            uint32_t shadow_offset; ///< Offset of the shadow value in m_shadow.
+            uint32_t shadow_size; ///< Size of the shadow value, 0 for types without one.
+            bool has_value; ///< Whether the shadow holds the value in the program.
+        } uniform_entry_t;
+
+        ///
+        /// @brief Finds a uniform by the hash of its name.
+        /// @param[in] name The hash of the uniform name.
+        /// @return The index of the entry, NO_ENTRY if the program has no such active uniform.
+        ///
+        size_t find(uint64_t name) const;
+
+        ///
+        /// @brief Compares a value with the shadow of a uniform and takes it when it differs.
+        /// @param[in] name The hash of the uniform name.
+        /// @param[in] value The bytes of the new value.
+        /// @param[in] size The size of the new value.
+        /// @return The location to upload the value to, -1 if the upload is not needed.
+        ///
+        GLint update_shadow(uint64_t name, const void* value, size_t size);
+
+        ///
+        /// @brief Gets the size of the shadow value of a uniform type.
+        /// @param[in] type The type reported by glGetActiveUniform.
+        /// @return The size in bytes, 0 for the types the setters do not handle.
+        ///
+        static uint32_t get_shadow_size(GLenum type) noexcept;
+
+        std::vector<uniform_entry_t> m_entries; /**< Uniforms sorted by the hash of their names. */
+        std::vector<unsigned char> m_shadow; /**< Last value sent to every uniform. */
+
+        static uniform_stats_t stats; /**< Updates made and skipped since reset_stats(). */
+
+        static constexpr size_t NO_ENTRY = SIZE_MAX; /**< Index find() returns for unknown names. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_UNIFORM_TABLE_HPP
+
+/* End of File */
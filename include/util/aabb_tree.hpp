@@ -0,0 +1,488 @@
+///
+/// @file aabb_tree.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the AabbTree class, a dynamic bounding volume hierarchy of axis aligned boxes.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_AABB_TREE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_AABB_TREE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class AabbTree
+    /// @brief Keeps the boxes of moving objects in a balanced binary tree for culling and spatial queries.
+    ///
+    /// Every object is a leaf holding a fat box, its box grown by a margin, so
+    /// small moves do not touch the tree at all. A move that leaves the fat box
+    /// removes the leaf and inserts it again. Leaves are inserted next to the
+    /// sibling that grows the surface area of the tree the least, and the
+    /// ancestors are rebalanced with AVL rotations on the way back up, so the
+    /// tree stays O(log n) deep whatever order the objects arrive in.
+    ///
+    /// The nodes live in one array and refer to each other by index; removed
+    /// nodes go to a free list and are reused. Proxies returned by insert() stay
+    /// valid until remove().
+    ///
+    /// Frustum queries carry a mask of the planes the parent was not completely
+    /// inside of, so subtrees that are fully inside are reported without testing
+    /// their leaves.
+    ///
+    class AabbTree
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~AabbTree() noexcept = default; /**< Default destructor */
+        AabbTree(AabbTree &&) noexcept = default; /**< Default move constructor */
+        AabbTree &operator=(AabbTree &&) noexcept = default; /**< Default move assignment operator */
+        AabbTree(const AabbTree &) = default; /**< Default copy constructor */
+        AabbTree &operator=(AabbTree const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs an empty tree.
+        /// @param[in] margin Fraction of the size of a box added on every side of its fat box.
+        ///
+        explicit AabbTree(float margin = 0.1f);
+
+        ///
+        /// @brief Adds an object.
+        /// @param[in] box The box of the object.
+        /// @param[in] object The value reported for the object by the queries.
+        /// @return The proxy of the object.
+        ///
+        int32_t insert(const aabb_t& box, uint32_t object);
+
+        ///
+        /// @brief Removes an object.
+        /// @param[in] proxy The proxy returned by insert().
+        ///
+        void remove(int32_t proxy);
+
+        ///
+        /// @brief Updates the box of an object that moved.
+        ///
+        /// Nothing happens while the box stays within the fat box of the leaf
+        /// and the fat box is not much larger than needed.
+        ///
+        /// @param[in] proxy The proxy returned by insert().
+        /// @param[in] box The new box of the object.
+        /// @return True if the leaf was reinserted.
+        ///
+        bool move(int32_t proxy, const aabb_t& box);
+
+        ///
+        /// @brief Removes all objects, keeping the memory of the nodes.
+        ///
+        void clear() noexcept;
+
+        ///
+        /// @brief Gets the fat box of an object.
+        /// @param[in] proxy The proxy returned by insert().
+        /// @return The box stored in the tree, which encloses the box of the object.
+        ///
+        const aabb_t& get_fat_box(int32_t proxy) const noexcept;
+
+        ///
+        /// @brief Gets the number of objects in the tree.
+        /// @return The leaf count.
+        ///
+        size_t get_object_count() const noexcept;
+
+        ///
+        /// @brief Gets the height of the tree.
+        /// @return The number of levels below the root, 0 for a tree of one leaf or none.
+        ///
+        int32_t get_height() const noexcept;
+
+        ///
+        /// @brief Reports every object whose fat box is not completely outside a frustum.
+        /// @param[in] frustum The frustum, as returned by extract_frustum().
+        /// @param[in] visit Called with the object and whether its fat box is completely inside.
+        ///
+        template <typename Visit>
+        void query_frustum(const frustum_t& frustum, Visit&& visit) const
+        {
+            constexpr uint32_t ALL_PLANES = (1u << 6) - 1;
+
+            if (this->m_root == NULL_NODE)
+            {
+                return;
+            }
+
+            frustum_entry_t stack[MAX_STACK_DEPTH];
+            size_t stack_size = 0;
+
+            stack[stack_size++] = {this->m_root, ALL_PLANES};
+
+            while (stack_size > 0)
+            {
+                frustum_entry_t entry = stack[--stack_size];
+                const node_t& node = this->m_nodes[entry.node];
+
+                glm::vec3 center = (node.box.min + node.box.max) * 0.5f;
+                glm::vec3 extent = (node.box.max - node.box.min) * 0.5f;
+
+                uint32_t plane_mask = entry.plane_mask;
+                bool outside = false;
+
+                for (uint32_t plane = 0; plane < 6 && !outside; plane++)
+                {
+                    if ((plane_mask & (1u << plane)) == 0)
+                    {
+                        continue;
+                    }
+
+                    const glm::vec4& equation = frustum.planes[plane];
+
+                    float distance = glm::dot(glm::vec3(equation), center) + equation.w;
+                    float radius = glm::dot(glm::abs(glm::vec3(equation)), extent);
+
+                    outside = distance + radius < 0.0f;
+
+                    // a box completely in front of a plane keeps every descendant in front of it
+                    if (distance - radius >= 0.0f)
+                    {
+                        plane_mask &= ~(1u << plane);
+                    }
+                }
+
+                if (outside)
+                {
+                    continue;
+                }
+
+                if (plane_mask == 0)
+                {
+                    this->visit_subtree(entry.node, [&visit](uint32_t object) { visit(object, true); });
+                }
+                else if (node.height == 0)
+                {
+                    visit(node.object, false);
+                }
+                else
+                {
+                    stack[stack_size++] = {node.child1, plane_mask};
+                    stack[stack_size++] = {node.child2, plane_mask};
+                }
+            }
+        }
+
+        ///
+        /// @brief Reports every object whose fat box overlaps a box.
+        /// @param[in] box The box to test.
+        /// @param[in] visit Called with the object, returns false to stop the query.
+        ///
+        template <typename Visit>
+        void query_box(const aabb_t& box, Visit&& visit) const
+        {
+            if (this->m_root == NULL_NODE)
+            {
+                return;
+            }
+
+            int32_t stack[MAX_STACK_DEPTH];
+            size_t stack_size = 0;
+
+            stack[stack_size++] = this->m_root;
+
+            while (stack_size > 0)
+            {
+                const node_t& node = this->m_nodes[stack[--stack_size]];
+
+                if (!overlaps(node.box, box))
+                {
+                    continue;
+                }
+
+                if (node.height == 0)
+                {
+                    if (!visit(node.object))
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    stack[stack_size++] = node.child1;
+                    stack[stack_size++] = node.child2;
+                }
+            }
+        }
+
+        ///
+        /// @brief Reports the objects whose fat box a ray segment passes through, nearest boxes first.
+        ///
+        /// The callback returns how far the ray continues, so returning the
+        /// distance of an exact hit skips everything behind it, returning the
+        /// distance it was given keeps looking and returning 0 stops.
+        ///
+        /// @param[in] origin The start of the ray.
+        /// @param[in] direction The direction of the ray, distances are in multiples of its length.
+        /// @param[in] max_distance The end of the segment.
+        /// @param[in] visit Called with the object and the distance the ray enters its fat box.
+        ///
+        template <typename Visit>
+        void query_ray(const glm::vec3& origin, const glm::vec3& direction, float max_distance, Visit&& visit) const
+        {
+            if (this->m_root == NULL_NODE)
+            {
+                return;
+            }
+
+            glm::vec3 inverse_direction = 1.0f / direction;
+
+            ray_entry_t stack[MAX_STACK_DEPTH];
+            size_t stack_size = 0;
+
+            float root_distance = 0.0f;
+
+            if (!intersects_ray(this->m_nodes[this->m_root].box, origin, inverse_direction, max_distance, root_distance))
+            {
+                return;
+            }
+
+            stack[stack_size++] = {this->m_root, root_distance};
+
+            while (stack_size > 0)
+            {
+                ray_entry_t entry = stack[--stack_size];
+
+                // the segment may have been shortened since the node was pushed
+                if (entry.distance > max_distance)
+                {
+                    continue;
+                }
+
+                const node_t& node = this->m_nodes[entry.node];
+
+                if (node.height == 0)
+                {
+                    max_distance = visit(node.object, entry.distance);
+
+                    if (max_distance <= 0.0f)
+                    {
+                        return;
+                    }
+
+                    continue;
+                }
+
+                float distance1 = 0.0f;
+                float distance2 = 0.0f;
+
+                bool hit1 = intersects_ray(this->m_nodes[node.child1].box, origin, inverse_direction, max_distance, distance1);
+                bool hit2 = intersects_ray(this->m_nodes[node.child2].box, origin, inverse_direction, max_distance, distance2);
+
+                // the nearer child is pushed last, so it is visited first
+                if (hit1 && hit2 && distance1 < distance2)
+                {
+                    stack[stack_size++] = {node.child2, distance2};
+                    stack[stack_size++] = {node.child1, distance1};
+                }
+                else
+                {
+                    if (hit1)
+                    {
+                        stack[stack_size++] = {node.child1, distance1};
+                    }
+
+                    if (hit2)
+                    {
+                        stack[stack_size++] = {node.child2, distance2};
+                    }
+                }
+            }
+        }
+
+        static constexpr int32_t NULL_NODE = -1; /**< Index of no node. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct node_s
+        /// @brief One node of the tree, a leaf or the parent of two nodes.
+        ///
+        typedef struct node_s
+        {
+            aabb_t box; ///< Fat box of a leaf, union of the children of a parent.
+            int32_t parent; ///< Parent node, or the next free node of a free node.
+            int32_t child1; ///< First child, NULL_NODE for a leaf.
+            int32_t child2; ///< Second child, NULL_NODE for a leaf.
+            int32_t height; ///< 0 for a leaf, -1 for a free node.
+            uint32_t object; ///< Object of a leaf.
+        } node_t;
+
+        ///
+        /// @struct frustum_entry_s
+        /// @brief A node waiting for the frustum test, with the planes it still has to be tested against.
+        ///
+        typedef struct frustum_entry_s
+        {
+            int32_t node; ///< The node.
+            uint32_t plane_mask; ///< One bit per plane the parent was not completely inside of.
+        } frustum_entry_t;
+
+        ///
+        /// @struct ray_entry_s
+        /// @brief A node the ray enters, waiting to be visited.
+        ///
+        typedef struct ray_entry_s
+        {
+            int32_t node; ///< The node.
+            float distance; ///< Distance the ray enters the box of the node.
+        } ray_entry_t;
+
+        ///
+        /// @brief Checks whether two boxes overlap.
+        ///
+        static bool overlaps(const aabb_t& lhs, const aabb_t& rhs) noexcept
+        {
+            return glm::all(glm::lessThanEqual(lhs.min, rhs.max)) && glm::all(glm::lessThanEqual(rhs.min, lhs.max));
+        }
+
+        ///
+        /// @brief Intersects a ray segment with a box (slab test).
+        /// @param[out] distance The distance the ray enters the box, 0 if it starts inside.
+        /// @return True if the segment passes through the box.
+        ///
+        static bool intersects_ray(const aabb_t& box,
+                                   const glm::vec3& origin,
+                                   const glm::vec3& inverse_direction,
+                                   float max_distance,
+                                   float& distance) noexcept
+        {
+            glm::vec3 near_distances = (box.min - origin) * inverse_direction;
+            glm::vec3 far_distances = (box.max - origin) * inverse_direction;
+
+            glm::vec3 entry = glm::min(near_distances, far_distances);
+            glm::vec3 exit = glm::max(near_distances, far_distances);
+
+            float enter = glm::max(glm::max(entry.x, entry.y), glm::max(entry.z, 0.0f));
+            float leave = glm::min(glm::min(exit.x, exit.y), glm::min(exit.z, max_distance));
+
+            distance = enter;
+
+            return enter <= leave;
+        }
+
+        ///
+        /// @brief Calls a function with the object of every leaf below a node.
+        ///
+        template <typename Visit>
+        void visit_subtree(int32_t root, Visit&& visit) const
+        {
+            int32_t stack[MAX_STACK_DEPTH];
+            size_t stack_size = 0;
+
+            stack[stack_size++] = root;
+
+            while (stack_size > 0)
+            {
+                const node_t& node = this->m_nodes[stack[--stack_size]];
+
+                if (node.height == 0)
+                {
+                    visit(node.object);
+                }
+                else
+                {
+                    stack[stack_size++] = node.child1;
+                    stack[stack_size++] = node.child2;
+                }
+            }
+        }
+
+        ///
+        /// @brief Takes a node from the free list, growing the node array if it is empty.
+        /// @return The index of the node.
+        ///
+        int32_t allocate_node();
+
+        ///
+        /// @brief Returns a node to the free list.
+        /// @param[in] node The index of the node.
+        ///
+        void free_node(int32_t node);
+
+        ///
+        /// @brief Links a leaf into the tree next to the sibling that grows the surface area the least.
+        /// @param[in] leaf The index of the leaf.
+        ///
+        void insert_leaf(int32_t leaf);
+
+        ///
+        /// @brief Unlinks a leaf from the tree, its sibling takes the place of their parent.
+        /// @param[in] leaf The index of the leaf.
+        ///
+        void remove_leaf(int32_t leaf);
+
+        ///
+        /// @brief Refits and rebalances the ancestors of a node, walking up to the root.
+        /// @param[in] node The first node to refit.
+        ///
+        void refit_ancestors(int32_t node);
+
+        ///
+        /// @brief Rotates a child of a node up if the heights of its children differ by more than one.
+        /// @param[in] node The index of the node.
+        /// @return The index of the node that took the place of the given one.
+        ///
+        int32_t balance(int32_t node);
+
+        ///
+        /// @brief Grows a box by the margin of the tree.
+        /// @param[in] box The box.
+        /// @param[in] margin Fraction of the size of the box added on every side.
+        /// @return The fat box.
+        ///
+        static aabb_t fatten(const aabb_t& box, float margin) noexcept;
+
+        static constexpr size_t MAX_STACK_DEPTH = 128; /**< Stack size of the queries, AVL balancing keeps the tree far shallower. */
+
+        std::vector<node_t> m_nodes; /**< All nodes, used and free. */
+        int32_t m_root; /**< Index of the root, NULL_NODE when empty. */
+        int32_t m_free_list; /**< First free node, NULL_NODE when none. */
+        size_t m_object_count; /**< Number of leaves. */
+        float m_margin; /**< Fraction of the size of a box added on every side of its fat box. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_AABB_TREE_HPP
+
+/* End of File */
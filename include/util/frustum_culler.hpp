@@ -0,0 +1,131 @@
+///
+/// @file frustum_culler.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the FrustumCuller class, which tests bounding spheres against a frustum in batches.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_FRUSTUM_CULLER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_FRUSTUM_CULLER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class FrustumCuller
+    /// @brief Culls world space bounding spheres against a view frustum, eight at a time.
+    ///
+    /// The spheres are stored as separate arrays of center coordinates and
+    /// radii, so one AVX2 register holds the same component of eight spheres.
+    /// Each batch of eight is then tested against a plane with three multiplies
+    /// and a compare. The spheres that do not fill a batch, and every sphere
+    /// when the engine is built without AVX2, go through is_sphere_outside().
+    ///
+    class FrustumCuller
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~FrustumCuller() noexcept = default; /**< Default destructor */
+        FrustumCuller(FrustumCuller &&) noexcept = default; /**< Default move constructor */
+        FrustumCuller &operator=(FrustumCuller &&) noexcept = default; /**< Default move assignment operator */
+        FrustumCuller(const FrustumCuller &) = default; /**< Default copy constructor */
+        FrustumCuller &operator=(FrustumCuller const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a culler without spheres.
+        ///
+        FrustumCuller();
+
+        ///
+        /// @brief Removes all spheres, keeping the memory for the next frame.
+        ///
+        void clear() noexcept;
+
+        ///
+        /// @brief Adds a sphere to test.
+        /// @param[in] sphere The sphere in the space of the frustum.
+        /// @return The index of the sphere, passed to is_visible().
+        ///
+        size_t add(const bounding_sphere_t& sphere);
+
+        ///
+        /// @brief Tests all spheres against a frustum.
+        /// @param[in] frustum The frustum, as returned by extract_frustum().
+        /// @return The number of spheres completely outside the frustum.
+        ///
+        size_t cull(const frustum_t& frustum);
+
+        ///
+        /// @brief Checks whether a sphere passed the last cull() call.
+        /// @param[in] index The index returned by add().
+        /// @return True if the sphere is at least partly inside the frustum.
+        ///
+        bool is_visible(size_t index) const noexcept;
+
+        ///
+        /// @brief Gets the number of spheres added since the last clear().
+        /// @return The sphere count.
+        ///
+        size_t get_count() const noexcept;
+
+        ///
+        /// @brief Checks whether the batches are tested with AVX2.
+        /// @return True if the engine was built with AVX2 enabled.
+        ///
+        static bool is_simd_enabled() noexcept;
+
+        static constexpr size_t BATCH_SIZE = 8; /**< Spheres tested by one AVX2 pass. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @brief Tests the full batches of spheres with AVX2.
+        /// @param[in] frustum The frustum.
+        /// @return The number of spheres tested, a multiple of BATCH_SIZE.
+        ///
+        size_t cull_batches(const frustum_t& frustum);
+
+        std::vector<float> m_center_x; /**< X coordinate of the center of every sphere. */
+        std::vector<float> m_center_y; /**< Y coordinate of the center of every sphere. */
+        std::vector<float> m_center_z; /**< Z coordinate of the center of every sphere. */
+        std::vector<float> m_radius; /**< Radius of every sphere. */
+        std::vector<uint8_t> m_visible; /**< Result of the last cull() call, 1 for a visible sphere. */
+        size_t m_culled_count; /**< Spheres culled by the last cull() call. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_FRUSTUM_CULLER_HPP
+
+/* End of File */
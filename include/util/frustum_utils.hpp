@@ -0,0 +1,121 @@
+///
+/// @file frustum_utils.hpp
+/// @author Yasin BASAR
+/// @brief Defines the view frustum extraction, bounding sphere tests and bounding volume transforms.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_FRUSTUM_UTILS_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_FRUSTUM_UTILS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @brief Extracts the planes of the frustum of a view projection matrix (Gribb-Hartmann).
+    ///
+    /// The planes are normalized, so plane distances are in the space the
+    /// matrix transforms from. Passing a model view projection matrix gives
+    /// the frustum in model space.
+    ///
+    /// @param[in] matrix The view projection matrix.
+    /// @return The left, right, bottom, top, near and far planes, pointing inwards.
+    ///
+    inline frustum_t extract_frustum(const glm::mat4& matrix) noexcept
+    {
+        glm::vec4 row_x(matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0]);
+        glm::vec4 row_y(matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1]);
+        glm::vec4 row_z(matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2]);
+        glm::vec4 row_w(matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3]);
+
+        frustum_t frustum{{row_w + row_x, row_w - row_x, row_w + row_y, row_w - row_y, row_w + row_z, row_w - row_z}};
+
+        for (auto& plane: frustum.planes)
+        {
+            float length = glm::length(glm::vec3(plane));
+
+            if (length > 0.0f)
+            {
+                plane /= length;
+            }
+        }
+
+        return frustum;
+    }
+
+    ///
+    /// @brief Checks whether a sphere lies completely outside a frustum.
+    ///
+    /// @param[in] frustum The frustum, as returned by extract_frustum().
+    /// @param[in] center The center of the sphere.
+    /// @param[in] radius The radius of the sphere.
+    /// @return True if the sphere is behind one of the planes.
+    ///
+    inline bool is_sphere_outside(const frustum_t& frustum, const glm::vec3& center, float radius) noexcept
+    {
+        for (const auto& plane: frustum.planes)
+        {
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ///
+    /// @brief Moves a bounding sphere into the space a model matrix maps to.
+    ///
+    /// The radius grows with the largest scale of the matrix, so the sphere
+    /// still encloses the geometry under non-uniform scaling.
+    ///
+    /// @param[in] sphere The sphere in model space.
+    /// @param[in] matrix The model matrix.
+    /// @return The transformed sphere.
+    ///
+    inline bounding_sphere_t transform_sphere(const bounding_sphere_t& sphere, const glm::mat4& matrix) noexcept
+    {
+        float scale = glm::max(glm::length(glm::vec3(matrix[0])),
+                               glm::max(glm::length(glm::vec3(matrix[1])), glm::length(glm::vec3(matrix[2]))));
+
+        return {glm::vec3(matrix * glm::vec4(sphere.center, 1.0f)), sphere.radius * scale};
+    }
+
+    ///
+    /// @brief Computes the axis aligned box enclosing a transformed box (Arvo).
+    ///
+    /// @param[in] box The box in model space.
+    /// @param[in] matrix The model matrix.
+    /// @return The smallest axis aligned box around the eight transformed corners.
+    ///
+    inline aabb_t transform_aabb(const aabb_t& box, const glm::mat4& matrix) noexcept
+    {
+        glm::vec3 center = glm::vec3(matrix * glm::vec4((box.min + box.max) * 0.5f, 1.0f));
+        glm::vec3 extent = (box.max - box.min) * 0.5f;
+
+        glm::mat3 absolute(glm::abs(glm::vec3(matrix[0])), glm::abs(glm::vec3(matrix[1])), glm::abs(glm::vec3(matrix[2])));
+
+        glm::vec3 transformed_extent = absolute * extent;
+
+        return {center - transformed_extent, center + transformed_extent};
+    }
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_FRUSTUM_UTILS_HPP
+
+/* End of File */
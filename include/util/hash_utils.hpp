@@ -0,0 +1,103 @@
+///
+/// @file hash_utils.hpp
+/// @author Yasin BASAR
+/// @brief Defines small non-cryptographic hash functions used for cache keys.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_HASH_UTILS_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_HASH_UTILS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    constexpr uint64_t FNV1A_64_OFFSET_BASIS = 0xCBF29CE484222325ull; ///< Initial value of an FNV-1a hash.
+    constexpr uint64_t FNV1A_64_PRIME = 0x100000001B3ull; ///< Multiplier of an FNV-1a hash.
+
+    ///
+    /// @brief Hashes a block of bytes with 64 bit FNV-1a.
+    ///
+    /// @param[in] data The bytes to hash.
+    /// @param[in] size The number of bytes to hash.
+    /// @param[in] seed The running hash to continue from.
+    /// @return The updated hash.
+    ///
+    inline uint64_t fnv1a_hash(const void* data, size_t size, uint64_t seed = FNV1A_64_OFFSET_BASIS) noexcept
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        uint64_t hash = seed;
+
+        for (size_t idx = 0; idx < size; idx++)
+        {
+            hash ^= bytes[idx];
+            hash *= FNV1A_64_PRIME;
+        }
+
+        return hash;
+    }
+
+    ///
+    /// @brief Hashes a string with 64 bit FNV-1a.
+    ///
+    /// @param[in] text The string to hash.
+    /// @param[in] seed The running hash to continue from.
+    /// @return The updated hash.
+    ///
+    inline uint64_t fnv1a_hash(const std::string& text, uint64_t seed = FNV1A_64_OFFSET_BASIS) noexcept
+    {
+        return fnv1a_hash(text.data(), text.size(), seed);
+    }
+
+    ///
+    /// @brief Hashes a null terminated string with 64 bit FNV-1a, at compile time when the string is a literal.
+    ///
+    /// Gives the same result as fnv1a_hash() of the same characters.
+    ///
+    /// @param[in] text The string to hash.
+    /// @param[in] seed The running hash to continue from.
+    /// @return The updated hash.
+    ///
+    constexpr uint64_t fnv1a_hash_literal(const char* text, uint64_t seed = FNV1A_64_OFFSET_BASIS) noexcept
+    {
+        uint64_t hash = seed;
+
+        for (; *text != '\0'; text++)
+        {
+            hash ^= static_cast<unsigned char>(*text);
+            hash *= FNV1A_64_PRIME;
+        }
+
+        return hash;
+    }
+
+    ///
+    /// @brief Hashes a trivially copyable value with 64 bit FNV-1a.
+    ///
+    /// @param[in] value The value whose bytes are hashed.
+    /// @param[in] seed The running hash to continue from.
+    /// @return The updated hash.
+    ///
+    template <typename T>
+    inline uint64_t fnv1a_hash_value(const T& value, uint64_t seed = FNV1A_64_OFFSET_BASIS) noexcept
+    {
+        return fnv1a_hash(&value, sizeof(T), seed);
+    }
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_HASH_UTILS_HPP
+
+/* End of File */
@@ -0,0 +1,106 @@
+///
+/// @file mapped_file.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the MappedFile class, which maps a file read-only into memory.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_MAPPED_FILE_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_MAPPED_FILE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <string>
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class MappedFile
+    /// @brief Maps a whole file read-only into the address space of the process.
+    ///
+    /// The MappedFile class wraps mmap on POSIX systems and file mappings on Windows.
+    /// The mapping stays valid until the object is destroyed, so pointers into the
+    /// data must not outlive it.
+    ///
+    class MappedFile
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        MappedFile() noexcept = delete; /**< Deleted default constructor */
+        MappedFile(MappedFile &&) noexcept = delete; /**< Deleted move constructor */
+        MappedFile &operator=(MappedFile &&) noexcept = delete; /**< Deleted move assignment operator */
+        MappedFile(const MappedFile &) noexcept = delete; /**< Deleted copy constructor */
+        MappedFile &operator=(MappedFile const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Maps the given file into memory.
+        /// @param[in] file_path Path of the file to map.
+        ///
+        explicit MappedFile(const std::string& file_path);
+
+        ///
+        /// @brief Unmaps the file.
+        ///
+        ~MappedFile();
+
+        ///
+        /// @brief Checks whether the file could be mapped.
+        /// @return True if the file is mapped, false otherwise.
+        ///
+        bool is_open() const noexcept;
+
+        ///
+        /// @brief Gets the mapped bytes of the file.
+        /// @return Pointer to the first byte of the file, nullptr if it is not mapped.
+        ///
+        const char* data() const noexcept;
+
+        ///
+        /// @brief Gets the size of the mapped file.
+        /// @return The size of the file in bytes.
+        ///
+        size_t size() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const char* m_data; /**< First byte of the mapping. */
+        size_t m_size; /**< Size of the mapping in bytes. */
+
+#ifdef _WIN32
+        void* m_file_handle; /**< Handle of the opened file. */
+        void* m_mapping_handle; /**< Handle of the file mapping object. */
+#endif
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_MAPPED_FILE_HPP
+
+/* End of File */
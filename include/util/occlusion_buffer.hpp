@@ -0,0 +1,201 @@
+///
+/// @file occlusion_buffer.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the OcclusionBuffer class, a low resolution software depth buffer for occlusion culling.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_OCCLUSION_BUFFER_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_OCCLUSION_BUFFER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+#include "thread_pool.hpp"
+#include "types_enums.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+namespace YB
+{
+    ///
+    /// @class OcclusionBuffer
+    /// @brief Rasterizes occluders on the CPU and tests bounding boxes against their depth.
+    ///
+    /// The occluders, usually a few simplified meshes such as walls, are
+    /// clipped against the near plane and projected when they are added. The
+    /// triangles are then drawn into a small depth buffer by rasterize(). The
+    /// buffer is split into bands of rows, and each band is drawn by one task
+    /// of the thread pool, so no two threads write the same pixel. Within a
+    /// row, eight pixels are evaluated at once with AVX2.
+    ///
+    /// Every 8x8 tile also keeps the farthest depth of its pixels. A box is
+    /// tested against those tiles first, and pixels are only read for tiles
+    /// that do not hide the box on their own. The test is conservative: a box
+    /// that crosses the near plane or that is not hidden by every pixel it
+    /// covers is reported visible.
+    ///
+    class OcclusionBuffer
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ~OcclusionBuffer() noexcept = default; /**< Default destructor */
+        OcclusionBuffer(OcclusionBuffer &&) noexcept = default; /**< Default move constructor */
+        OcclusionBuffer &operator=(OcclusionBuffer &&) noexcept = default; /**< Default move assignment operator */
+        OcclusionBuffer(const OcclusionBuffer &) = default; /**< Default copy constructor */
+        OcclusionBuffer &operator=(OcclusionBuffer const &) = default; /**< Default copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Constructs a buffer of a given resolution.
+        /// @param[in] width Width in pixels, rounded up to a multiple of TILE_SIZE.
+        /// @param[in] height Height in pixels, rounded up to a multiple of TILE_SIZE.
+        ///
+        explicit OcclusionBuffer(uint32_t width = 256, uint32_t height = 128);
+
+        ///
+        /// @brief Removes the occluders of the last frame.
+        ///
+        void clear();
+
+        ///
+        /// @brief Adds the triangles of an occluder.
+        /// @param[in] vertices The positions of the occluder in model space.
+        /// @param[in] indices Three indices per triangle, both windings are drawn.
+        /// @param[in] model_view_projection The matrix from model space to clip space.
+        ///
+        void add_occluder(const std::vector<glm::vec3>& vertices,
+                          const std::vector<uint32_t>& indices,
+                          const glm::mat4& model_view_projection);
+
+        ///
+        /// @brief Resets the depth buffer to the far plane and draws the occluders added since the last clear().
+        /// @param[in] thread_pool The pool the bands are drawn on, null to draw them on the calling thread.
+        ///
+        void rasterize(ThreadPool* thread_pool);
+
+        ///
+        /// @brief Tests whether a box may be visible behind the occluders.
+        /// @param[in] box The box in world space.
+        /// @param[in] view_projection The matrix the occluders of the world were drawn with.
+        /// @return False only if every pixel the box covers is nearer than the box.
+        ///
+        bool is_box_visible(const aabb_t& box, const glm::mat4& view_projection) const;
+
+        ///
+        /// @brief Gets the depth of a pixel after rasterize().
+        /// @param[in] x The column, from the left.
+        /// @param[in] y The row, from the bottom.
+        /// @return The depth in [0, 1], 1 where no occluder was drawn.
+        ///
+        float get_depth(uint32_t x, uint32_t y) const noexcept;
+
+        ///
+        /// @brief Gets the number of triangles added since the last clear(), after clipping.
+        /// @return The triangle count.
+        ///
+        size_t get_triangle_count() const noexcept;
+
+        ///
+        /// @brief Gets the width of the buffer.
+        /// @return The width in pixels.
+        ///
+        uint32_t get_width() const noexcept;
+
+        ///
+        /// @brief Gets the height of the buffer.
+        /// @return The height in pixels.
+        ///
+        uint32_t get_height() const noexcept;
+
+        ///
+        /// @brief Checks whether the rows are rasterized with AVX2.
+        /// @return True if the engine was built with AVX2 enabled.
+        ///
+        static bool is_simd_enabled() noexcept;
+
+        static constexpr uint32_t TILE_SIZE = 8; /**< Width and height of the tiles that keep their farthest depth. */
+        static constexpr uint32_t BAND_HEIGHT = 2 * TILE_SIZE; /**< Rows drawn by one task of rasterize(). */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct triangle_s
+        /// @brief A projected triangle, set up as edge functions over the pixel centers.
+        ///
+        typedef struct triangle_s
+        {
+            glm::vec3 edge_x; ///< Change of the three edge functions per column.
+            glm::vec3 edge_y; ///< Change of the three edge functions per row.
+            glm::vec3 edge_origin; ///< Edge functions at the center of pixel (0, 0), all non negative inside.
+            glm::vec3 depth_plane; ///< Depth per column, per row and at the center of pixel (0, 0).
+            int32_t min_x; ///< First column covered by the bounds of the triangle.
+            int32_t max_x; ///< Last column covered by the bounds of the triangle.
+            int32_t min_y; ///< First row covered by the bounds of the triangle.
+            int32_t max_y; ///< Last row covered by the bounds of the triangle.
+        } triangle_t;
+
+        ///
+        /// @brief Clips a triangle against the near plane and adds the one or two triangles left.
+        /// @param[in] clip The corners of the triangle in clip space.
+        ///
+        void add_clipped_triangle(const glm::vec4 clip[3]);
+
+        ///
+        /// @brief Projects a triangle that lies in front of the near plane and sets it up.
+        /// @param[in] clip The corners of the triangle in clip space.
+        ///
+        void add_projected_triangle(const glm::vec4 clip[3]);
+
+        ///
+        /// @brief Resets a band of rows, draws the triangles into it and updates the tiles of the band.
+        /// @param[in] first_row The first row of the band.
+        /// @param[in] last_row One past the last row of the band.
+        ///
+        void rasterize_band(uint32_t first_row, uint32_t last_row);
+
+        ///
+        /// @brief Draws the part of one row of a triangle, eight pixels at a time.
+        /// @param[in] triangle The triangle.
+        /// @param[in] row The row.
+        ///
+        void rasterize_row(const triangle_t& triangle, uint32_t row);
+
+        uint32_t m_width; /**< Width of the buffer in pixels. */
+        uint32_t m_height; /**< Height of the buffer in pixels. */
+        std::vector<float> m_depth; /**< Depth of every pixel, row by row from the bottom. */
+        std::vector<float> m_tile_depth; /**< Farthest depth of every tile. */
+        std::vector<triangle_t> m_triangles; /**< Triangles added since the last clear(). */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_OCCLUSION_BUFFER_HPP
+
+/* End of File */
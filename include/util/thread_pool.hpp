@@ -0,0 +1,190 @@
+///
+/// @file thread_pool.hpp
+/// @author Yasin BASAR
+/// @brief Declaration of the ThreadPool class, which runs tasks on a fixed set of worker threads.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+#ifndef OPENGL_3D_GRAPHICS_ENGINE_THREAD_POOL_HPP
+#define OPENGL_3D_GRAPHICS_ENGINE_THREAD_POOL_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @class ThreadPool
+    /// @brief Runs submitted tasks on a fixed number of worker threads.
+    ///
+    /// Tasks are executed in submission order by whichever worker is free. A thread
+    /// that waits for a task through wait() runs queued tasks itself in the meantime,
+    /// so tasks may safely submit and wait for sub-tasks without starving the pool.
+    ///
+    /// Work the render thread waits for within a frame goes through parallel_for()
+    /// instead, which never runs a task of someone else on the calling thread.
+    ///
+    class ThreadPool
+    {
+    public:
+    ////////////////////////////////////////////////////////////////////////////
+    // Special Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ThreadPool() noexcept = delete; /**< Deleted default constructor */
+        ThreadPool(ThreadPool &&) noexcept = delete; /**< Deleted move constructor */
+        ThreadPool &operator=(ThreadPool &&) noexcept = delete; /**< Deleted move assignment operator */
+        ThreadPool(const ThreadPool &) noexcept = delete; /**< Deleted copy constructor */
+        ThreadPool &operator=(ThreadPool const &) noexcept = delete; /**< Deleted copy assignment operator */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Public Members
+    ////////////////////////////////////////////////////////////////////////////
+
+        ///
+        /// @brief Starts the worker threads.
+        /// @param[in] thread_count Number of worker threads, at least one is started.
+        ///
+        explicit ThreadPool(size_t thread_count);
+
+        ///
+        /// @brief Finishes the queued tasks and joins the worker threads.
+        ///
+        ~ThreadPool();
+
+        ///
+        /// @brief Queues a task for execution on a worker thread.
+        /// @param[in] task The callable to run.
+        /// @return A future that receives the result of the task.
+        ///
+        template <typename Task>
+        auto submit(Task&& task) -> std::future<std::invoke_result_t<std::decay_t<Task>>>
+        {
+            using result_t = std::invoke_result_t<std::decay_t<Task>>;
+
+            auto packaged_task
+                = std::make_shared<std::packaged_task<result_t()>>(std::forward<Task>(task));
+
+            std::future<result_t> result = packaged_task->get_future();
+
+            {
+                std::lock_guard lock(this->m_mutex);
+                this->m_tasks.emplace_back([packaged_task]() { (*packaged_task)(); });
+            }
+
+            this->m_condition.notify_one();
+
+            return result;
+        }
+
+        ///
+        /// @brief Blocks until a future is ready, running queued tasks while waiting.
+        /// @param[in] future The future to wait for.
+        ///
+        template <typename Future>
+        void wait(const Future& future)
+        {
+            while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                if (!this->run_pending_task())
+                {
+                    future.wait_for(std::chrono::milliseconds(1));
+                }
+            }
+        }
+
+        ///
+        /// @brief Runs a body for every index of a range on the calling thread and the free workers.
+        ///
+        /// The calling thread claims indices of the range until none are left,
+        /// then waits for those the workers claimed. Unlike wait(), it never
+        /// runs other queued tasks, so a long task such as a model load cannot
+        /// stall it. Workers still busy with such tasks leave their share to
+        /// the calling thread.
+        ///
+        /// @param[in] count The number of indices, the body receives 0 to count - 1.
+        /// @param[in] body The callable to run for every index.
+        ///
+        void parallel_for(size_t count, const std::function<void(size_t)>& body);
+
+        ///
+        /// @brief Gets the number of worker threads.
+        /// @return The number of worker threads of the pool.
+        ///
+        size_t get_thread_count() const noexcept;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Private Members
+    ////////////////////////////////////////////////////////////////////////////
+    private:
+
+        ///
+        /// @struct parallel_batch_s
+        /// @brief The shared state of one parallel_for() call, kept alive by the helper tasks that outlive it.
+        ///
+        typedef struct parallel_batch_s
+        {
+            std::function<void(size_t)> body; ///< Callable run for every index.
+            size_t count = 0; ///< Number of indices.
+            std::atomic<size_t> next{0}; ///< Next index to claim.
+            size_t finished = 0; ///< Indices whose body returned, guarded by mutex.
+            std::mutex mutex; ///< Guards finished.
+            std::condition_variable condition; ///< Wakes up the caller when the last index finished.
+        } parallel_batch_t;
+
+        ///
+        /// @brief Runs the body for the indices of a batch the calling thread claims, until none are left.
+        /// @param[in] batch The batch.
+        ///
+        static void run_batch(parallel_batch_t& batch);
+
+        ///
+        /// @brief Main loop of a worker thread.
+        ///
+        void worker_loop();
+
+        ///
+        /// @brief Runs one queued task on the calling thread.
+        /// @return True if a task was run, false if the queue was empty.
+        ///
+        bool run_pending_task();
+
+        std::vector<std::thread> m_workers; /**< Worker threads of the pool. */
+        std::deque<std::function<void()>> m_tasks; /**< Tasks waiting for a worker. */
+        std::mutex m_mutex; /**< Guards the task queue and the stop flag. */
+        std::condition_variable m_condition; /**< Wakes up workers when tasks arrive. */
+        bool m_stopping; /**< Set when the pool is being destroyed. */
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Protected Members
+    ////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Data
+
+    };
+
+} // namespace YB
+
+#endif //OPENGL_3D_GRAPHICS_ENGINE_THREAD_POOL_HPP
+
+/* End of File */
@@ -14,7 +14,12 @@
 // Project Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -39,6 +44,23 @@ namespace YB
         glm::vec2 TexCoords; ///< The texture coordinates of the vertex.
     } vertex_t;
 
+    ///
+    /// @struct compact_vertex_s
+    /// @brief Defines a quantized vertex with half the size of vertex_t.
+    ///
+    /// This structure holds the position quantized to 16 bits per axis relative
+    /// to the bounds of its mesh, the normal as signed normalized 2_10_10_10 and
+    /// the texture coordinates as half floats.
+    ///
+    typedef struct compact_vertex_s
+    {
+        uint16_t Position[4]; ///< Position within the mesh bounds, the fourth component pads to 4 bytes.
+        uint32_t Normal; ///< Normal packed as GL_INT_2_10_10_10_REV.
+        uint32_t TexCoords; ///< Texture coordinates packed as two half floats.
+    } compact_vertex_t;
+
+    static_assert(sizeof(compact_vertex_t) == sizeof(vertex_t) / 2, "compact_vertex_t must be half of vertex_t");
+
     ///
     /// @struct texture_s
     /// @brief Defines a texture with its ID, type, and path.
@@ -54,6 +76,51 @@ namespace YB
         std::string path; ///< The file path to the texture image.
     } texture_t;
 
+    ///
+    /// @struct cached_texture_s
+    /// @brief Defines a texture owned by the engine-wide texture cache.
+    ///
+    /// This structure holds the OpenGL texture ID of a texture shared between
+    /// models, together with the keys it is registered under in the cache.
+    ///
+    typedef struct cached_texture_s
+    {
+        GLuint id; ///< The OpenGL texture ID.
+        std::string path; ///< The canonical file path to the texture image.
+        uint64_t content_hash; ///< Hash of the bytes of the texture file.
+        size_t byte_size; ///< Estimated GPU memory of the texture, mipmaps included.
+    } cached_texture_t;
+
+    ///
+    /// @brief Reference-counted handle to a cached texture, the texture is freed with the last handle.
+    ///
+    typedef std::shared_ptr<const cached_texture_t> texture_handle_t;
+
+    ///
+    /// @struct texture_cache_stats_s
+    /// @brief Defines the counters of the texture cache.
+    ///
+    typedef struct texture_cache_stats_s
+    {
+        size_t hits; ///< Requests served by an already loaded texture.
+        size_t misses; ///< Requests that uploaded a new texture.
+        size_t bytes_saved; ///< GPU memory the hits did not allocate again.
+        size_t bytes_resident; ///< GPU memory of the textures currently alive.
+    } texture_cache_stats_t;
+
+    ///
+    /// @struct texture_ref_s
+    /// @brief Defines a reference to a texture file that is not loaded yet.
+    ///
+    /// This structure holds the type of a texture and the file path to the
+    /// texture image, without an OpenGL texture behind it.
+    ///
+    typedef struct texture_ref_s
+    {
+        std::string type; ///< The type of the texture (e.g., ambient, diffuse, specular).
+        std::string path; ///< The file path to the texture image.
+    } texture_ref_t;
+
     ///
     /// @struct material_s
     /// @brief Defines material properties with ambient, diffuse, and specular components.
@@ -68,6 +135,94 @@ namespace YB
         glm::vec3 specular; ///< The specular color of the material.
     } material_t;
 
+    ///
+    /// @struct aabb_s
+    /// @brief Defines an axis aligned bounding box.
+    ///
+    /// This structure holds the minimum and maximum corners of a box that
+    /// encloses a set of points.
+    ///
+    typedef struct aabb_s
+    {
+        glm::vec3 min; ///< The minimum corner of the box.
+        glm::vec3 max; ///< The maximum corner of the box.
+    } aabb_t;
+
+    ///
+    /// @struct bounding_sphere_s
+    /// @brief Defines a bounding sphere.
+    ///
+    /// This structure holds the center and radius of a sphere that encloses a
+    /// set of points.
+    ///
+    typedef struct bounding_sphere_s
+    {
+        glm::vec3 center; ///< The center of the sphere.
+        float radius; ///< The radius of the sphere.
+    } bounding_sphere_t;
+
+    ///
+    /// @struct mesh_lod_s
+    /// @brief Defines one level of detail of a mesh.
+    ///
+    /// This structure holds the range of the shared index buffer of a mesh that
+    /// draws the level, and how far the level deviates from the full mesh.
+    ///
+    typedef struct mesh_lod_s
+    {
+        uint32_t index_offset; ///< First index of the level in the index buffer.
+        uint32_t index_count; ///< Number of indices of the level.
+        float error; ///< Object space deviation from the full resolution mesh.
+        uint32_t meshlet_offset; ///< First meshlet of the level.
+        uint32_t meshlet_count; ///< Number of meshlets of the level, 0 if the level is not split.
+    } mesh_lod_t;
+
+    ///
+    /// @struct mesh_draw_s
+    /// @brief Defines what one placement of a mesh draws.
+    ///
+    /// Meshes are shared by every placement of their model, so the level
+    /// picked by the last selection, which the hysteresis starts from, and
+    /// the index ranges left after meshlet culling are kept by the placement.
+    ///
+    typedef struct mesh_draw_s
+    {
+        size_t lod = 0; ///< Level of detail picked by the last selection.
+        std::vector<GLsizei> counts; ///< Index counts of the ranges to draw.
+        std::vector<size_t> offsets; ///< Byte offsets of the ranges to draw, within the index data of the mesh.
+        size_t index_count = 0; ///< Sum of the counts.
+    } mesh_draw_t;
+
+    ///
+    /// @struct meshlet_s
+    /// @brief Defines a small cluster of connected triangles of a mesh.
+    ///
+    /// This structure holds the range of the index buffer that draws the
+    /// cluster, together with the bounding sphere and the normal cone the
+    /// cluster is culled with.
+    ///
+    typedef struct meshlet_s
+    {
+        glm::vec3 center; ///< Center of the bounding sphere in model space.
+        float radius; ///< Radius of the bounding sphere.
+        glm::vec3 cone_axis; ///< Average facing direction of the triangles.
+        float cone_cutoff; ///< Sine of the widest angle between a triangle and the axis, 1 if the cone cannot cull.
+        uint32_t index_offset; ///< First index of the cluster in the index buffer.
+        uint32_t index_count; ///< Number of indices of the cluster.
+    } meshlet_t;
+
+    ///
+    /// @struct frustum_s
+    /// @brief Defines a view frustum as six planes.
+    ///
+    /// Every plane is stored as (normal, distance) with a unit normal pointing
+    /// into the frustum, so points inside have a positive signed distance.
+    ///
+    typedef struct frustum_s
+    {
+        glm::vec4 planes[6]; ///< Left, right, bottom, top, near and far planes.
+    } frustum_t;
+
     ///
     /// @struct buffers_s
     /// @brief Defines buffer objects used in rendering.
@@ -82,6 +237,238 @@ namespace YB
         GLuint EBO; ///< The OpenGL Element Buffer Object ID.
     } buffers_t;
 
+    ///
+    /// @struct geometry_arena_stats_s
+    /// @brief Defines the memory counters of the geometry arena.
+    ///
+    /// This structure holds how much GPU memory the shared vertex and index
+    /// buffers take, how much of it meshes use and how fragmented the rest is.
+    ///
+    typedef struct geometry_arena_stats_s
+    {
+        size_t buffer_bytes; ///< Size of the vertex and index buffers of all pools.
+        size_t used_bytes; ///< Bytes of the buffers held by live meshes.
+        size_t allocation_count; ///< Number of live meshes.
+        size_t free_range_count; ///< Number of free ranges, more ranges than pools means fragmentation.
+    } geometry_arena_stats_t;
+
+    ///
+    /// @struct asset_memory_s
+    /// @brief Defines the memory held by one loaded model asset.
+    ///
+    /// Textures shared with other assets are counted in full by every asset
+    /// that uses them.
+    ///
+    typedef struct asset_memory_s
+    {
+        size_t geometry_bytes; ///< Bytes of the geometry arena held by the meshes.
+        size_t texture_bytes; ///< Estimated GPU memory of the textures used by the meshes.
+        size_t cpu_bytes; ///< Vertex, index and meshlet data kept in memory after the upload.
+    } asset_memory_t;
+
+    ///
+    /// @struct asset_record_s
+    /// @brief Defines one loaded model asset as reported by the asset manager.
+    ///
+    typedef struct asset_record_s
+    {
+        std::string path; ///< Canonical path of the model file.
+        size_t references; ///< Number of handles to the asset.
+        asset_memory_t memory; ///< Memory held by the asset.
+    } asset_record_t;
+
+    ///
+    /// @struct asset_manager_stats_s
+    /// @brief Defines the counters of the asset manager.
+    ///
+    typedef struct asset_manager_stats_s
+    {
+        size_t hits; ///< Requests served by an already loaded asset.
+        size_t misses; ///< Requests that loaded the asset.
+        size_t asset_count; ///< Number of assets currently alive.
+        size_t bytes_resident; ///< GPU memory of the geometry and textures of the assets alive.
+    } asset_manager_stats_t;
+
+    ///
+    /// @struct occlusion_query_stats_s
+    /// @brief Defines the counters of the hardware occlusion queries of one frame.
+    ///
+    /// The results are read a frame or more after their queries were issued,
+    /// so the counts of read results describe earlier frames.
+    ///
+    typedef struct occlusion_query_stats_s
+    {
+        size_t queries_issued; ///< Queries begun this frame.
+        size_t results_read; ///< Results that became available and were read this frame.
+        size_t results_pending; ///< Results that were not available yet and were left for a later frame.
+        float average_latency; ///< Average number of frames between issuing and reading the results read.
+        size_t objects_skipped; ///< Conditional draws of the read results that the GPU discarded.
+    } occlusion_query_stats_t;
+
+    ///
+    /// @struct occlusion_query_callbacks_s
+    /// @brief Defines how an occlusion query pass draws its objects.
+    ///
+    /// The objects drawn without a query around them come in one list, so they
+    /// can be sorted together. Those wrapped in a query or a conditional draw
+    /// come one per list.
+    ///
+    typedef struct occlusion_query_callbacks_s
+    {
+        std::function<void(const std::vector<uint32_t>&)> draw; ///< Draws a list of objects in one submission.
+        std::function<void()> on_program_changed; ///< Invoked once after the boxes were drawn with the program of the pass.
+    } occlusion_query_callbacks_t;
+
+    ///
+    /// @struct render_queue_stats_s
+    /// @brief Defines the state changes of the draws submitted through a render queue in one frame.
+    ///
+    typedef struct render_queue_stats_s
+    {
+        size_t packet_count; ///< Draw packets sorted.
+        size_t draw_count; ///< Draw calls made, one per packet.
+        size_t program_switches; ///< Times the program in use changed.
+        size_t texture_binds; ///< Textures bound by the materials of the packets.
+    } render_queue_stats_t;
+
+    ///
+    /// @struct uniform_stats_s
+    /// @brief Defines the uniform updates requested through the uniform tables in one frame.
+    ///
+    typedef struct uniform_stats_s
+    {
+        size_t update_count; ///< Updates sent to OpenGL.
+        size_t elided_count; ///< Updates skipped because the program already had the value.
+    } uniform_stats_t;
+
+    ///
+    /// @brief Receives the canonical path and memory of an asset when it is loaded or unloaded.
+    ///
+    typedef std::function<void(const std::string&, const asset_memory_t&, bool)> asset_memory_callback_t;
+
+    ///
+    /// @struct weld_stats_s
+    /// @brief Defines the vertex counts of a mesh before and after welding.
+    ///
+    /// This structure holds how many vertices a mesh would have with one vertex
+    /// per face corner and how many unique vertices were left after welding.
+    ///
+    typedef struct weld_stats_s
+    {
+        size_t vertices_before; ///< Number of vertices before welding (one per face corner).
+        size_t vertices_after; ///< Number of unique vertices after welding.
+    } weld_stats_t;
+
+    ///
+    /// @struct vertex_cache_stats_s
+    /// @brief Defines the result of running an index buffer through a simulated vertex cache.
+    ///
+    /// This structure holds the counts the average cache miss ratio (ACMR, misses
+    /// per triangle) and the average transformed vertex ratio (ATVR, misses per
+    /// referenced vertex) are computed from.
+    ///
+    typedef struct vertex_cache_stats_s
+    {
+        size_t triangle_count; ///< Number of triangles drawn.
+        size_t vertex_count; ///< Number of distinct vertices referenced by the triangles.
+        size_t cache_misses; ///< Number of vertex shader invocations.
+    } vertex_cache_stats_t;
+
+    ///
+    /// @enum VERTEX_FORMAT
+    /// @brief Enumeration for the layouts a mesh can be uploaded with.
+    ///
+    enum class VERTEX_FORMAT
+    {
+        FULL, ///< vertex_t with 32-bit indices.
+        COMPACT ///< compact_vertex_t with 16-bit indices when the mesh has fewer than 65536 vertices.
+    };
+
+    ///
+    /// @enum RENDER_PASS
+    /// @brief Enumeration for the passes of a render queue, drawn in this order.
+    ///
+    enum class RENDER_PASS
+    {
+        SOLID, ///< Opaque draws, front to back so the depth test rejects hidden fragments early.
+        BLENDED ///< Draws blended with what is behind them, back to front.
+    };
+
+    ///
+    /// @enum SHADER_PROGRAM
+    /// @brief Enumeration for the programs of the shader library, the handles the world is drawn with.
+    ///
+    enum class SHADER_PROGRAM
+    {
+        DIRECTIONAL_LIGHT, ///< DirectionalLightShader.
+        POINT_LIGHT, ///< PointLightShader.
+        SOLID ///< SolidShader.
+    };
+
+    ///
+    /// @enum CPU_DATA_POLICY
+    /// @brief Enumeration for what a mesh keeps in memory after its GPU buffers are filled.
+    ///
+    enum class CPU_DATA_POLICY
+    {
+        KEEP_ALL, ///< Vertices and indices of all levels stay in memory.
+        KEEP_POSITIONS, ///< Positions and the indices of the full level stay in memory, e.g. for picking.
+        RELEASE ///< Nothing stays in memory.
+    };
+
+    ///
+    /// @struct import_settings_s
+    /// @brief Defines the settings used while importing a model file.
+    ///
+    /// This structure holds the options of the import stages that run between
+    /// parsing a model file and creating its meshes.
+    ///
+    typedef struct import_settings_s
+    {
+        float weld_epsilon; ///< Epsilon for near-duplicate welding, 0 welds only identical index triples.
+        bool use_native_obj_parser; ///< Parse .obj files with the multi-threaded ObjParser instead of tinyobj.
+        bool optimize_meshes; ///< Reorder triangles and vertices of every mesh with the MeshOptimizer.
+        bool generate_lods; ///< Build simplified levels of detail of every mesh with the MeshSimplifier.
+        bool build_meshlets; ///< Split every level of detail into meshlets with the MeshletBuilder.
+        VERTEX_FORMAT vertex_format; ///< Layout the meshes are uploaded with.
+        CPU_DATA_POLICY cpu_data_policy; ///< What the meshes keep in memory after the upload.
+    } import_settings_t;
+
+    ///
+    /// @struct lod_settings_s
+    /// @brief Defines how the level of detail of a mesh is picked at draw time.
+    ///
+    typedef struct lod_settings_s
+    {
+        float pixel_error; ///< Largest projected error in pixels a level may have, 0 always draws the full mesh.
+        float hysteresis; ///< Fraction of pixel_error the projected error must move past before the level changes.
+    } lod_settings_t;
+
+    ///
+    /// @struct model_load_callbacks_s
+    /// @brief Defines the callbacks of an asynchronous model load.
+    ///
+    /// Both callbacks are invoked on the render thread and may be left empty.
+    ///
+    typedef struct model_load_callbacks_s
+    {
+        std::function<void(const std::string&, float)> on_progress; ///< Receives the model name and the progress in [0, 1].
+        std::function<void(const std::string&, bool)> on_complete; ///< Receives the model name and whether the load succeeded.
+    } model_load_callbacks_t;
+
+    ///
+    /// @enum LOAD_STATE
+    /// @brief Enumeration for the states of an asynchronous model load.
+    ///
+    enum class LOAD_STATE
+    {
+        QUEUED, ///< Waiting for a worker thread.
+        LOADING, ///< Parsing the model and decoding its textures.
+        READY, ///< Waiting for the upload on the render thread.
+        UPLOADED, ///< The model has been added to the world.
+        FAILED ///< The model could not be read.
+    };
+
     ///
     /// @enum MOVE_DIRECTION
     /// @brief Enumeration for movement directions.
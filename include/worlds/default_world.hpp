@@ -15,9 +15,20 @@
 // Project Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <memory>
 #include <vector>
 #include "world.hpp"
-#include "model_3d.hpp"
+#include "aabb_tree.hpp"
+#include "asset_manager.hpp"
+#include "model_load_request.hpp"
+#include "box_mesh.hpp"
+#include "frustum_culler.hpp"
+#include "indirect_draw_pass.hpp"
+#include "instanced_model.hpp"
+#include "instanced_shader.hpp"
+#include "occlusion_buffer.hpp"
+#include "occlusion_query_pass.hpp"
+#include "render_queue.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -54,8 +65,8 @@ namespace YB
         ///
         /// @brief Adds a 3D model to the world.
         ///
-        /// This function creates a new 3D model and adds it to the collection
-        /// of models in the world.
+        /// This function places a 3D model in the world. The model is taken from
+        /// the asset manager, so a file placed several times is loaded once.
         ///
         /// @param file_name[in] The file name of the model.
         /// @param model_name[in] The name of the model.
@@ -69,19 +80,191 @@ namespace YB
                        bool rotatable,
                        bool scalable) override;
 
+        ///
+        /// @brief Starts loading a 3D model on a worker thread.
+        ///
+        /// The model is parsed and its textures are decoded on the thread pool.
+        /// Until it is ready, its bounding box is drawn as a wireframe placeholder
+        /// once known; the upload then happens in render_models().
+        ///
+        /// @param file_name[in] The file name of the model.
+        /// @param model_name[in] The name of the model.
+        /// @param position[in] The position of the model in the world.
+        /// @param rotatable[in] Whether the model can be rotated.
+        /// @param scalable[in] Whether the model can be scaled.
+        /// @param callbacks[in] Progress and completion callbacks, invoked on the render thread.
+        /// @return The handle of the load.
+        ///
+        std::shared_ptr<ModelLoadRequest> add_model_async(const std::string& file_name,
+                                                          const std::string& model_name,
+                                                          const glm::vec3& position,
+                                                          bool rotatable,
+                                                          bool scalable,
+                                                          const model_load_callbacks_t& callbacks) override;
+
+        ///
+        /// @brief Loads a 3D model whose placements are drawn with instancing.
+        ///
+        /// A file that is already loaded for instancing is not loaded again,
+        /// its handle is returned instead. The meshes are shared with the
+        /// placements of add_model() through the asset manager.
+        ///
+        /// @param file_name[in] The file name of the model.
+        /// @param model_name[in] The name of the model.
+        /// @return The handle of the model, passed to add_model_instance().
+        ///
+        size_t add_instanced_model(const std::string& file_name, const std::string& model_name) override;
+
+        ///
+        /// @brief Places an instance of a model loaded with add_instanced_model().
+        /// @param model[in] The handle returned by add_instanced_model().
+        /// @param transform[in] The model matrix of the instance.
+        /// @return The index of the instance within the model.
+        ///
+        size_t add_model_instance(size_t model, const glm::mat4& transform) override;
+
+        ///
+        /// @brief Adds an occluder, a simplified mesh that hides the models behind it.
+        ///
+        /// The occluders are drawn into a software depth buffer every frame,
+        /// so they should be a few hundred triangles at most and must not
+        /// reach outside the models they stand for.
+        ///
+        /// @param vertices[in] The positions of the occluder in model space.
+        /// @param indices[in] Three indices per triangle.
+        /// @param transform[in] The model matrix of the occluder.
+        ///
+        void add_occluder(const std::vector<glm::vec3>& vertices,
+                          const std::vector<uint32_t>& indices,
+                          const glm::mat4& transform) override;
+
         ///
         /// @brief Renders all models in the world.
         ///
         /// This function iterates through all 3D models and applies the current
-        /// transformations before drawing them.
+        /// transformations before drawing them. The world boxes of the models
+        /// are kept in an AabbTree, which is walked against the view frustum
+        /// first. Subtrees completely inside are drawn without further tests,
+        /// the bounding spheres of the models on the border are culled eight at
+        /// a time with AVX2, and the models outside are skipped. When occluders
+        /// were added, they are then drawn into a software depth buffer on the
+        /// thread pool, and the models whose boxes are hidden behind them are
+        /// skipped as well. The rest go through an OcclusionQueryPass, which
+        /// draws the models seen in the last frames first and lets the GPU skip
+        /// the others when their boxes are hidden. Every mesh is drawn at the
+        /// coarsest level of detail whose projected error stays within the
+        /// level of detail settings, without the meshlets that are outside the
+        /// view frustum or face away from the camera. The meshes go through a
+        /// RenderQueue, which sorts them by program, textures and vertex array,
+        /// and front to back within those.
+        ///
+        /// When GPU-driven rendering is turned on, the context supports it and
+        /// the directional light shader is selected, the models are culled and
+        /// drawn by an IndirectDrawPass instead, which culls whole meshes and
+        /// picks their levels on the GPU.
+        ///
+        /// The instanced models follow, one instanced draw per mesh for all of
+        /// the visible instances of a model.
         ///
         void render_models() override;
 
+        ///
+        /// @brief Sets how the level of detail of the models is picked.
+        /// @param settings[in] The error threshold in pixels and the hysteresis band.
+        ///
+        void set_lod_settings(const lod_settings_t& settings) noexcept;
+
+        ///
+        /// @brief Turns the culling of meshlets on or off.
+        /// @param enabled[in] Whether invisible meshlets are skipped.
+        ///
+        void set_meshlet_culling(bool enabled) noexcept;
+
+        ///
+        /// @brief Turns the culling of the models hidden behind the occluders on or off.
+        /// @param enabled[in] Whether hidden models are skipped.
+        ///
+        void set_occlusion_culling(bool enabled) noexcept;
+
+        ///
+        /// @brief Turns the hardware occlusion queries of the models drawn from the CPU on or off.
+        /// @param enabled[in] Whether the models are drawn through the occlusion query pass when supported.
+        ///
+        void set_occlusion_queries(bool enabled) noexcept;
+
+        ///
+        /// @brief Turns GPU-driven rendering on or off, off by default.
+        ///
+        /// Has no effect when the context does not support it, the models are
+        /// then always drawn from the CPU. The indirect draw pass only shades
+        /// like the directional light shader, the models are drawn from the
+        /// CPU as well while another shader is selected.
+        ///
+        /// @param enabled[in] Whether the models are culled and drawn with indirect commands.
+        ///
+        void set_gpu_driven(bool enabled) noexcept;
+
+        ///
+        /// @brief Gets the number of triangles drawn by the last render_models() call.
+        /// @return The triangle count of the selected levels of all models.
+        ///
+        size_t get_triangle_count() const noexcept;
+
+        ///
+        /// @brief Gets the number of objects culled on the CPU by the last render_models() call.
+        ///
+        /// Counts the models and the instances outside the view frustum. The
+        /// indirect draw pass culls on the GPU, its models are not counted.
+        ///
+        /// @return The culled model and instance count.
+        ///
+        size_t get_culled_count() const noexcept;
+
+        ///
+        /// @brief Gets the number of models hidden by the occluders in the last render_models() call.
+        ///
+        /// Only the models drawn from the CPU are tested against the occluders.
+        ///
+        /// @return The occluded model count.
+        ///
+        size_t get_occluded_count() const noexcept;
+
+        ///
+        /// @brief Gets the counters of the occlusion queries of the last render_models() call.
+        ///
+        /// The GPU decides whether a conditional draw happens, so the skipped
+        /// models are only known when the query results are read, one frame or
+        /// more later. Their triangles are still part of get_triangle_count().
+        ///
+        /// @return The query counters, all zero when the queries are not used.
+        ///
+        occlusion_query_stats_t get_occlusion_query_stats() const noexcept;
+
+        ///
+        /// @brief Gets the draw calls and state changes of the models drawn from the CPU in the last render_models() call.
+        ///
+        /// With the occlusion queries, every model is submitted on its own, so
+        /// only its meshes are sorted together.
+        ///
+        /// @return The render queue counters.
+        ///
+        const render_queue_stats_t& get_render_queue_stats() const noexcept;
+
+        ///
+        /// @brief Gets the uniform updates of the last render_models() call.
+        ///
+        /// Updates setting a uniform to the value its program already has
+        /// are skipped and counted as elided.
+        ///
+        /// @return The uniform update counters.
+        ///
+        const uniform_stats_t& get_uniform_stats() const noexcept;
+
         ///
         /// @brief Increases the rotation angle for the models.
         ///
         /// This function updates the rotation angle applied to all models
-        /// in the world.
+        /// in the world and refits the boxes of the rotatable ones.
         ///
         /// @param value[in] The amount by which to increase the rotation angle.
         ///
@@ -91,7 +274,7 @@ namespace YB
         /// @brief Increases the scale factor for the models.
         ///
         /// This function updates the scale factor applied to all models
-        /// in the world.
+        /// in the world and refits the boxes of the scalable ones.
         ///
         /// @param value[in] The amount by which to increase the scale factor.
         ///
@@ -102,7 +285,158 @@ namespace YB
     ////////////////////////////////////////////////////////////////////////////
     private:
 
-        std::vector<Model3D> m_objs; ///< List of 3D models in the world.
+        ///
+        /// @struct model_placement_s
+        /// @brief One placement of a model in the world.
+        ///
+        typedef struct model_placement_s
+        {
+            model_handle_t model; ///< The model, shared with the other placements of its file.
+            std::string name; ///< Name of the placement.
+            glm::vec3 position; ///< The position of the model in world coordinates.
+            bool rotatable; ///< Flag indicating if the model can be rotated.
+            bool scalable; ///< Flag indicating if the model can be scaled.
+            int32_t proxy; ///< Leaf of the placement in the bounding volume tree.
+            std::vector<mesh_draw_t> draws; ///< Level of detail and ranges of every mesh, kept between frames for the hysteresis.
+        } model_placement_t;
+
+        ///
+        /// @struct occluder_s
+        /// @brief A simplified mesh drawn into the occlusion buffer.
+        ///
+        typedef struct occluder_s
+        {
+            std::vector<glm::vec3> vertices; ///< Positions in model space.
+            std::vector<uint32_t> indices; ///< Three indices per triangle.
+            glm::mat4 transform; ///< The model matrix.
+        } occluder_t;
+
+        ///
+        /// @brief Places a model in the world and inserts its world box into the bounding volume tree.
+        /// @param model[in] The model.
+        /// @param model_name[in] The name of the placement.
+        /// @param position[in] The position of the model in the world.
+        /// @param rotatable[in] Whether the model can be rotated.
+        /// @param scalable[in] Whether the model can be scaled.
+        ///
+        void add_placement(model_handle_t model,
+                           const std::string& model_name,
+                           const glm::vec3& position,
+                           bool rotatable,
+                           bool scalable);
+
+        ///
+        /// @brief Recomputes the model matrices of the placements that rotate or scale and moves their boxes.
+        ///
+        void refit_placements();
+
+        ///
+        /// @brief Uploads the finished asynchronous loads and reports their progress.
+        ///
+        void update_pending_models();
+
+        ///
+        /// @brief Culls and draws the models from the CPU, one model after the other.
+        ///
+        void render_models_direct();
+
+        ///
+        /// @brief Draws the occluders and removes the placements hidden behind them from the visible ones.
+        /// @param view_projection[in] The view projection matrix of the frame.
+        ///
+        void cull_occluded(const glm::mat4& view_projection);
+
+        ///
+        /// @brief Adds the meshes of one placement to the render queue, at their level of detail and without their hidden meshlets.
+        /// @param idx[in] The index of the placement.
+        ///
+        void draw_placement(uint32_t idx);
+
+        ///
+        /// @brief Culls and draws the models on the GPU with the indirect draw pass.
+        ///
+        void render_models_indirect();
+
+        ///
+        /// @brief Culls the instances of the instanced models and draws the visible ones.
+        ///
+        void render_instanced_models();
+
+        ///
+        /// @brief Creates the indirect draw pass on first use.
+        /// @return True if the pass is ready, false if the context cannot run it.
+        ///
+        bool create_indirect_pass();
+
+        ///
+        /// @brief Creates the occlusion query pass on first use.
+        /// @return True if the pass is ready, false if the context cannot run it.
+        ///
+        bool create_query_pass();
+
+        ///
+        /// @brief Draws the bounding boxes of the pending loads whose bounds are known.
+        ///
+        void render_placeholders();
+
+        ///
+        /// @brief Computes the model matrix of a model from its placement flags.
+        /// @param position[in] The position of the model in the world.
+        /// @param rotatable[in] Whether the model is rotated.
+        /// @param scalable[in] Whether the model is scaled.
+        /// @return The model matrix.
+        ///
+        glm::mat4 compute_model_matrix(const glm::vec3& position, bool rotatable, bool scalable) const;
+
+        ///
+        /// @brief Computes how many pixels one model space unit covers at the distance of a model.
+        /// @param bounds[in] The model space bounds of the model.
+        /// @param model_matrix[in] The model matrix of the model.
+        /// @return The size of one model space unit in pixels at the closest point of the bounds.
+        ///
+        static float compute_pixels_per_unit(const aabb_t& bounds, const glm::mat4& model_matrix);
+
+        ///
+        /// @brief Sends the model, normal and view matrices of the shader to the GPU.
+        ///
+        /// Programs declaring ObjectBlock get the matrices through the object
+        /// ring buffer, the others through uniforms.
+        ///
+        /// @param draw_matrix[in] The model matrix to draw with, the normal matrix comes from the one of the shader.
+        ///
+        static void upload_matrices(const glm::mat4& draw_matrix);
+
+        ///
+        /// @brief Fills the per-frame uniform block with the camera and the lights of the shader.
+        ///
+        static void update_frame_block();
+
+        std::vector<model_placement_t> m_objs; ///< List of 3D models in the world.
+        std::vector<std::shared_ptr<ModelLoadRequest>> m_pending_models; ///< Loads that are not uploaded yet.
+        std::shared_ptr<BoxMesh> m_placeholder_box; ///< Unit cube drawn for the pending loads.
+        lod_settings_t m_lod_settings{1.0f, 0.2f}; ///< Level of detail selection settings.
+        bool m_meshlet_culling = true; ///< Whether invisible meshlets are skipped.
+        bool m_gpu_driven = false; ///< Whether the models are drawn by the indirect draw pass when supported.
+        std::shared_ptr<IndirectDrawPass> m_indirect_pass; ///< GPU culling and indirect draws, created on first use.
+        std::vector<model_handle_t> m_models; ///< Models handed to the indirect draw pass, one per placement.
+        std::vector<glm::mat4> m_model_matrices; ///< Model matrix of every placement, updated when it moves.
+        AabbTree m_tree; ///< World boxes of the placements, walked against the view frustum.
+        std::vector<uint32_t> m_visible_objs; ///< Placements that passed the culling of the frame.
+        std::vector<uint32_t> m_border_objs; ///< Placements whose boxes cross the frustum, tested by m_culler.
+        FrustumCuller m_culler; ///< Culls the bounding spheres of the placements on the border of the frustum.
+        std::vector<occluder_t> m_occluders; ///< Meshes that hide the placements behind them.
+        OcclusionBuffer m_occlusion_buffer; ///< Depth of the occluders, drawn each frame.
+        bool m_occlusion_culling = true; ///< Whether the placements hidden behind the occluders are skipped.
+        bool m_occlusion_queries = true; ///< Whether the placements are drawn through the occlusion query pass when supported.
+        std::shared_ptr<OcclusionQueryPass> m_query_pass; ///< Hardware occlusion queries, created on first use.
+        std::vector<aabb_t> m_query_boxes; ///< Boxes of the visible placements handed to the query pass.
+        RenderQueue m_render_queue; ///< Sorts the meshes of the placements drawn from the CPU by state.
+        std::vector<std::shared_ptr<InstancedModel>> m_instanced_models; ///< Models drawn with instancing.
+        std::shared_ptr<InstancedShader> m_instanced_shader; ///< Shader of the instanced models, created on first use.
+        size_t m_triangle_count = 0; ///< Triangles drawn by the last render_models() call.
+        size_t m_culled_count = 0; ///< Objects culled on the CPU by the last render_models() call.
+        size_t m_occluded_count = 0; ///< Placements hidden by the occluders in the last render_models() call.
+        uniform_stats_t m_uniform_stats{0, 0}; ///< Uniform updates made and skipped by the last render_models() call.
 
     ////////////////////////////////////////////////////////////////////////////
     // Protected Members
@@ -15,7 +15,11 @@
 // Project Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
+#include "model_load_request.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -75,6 +79,65 @@ namespace YB
                                bool rotatable,
                                bool scalable);
 
+        ///
+        /// @brief Starts loading a 3D model on a worker thread.
+        ///
+        /// This function is intended to be overridden by derived classes to
+        /// add a 3D model to the world once it has been loaded.
+        ///
+        /// @param file_name[in] The file name of the model.
+        /// @param model_name[in] The name of the model.
+        /// @param position[in] The position of the model in the world.
+        /// @param rotatable[in] Whether the model can be rotated.
+        /// @param scalable[in] Whether the model can be scaled.
+        /// @param callbacks[in] Progress and completion callbacks, invoked on the render thread.
+        /// @return The handle of the load, null if asynchronous loading is not supported.
+        ///
+        virtual std::shared_ptr<ModelLoadRequest> add_model_async(const std::string& file_name,
+                                                                  const std::string& model_name,
+                                                                  const glm::vec3& position,
+                                                                  bool rotatable,
+                                                                  bool scalable,
+                                                                  const model_load_callbacks_t& callbacks);
+
+        ///
+        /// @brief Loads a 3D model whose placements are drawn with instancing.
+        ///
+        /// This function is intended to be overridden by derived classes to
+        /// load a model once and draw all of its instances together.
+        ///
+        /// @param file_name[in] The file name of the model.
+        /// @param model_name[in] The name of the model.
+        /// @return The handle of the model, passed to add_model_instance().
+        ///
+        virtual size_t add_instanced_model(const std::string& file_name, const std::string& model_name);
+
+        ///
+        /// @brief Places an instance of a model loaded with add_instanced_model().
+        ///
+        /// This function is intended to be overridden by derived classes to
+        /// add one more placement of an instanced model.
+        ///
+        /// @param model[in] The handle returned by add_instanced_model().
+        /// @param transform[in] The model matrix of the instance.
+        /// @return The index of the instance within the model.
+        ///
+        virtual size_t add_model_instance(size_t model, const glm::mat4& transform);
+
+        ///
+        /// @brief Adds an occluder, a simplified mesh that hides the models behind it.
+        ///
+        /// This function is intended to be overridden by derived classes to
+        /// cull the models that are hidden behind large objects such as walls.
+        ///
+        /// @param vertices[in] The positions of the occluder in model space.
+        /// @param indices[in] Three indices per triangle.
+        /// @param transform[in] The model matrix of the occluder.
+        ///
+        virtual void add_occluder(const std::vector<glm::vec3>& vertices,
+                                  const std::vector<uint32_t>& indices,
+                                  const glm::mat4& transform);
+
         ///
         /// @brief Renders all models in the world.
         ///
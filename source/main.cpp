@@ -7,11 +7,19 @@
  * @copyright (c) 2024 All rights reserved.
  */
 
+#include <algorithm>
+#include <thread>
 #include "renderer.hpp"
 #include "window_callbacks.hpp"
 
 int main()
 {
+    // the main thread also works while it waits, so leave one core for it
+    size_t worker_count = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+    YB::CoreComponents::thread_pool
+        = std::make_shared<YB::ThreadPool>(worker_count);
+
     YB::CoreComponents::window
         = std::make_shared<YB::Window>("OpenGL_3D_Graphics_Engine",
                                        1280,
@@ -0,0 +1,270 @@
+///
+/// @file asset_manager.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the AssetManager class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include "asset_manager.hpp"
+#include "texture_cache.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr float IMPORT_PROGRESS = 0.5f; ///< Share of the progress taken by the mesh import.
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    AssetManager::AssetManager()
+        : m_registry{std::make_shared<registry_t>()}
+    {
+        this->m_registry->stats = {0, 0, 0, 0};
+    }
+
+    model_import_t AssetManager::import(const std::string& file_path,
+                                        const std::function<void(const aabb_t&, float)>& on_progress)
+    {
+        std::string canonical_path = canonicalize(file_path);
+        std::promise<std::shared_ptr<model_data_t>> promise{};
+        model_import_t pending{};
+
+        {
+            std::lock_guard lock(this->m_registry->mutex);
+
+            asset_entry_t& entry = this->m_registry->assets[canonical_path];
+
+            if (!entry.model.expired())
+            {
+                return {};
+            }
+
+            if (entry.import.valid())
+            {
+                return entry.import;
+            }
+
+            pending = promise.get_future().share();
+            entry.import = pending;
+        }
+
+        std::shared_ptr<model_data_t> model_data{};
+
+        try
+        {
+            model_data = Model3D::import_model(file_path);
+
+            if (model_data)
+            {
+                if (on_progress)
+                {
+                    on_progress(model_data->bounds, IMPORT_PROGRESS);
+                }
+
+                // the decodes run in parallel, this thread helps out while it waits for them
+                Model3D::decode_textures(*model_data);
+
+                const size_t image_count = model_data->images.size();
+
+                for (size_t idx = 0; idx < image_count; idx++)
+                {
+                    TextureLoader::wait(model_data->images[idx]);
+
+                    if (on_progress)
+                    {
+                        on_progress(model_data->bounds,
+                                    IMPORT_PROGRESS + (1.0f - IMPORT_PROGRESS)
+                                        * static_cast<float>(idx + 1) / static_cast<float>(image_count));
+                    }
+                }
+            }
+        }
+        catch (const std::exception& exception)
+        {
+            std::cerr << "ERROR: import of " << canonical_path << " failed: " << exception.what() << "\n";
+            model_data = nullptr;
+        }
+
+        if (!model_data)
+        {
+            // a failed import is not kept, the next request reads the file again
+            std::lock_guard lock(this->m_registry->mutex);
+
+            auto asset = this->m_registry->assets.find(canonical_path);
+
+            if (asset != this->m_registry->assets.end() && asset->second.model.expired())
+            {
+                this->m_registry->assets.erase(asset);
+            }
+        }
+
+        // set even if the import failed, so that no request joining it waits forever
+        promise.set_value(model_data);
+
+        return pending;
+    }
+
+    model_handle_t AssetManager::acquire(const std::string& file_path)
+    {
+        std::string canonical_path = canonicalize(file_path);
+
+        {
+            std::lock_guard lock(this->m_registry->mutex);
+
+            auto asset = this->m_registry->assets.find(canonical_path);
+
+            if (asset != this->m_registry->assets.end())
+            {
+                if (model_handle_t model = asset->second.model.lock())
+                {
+                    this->m_registry->stats.hits++;
+                    return model;
+                }
+            }
+        }
+
+        // only this thread registers models, so the import cannot find the model loaded now
+        model_import_t pending = this->import(file_path, nullptr);
+        std::shared_ptr<model_data_t> model_data = pending.valid() ? pending.get() : nullptr;
+
+        if (!model_data)
+        {
+            std::cerr << "ERROR: could not load model " << canonical_path << "\n";
+            return nullptr;
+        }
+
+        return this->register_model(canonical_path, *model_data);
+    }
+
+    void AssetManager::set_memory_callback(const asset_memory_callback_t& on_memory)
+    {
+        std::lock_guard lock(this->m_registry->mutex);
+
+        this->m_registry->on_memory = on_memory;
+    }
+
+    std::vector<asset_record_t> AssetManager::get_records() const
+    {
+        std::lock_guard lock(this->m_registry->mutex);
+
+        std::vector<asset_record_t> records{};
+
+        for (const auto& [path, entry]: this->m_registry->assets)
+        {
+            auto references = static_cast<size_t>(entry.model.use_count());
+
+            if (references > 0)
+            {
+                records.push_back({path, references, entry.memory});
+            }
+        }
+
+        return records;
+    }
+
+    asset_manager_stats_t AssetManager::get_stats() const
+    {
+        std::lock_guard lock(this->m_registry->mutex);
+
+        return this->m_registry->stats;
+    }
+
+    std::string AssetManager::canonicalize(const std::string& path)
+    {
+        std::string file_path = path;
+        std::replace(file_path.begin(), file_path.end(), '\\', '/');
+
+        return TextureCache::canonicalize(file_path);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    model_handle_t AssetManager::register_model(const std::string& canonical_path, model_data_t& model_data)
+    {
+        auto* model = new Model3D(model_data);
+        asset_memory_t memory = model->get_memory_usage();
+
+        std::weak_ptr<registry_t> registry = this->m_registry;
+
+        model_handle_t handle(model, [registry, canonical_path, memory](const Model3D* released)
+        {
+            delete released;
+
+            if (std::shared_ptr<registry_t> owner = registry.lock())
+            {
+                asset_memory_callback_t on_memory{};
+
+                {
+                    std::lock_guard lock(owner->mutex);
+
+                    owner->stats.asset_count--;
+                    owner->stats.bytes_resident -= memory.geometry_bytes + memory.texture_bytes;
+
+                    auto asset = owner->assets.find(canonical_path);
+
+                    if (asset != owner->assets.end() && asset->second.model.expired() && !asset->second.import.valid())
+                    {
+                        owner->assets.erase(asset);
+                    }
+
+                    on_memory = owner->on_memory;
+                }
+
+                if (on_memory)
+                {
+                    on_memory(canonical_path, memory, false);
+                }
+            }
+        });
+
+        asset_memory_callback_t on_memory{};
+
+        {
+            std::lock_guard lock(this->m_registry->mutex);
+
+            asset_entry_t& entry = this->m_registry->assets[canonical_path];
+            entry.model = handle;
+            entry.import = {};
+            entry.memory = memory;
+
+            this->m_registry->stats.misses++;
+            this->m_registry->stats.asset_count++;
+            this->m_registry->stats.bytes_resident += memory.geometry_bytes + memory.texture_bytes;
+
+            on_memory = this->m_registry->on_memory;
+        }
+
+        if (on_memory)
+        {
+            on_memory(canonical_path, memory, true);
+        }
+
+        return handle;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
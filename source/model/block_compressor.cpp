@@ -0,0 +1,403 @@
+///
+/// @file block_compressor.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the BlockCompressor class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include "block_compressor.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr int BLOCK_SIZE = 4; ///< Blocks cover 4x4 pixels.
+    constexpr int BLOCK_PIXELS = BLOCK_SIZE * BLOCK_SIZE; ///< Pixels of a block.
+
+    ///
+    /// @brief Builds the table that turns an sRGB byte into a linear value.
+    ///
+    static std::array<float, 256> build_srgb_to_linear_table()
+    {
+        std::array<float, 256> table{};
+
+        for (int idx = 0; idx < 256; idx++)
+        {
+            float value = static_cast<float>(idx) / 255.0f;
+
+            table[idx] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        return table;
+    }
+
+    ///
+    /// @brief Turns a linear value into an sRGB byte.
+    ///
+    static unsigned char linear_to_srgb(float value)
+    {
+        value = std::clamp(value, 0.0f, 1.0f);
+        value = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+
+        return static_cast<unsigned char>(std::lround(value * 255.0f));
+    }
+
+    ///
+    /// @brief Quantizes a color to the 5:6:5 endpoint format.
+    ///
+    static uint16_t pack_565(const float* color)
+    {
+        auto quantize = [](float value, int max)
+        {
+            return static_cast<uint16_t>(std::clamp(std::lround(value * max / 255.0f), 0l, static_cast<long>(max)));
+        };
+
+        return static_cast<uint16_t>((quantize(color[0], 31) << 11) | (quantize(color[1], 63) << 5) | quantize(color[2], 31));
+    }
+
+    ///
+    /// @brief Expands a 5:6:5 endpoint the way the GPU does.
+    ///
+    static void unpack_565(uint16_t packed, float* color)
+    {
+        int red = (packed >> 11) & 31;
+        int green = (packed >> 5) & 63;
+        int blue = packed & 31;
+
+        color[0] = static_cast<float>((red << 3) | (red >> 2));
+        color[1] = static_cast<float>((green << 2) | (green >> 4));
+        color[2] = static_cast<float>((blue << 3) | (blue >> 2));
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<rgba_image_t> BlockCompressor::build_mip_chain(const rgba_image_t& base_level)
+    {
+        static const std::array<float, 256> srgb_to_linear = build_srgb_to_linear_table();
+
+        std::vector<rgba_image_t> levels{base_level};
+
+        while (levels.back().width > 1 || levels.back().height > 1)
+        {
+            const rgba_image_t& source = levels.back();
+
+            rgba_image_t level{};
+            level.width = std::max(source.width / 2, 1);
+            level.height = std::max(source.height / 2, 1);
+            level.pixels.resize(static_cast<size_t>(level.width) * level.height * 4);
+
+            for (int y = 0; y < level.height; y++)
+            {
+                for (int x = 0; x < level.width; x++)
+                {
+                    float sum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+                    // 2x2 box filter, odd edges repeat their last row or column
+                    for (int sample = 0; sample < 4; sample++)
+                    {
+                        int source_x = std::min(x * 2 + (sample & 1), source.width - 1);
+                        int source_y = std::min(y * 2 + (sample >> 1), source.height - 1);
+                        const unsigned char* pixel
+                            = &source.pixels[(static_cast<size_t>(source_y) * source.width + source_x) * 4];
+
+                        sum[0] += srgb_to_linear[pixel[0]];
+                        sum[1] += srgb_to_linear[pixel[1]];
+                        sum[2] += srgb_to_linear[pixel[2]];
+                        sum[3] += static_cast<float>(pixel[3]);
+                    }
+
+                    unsigned char* output = &level.pixels[(static_cast<size_t>(y) * level.width + x) * 4];
+                    output[0] = linear_to_srgb(sum[0] * 0.25f);
+                    output[1] = linear_to_srgb(sum[1] * 0.25f);
+                    output[2] = linear_to_srgb(sum[2] * 0.25f);
+                    output[3] = static_cast<unsigned char>(std::lround(sum[3] * 0.25f));
+                }
+            }
+
+            levels.push_back(std::move(level));
+        }
+
+        return levels;
+    }
+
+    GLenum BlockCompressor::choose_format(const rgba_image_t& image)
+    {
+        for (size_t idx = 3; idx < image.pixels.size(); idx += 4)
+        {
+            if (image.pixels[idx] != 255)
+            {
+                return COMPRESSED_SRGB_ALPHA_BC3;
+            }
+        }
+
+        return COMPRESSED_SRGB_BC1;
+    }
+
+    std::vector<unsigned char> BlockCompressor::compress(const rgba_image_t& image, GLenum internal_format)
+    {
+        const bool has_alpha = internal_format == COMPRESSED_SRGB_ALPHA_BC3;
+        const size_t block_bytes = has_alpha ? 16 : 8;
+        const int blocks_x = (image.width + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        const int blocks_y = (image.height + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+        std::vector<unsigned char> blocks(static_cast<size_t>(blocks_x) * blocks_y * block_bytes);
+        unsigned char* output = blocks.data();
+
+        for (int block_y = 0; block_y < blocks_y; block_y++)
+        {
+            for (int block_x = 0; block_x < blocks_x; block_x++)
+            {
+                unsigned char block[BLOCK_PIXELS * 4];
+
+                // blocks over the image edge repeat the last row or column
+                for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+                {
+                    int x = std::min(block_x * BLOCK_SIZE + idx % BLOCK_SIZE, image.width - 1);
+                    int y = std::min(block_y * BLOCK_SIZE + idx / BLOCK_SIZE, image.height - 1);
+                    const unsigned char* pixel = &image.pixels[(static_cast<size_t>(y) * image.width + x) * 4];
+
+                    std::copy(pixel, pixel + 4, block + idx * 4);
+                }
+
+                if (has_alpha)
+                {
+                    compress_alpha_block(block, output);
+                    output += 8;
+                }
+
+                compress_color_block(block, output);
+                output += 8;
+            }
+        }
+
+        return blocks;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void BlockCompressor::compress_color_block(const unsigned char* block, unsigned char* output)
+    {
+        float mean[3] = {0.0f, 0.0f, 0.0f};
+
+        for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+        {
+            for (int channel = 0; channel < 3; channel++)
+            {
+                mean[channel] += block[idx * 4 + channel];
+            }
+        }
+
+        for (float& channel : mean)
+        {
+            channel /= BLOCK_PIXELS;
+        }
+
+        // principal axis of the colors, found by power iteration on the covariance matrix
+        float covariance[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+        for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+        {
+            float red = block[idx * 4 + 0] - mean[0];
+            float green = block[idx * 4 + 1] - mean[1];
+            float blue = block[idx * 4 + 2] - mean[2];
+
+            covariance[0] += red * red;
+            covariance[1] += red * green;
+            covariance[2] += red * blue;
+            covariance[3] += green * green;
+            covariance[4] += green * blue;
+            covariance[5] += blue * blue;
+        }
+
+        float axis[3] = {1.0f, 1.0f, 1.0f};
+
+        for (int iteration = 0; iteration < 8; iteration++)
+        {
+            float next[3] = {
+                covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+                covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+                covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]
+            };
+
+            float length = std::max({std::fabs(next[0]), std::fabs(next[1]), std::fabs(next[2])});
+
+            if (length < 1e-6f)
+            {
+                break;
+            }
+
+            axis[0] = next[0] / length;
+            axis[1] = next[1] / length;
+            axis[2] = next[2] / length;
+        }
+
+        float min_t = 0.0f;
+        float max_t = 0.0f;
+
+        for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+        {
+            float t = (block[idx * 4 + 0] - mean[0]) * axis[0] +
+                      (block[idx * 4 + 1] - mean[1]) * axis[1] +
+                      (block[idx * 4 + 2] - mean[2]) * axis[2];
+
+            min_t = std::min(min_t, t);
+            max_t = std::max(max_t, t);
+        }
+
+        // pull the endpoints in a little, the interpolated colors then cover the block better
+        float inset = (max_t - min_t) / 16.0f;
+        min_t += inset;
+        max_t -= inset;
+
+        float axis_length_squared = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+        float scale = axis_length_squared > 0.0f ? 1.0f / axis_length_squared : 0.0f;
+
+        float endpoint_max[3];
+        float endpoint_min[3];
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            endpoint_max[channel] = mean[channel] + axis[channel] * max_t * scale;
+            endpoint_min[channel] = mean[channel] + axis[channel] * min_t * scale;
+        }
+
+        uint16_t color0 = pack_565(endpoint_max);
+        uint16_t color1 = pack_565(endpoint_min);
+
+        // color0 > color1 selects the 4 color mode
+        if (color0 < color1)
+        {
+            std::swap(color0, color1);
+        }
+
+        uint32_t indices = 0;
+
+        if (color0 != color1)
+        {
+            float palette[4][3];
+            unpack_565(color0, palette[0]);
+            unpack_565(color1, palette[1]);
+
+            for (int channel = 0; channel < 3; channel++)
+            {
+                palette[2][channel] = (2.0f * palette[0][channel] + palette[1][channel]) / 3.0f;
+                palette[3][channel] = (palette[0][channel] + 2.0f * palette[1][channel]) / 3.0f;
+            }
+
+            for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+            {
+                uint32_t best_index = 0;
+                float best_distance = 1e30f;
+
+                for (uint32_t entry = 0; entry < 4; entry++)
+                {
+                    float distance = 0.0f;
+
+                    for (int channel = 0; channel < 3; channel++)
+                    {
+                        float delta = block[idx * 4 + channel] - palette[entry][channel];
+                        distance += delta * delta;
+                    }
+
+                    if (distance < best_distance)
+                    {
+                        best_distance = distance;
+                        best_index = entry;
+                    }
+                }
+
+                indices |= best_index << (idx * 2);
+            }
+        }
+
+        output[0] = static_cast<unsigned char>(color0 & 0xFF);
+        output[1] = static_cast<unsigned char>(color0 >> 8);
+        output[2] = static_cast<unsigned char>(color1 & 0xFF);
+        output[3] = static_cast<unsigned char>(color1 >> 8);
+        output[4] = static_cast<unsigned char>(indices & 0xFF);
+        output[5] = static_cast<unsigned char>((indices >> 8) & 0xFF);
+        output[6] = static_cast<unsigned char>((indices >> 16) & 0xFF);
+        output[7] = static_cast<unsigned char>(indices >> 24);
+    }
+
+    void BlockCompressor::compress_alpha_block(const unsigned char* block, unsigned char* output)
+    {
+        int alpha0 = 0;
+        int alpha1 = 255;
+
+        for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+        {
+            alpha0 = std::max(alpha0, static_cast<int>(block[idx * 4 + 3]));
+            alpha1 = std::min(alpha1, static_cast<int>(block[idx * 4 + 3]));
+        }
+
+        uint64_t indices = 0;
+
+        // alpha0 > alpha1 selects the 8 value mode, equal endpoints need no indices
+        if (alpha0 != alpha1)
+        {
+            int palette[8];
+            palette[0] = alpha0;
+            palette[1] = alpha1;
+
+            for (int entry = 1; entry < 7; entry++)
+            {
+                palette[entry + 1] = ((7 - entry) * alpha0 + entry * alpha1) / 7;
+            }
+
+            for (int idx = 0; idx < BLOCK_PIXELS; idx++)
+            {
+                uint64_t best_index = 0;
+                int best_distance = 256;
+
+                for (int entry = 0; entry < 8; entry++)
+                {
+                    int distance = std::abs(block[idx * 4 + 3] - palette[entry]);
+
+                    if (distance < best_distance)
+                    {
+                        best_distance = distance;
+                        best_index = static_cast<uint64_t>(entry);
+                    }
+                }
+
+                indices |= best_index << (idx * 3);
+            }
+        }
+
+        output[0] = static_cast<unsigned char>(alpha0);
+        output[1] = static_cast<unsigned char>(alpha1);
+
+        for (int byte = 0; byte < 6; byte++)
+        {
+            output[2 + byte] = static_cast<unsigned char>((indices >> (byte * 8)) & 0xFF);
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,135 @@
+///
+/// @file box_mesh.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the BoxMesh class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include "box_mesh.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr GLsizei BOX_EDGE_INDEX_COUNT = 24; ///< Two indices for each of the 12 edges.
+    constexpr GLsizei BOX_FACE_INDEX_COUNT = 36; ///< Two triangles for each of the 6 faces, after the edges.
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    BoxMesh::BoxMesh()
+        : m_buffers{}
+    {
+        vertex_t vertices[8]{};
+
+        // corner idx has x = bit 0, y = bit 1, z = bit 2
+        for (int idx = 0; idx < 8; idx++)
+        {
+            vertices[idx].Position = glm::vec3(idx & 1, (idx >> 1) & 1, (idx >> 2) & 1);
+            vertices[idx].Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+            vertices[idx].TexCoords = glm::vec2(0.0f);
+        }
+
+        const GLuint indices[BOX_EDGE_INDEX_COUNT + BOX_FACE_INDEX_COUNT] = {
+            0, 1, 2, 3, 4, 5, 6, 7, // edges along x
+            0, 2, 1, 3, 4, 6, 5, 7, // edges along y
+            0, 4, 1, 5, 2, 6, 3, 7, // edges along z
+            0, 2, 3, 0, 3, 1, // face z = 0
+            4, 5, 7, 4, 7, 6, // face z = 1
+            0, 1, 5, 0, 5, 4, // face y = 0
+            2, 6, 7, 2, 7, 3, // face y = 1
+            0, 4, 6, 0, 6, 2, // face x = 0
+            1, 3, 7, 1, 7, 5  // face x = 1
+        };
+
+        glGenVertexArrays(1, &this->m_buffers.VAO);
+        glGenBuffers(1, &this->m_buffers.VBO);
+        glGenBuffers(1, &this->m_buffers.EBO);
+
+        glBindVertexArray(this->m_buffers.VAO);
+
+        glBindBuffer(GL_ARRAY_BUFFER, this->m_buffers.VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->m_buffers.EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(vertex_t), nullptr);
+
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1,
+                              3,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(vertex_t),
+                              reinterpret_cast<GLvoid*>(offsetof(vertex_t, Normal)));
+
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2,
+                              2,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(vertex_t),
+                              reinterpret_cast<GLvoid*>(offsetof(vertex_t, TexCoords)));
+
+        glBindVertexArray(0);
+    }
+
+    BoxMesh::~BoxMesh()
+    {
+        glDeleteBuffers(1, &this->m_buffers.VBO);
+        glDeleteBuffers(1, &this->m_buffers.EBO);
+        glDeleteVertexArrays(1, &this->m_buffers.VAO);
+    }
+
+    void BoxMesh::draw_wireframe() const
+    {
+        glBindVertexArray(this->m_buffers.VAO);
+        glDrawElements(GL_LINES, BOX_EDGE_INDEX_COUNT, GL_UNSIGNED_INT, nullptr);
+        glBindVertexArray(0);
+    }
+
+    void BoxMesh::draw_solid() const
+    {
+        glBindVertexArray(this->m_buffers.VAO);
+        glDrawElements(GL_TRIANGLES,
+                       BOX_FACE_INDEX_COUNT,
+                       GL_UNSIGNED_INT,
+                       reinterpret_cast<const GLvoid*>(BOX_EDGE_INDEX_COUNT * sizeof(GLuint)));
+        glBindVertexArray(0);
+    }
+
+    glm::mat4 BoxMesh::get_box_matrix(const aabb_t& bounds)
+    {
+        glm::mat4 box_matrix = glm::translate(glm::mat4(1.0f), bounds.min);
+
+        return glm::scale(box_matrix, bounds.max - bounds.min);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,321 @@
+///
+/// @file compressed_texture.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the CompressedTexture class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "compressed_texture.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr char COOKED_TEXTURE_MAGIC[8] = {'Y', 'B', 'T', 'E', 'X', '\0', '\0', '\0'}; ///< File signature.
+    constexpr uint32_t COOKED_TEXTURE_VERSION = 1; ///< Bumped whenever the layout of the file changes.
+    constexpr size_t COOKED_TEXTURE_ALIGNMENT = 16; ///< Alignment of the level data.
+
+    ///
+    /// @struct cooked_texture_header_s
+    /// @brief Fixed size header at the start of a cooked texture file.
+    ///
+    typedef struct cooked_texture_header_s
+    {
+        char magic[8]; ///< Always COOKED_TEXTURE_MAGIC.
+        uint32_t version; ///< Always COOKED_TEXTURE_VERSION.
+        uint32_t internal_format; ///< Compressed OpenGL format of the levels.
+        uint32_t level_count; ///< Number of mip levels.
+        uint32_t reserved; ///< Zero.
+        int64_t source_size; ///< Size of the source image when it was cooked.
+        int64_t source_modification_time; ///< Last write time of the source image when it was cooked.
+        uint64_t source_hash; ///< Hash of the bytes of the source image.
+    } cooked_texture_header_t;
+
+    ///
+    /// @struct cooked_level_record_s
+    /// @brief Describes where a mip level is stored in a cooked texture file.
+    ///
+    typedef struct cooked_level_record_s
+    {
+        uint32_t width; ///< Width of the level in pixels.
+        uint32_t height; ///< Height of the level in pixels.
+        uint64_t offset; ///< Offset of the blocks from the start of the file.
+        uint64_t size; ///< Size of the blocks in bytes.
+    } cooked_level_record_t;
+
+    ///
+    /// @brief Reads the current size and modification time of a file.
+    ///
+    static bool stat_file(const std::string& path, int64_t& size, int64_t& modification_time)
+    {
+        std::error_code error{};
+
+        auto file_size = std::filesystem::file_size(path, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        auto write_time = std::filesystem::last_write_time(path, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        size = static_cast<int64_t>(file_size);
+        modification_time = static_cast<int64_t>(write_time.time_since_epoch().count());
+
+        return true;
+    }
+
+    ///
+    /// @brief Computes the size of the blocks of a level.
+    ///
+    static size_t get_level_size(GLenum internal_format, uint32_t width, uint32_t height)
+    {
+        size_t block_bytes = internal_format == COMPRESSED_SRGB_ALPHA_BC3 ? 16 : 8;
+
+        return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * block_bytes;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    std::string CompressedTexture::get_cooked_path(const std::string& source_path)
+    {
+        return source_path + ".ybtex";
+    }
+
+    bool CompressedTexture::load(const std::string& source_path, compressed_image_t& image)
+    {
+        auto file = std::make_shared<MappedFile>(get_cooked_path(source_path));
+
+        if (!file->is_open() || file->size() < sizeof(cooked_texture_header_t))
+        {
+            return false;
+        }
+
+        cooked_texture_header_t header{};
+        std::memcpy(&header, file->data(), sizeof(header));
+
+        bool valid = std::memcmp(header.magic, COOKED_TEXTURE_MAGIC, sizeof(COOKED_TEXTURE_MAGIC)) == 0 &&
+                     header.version == COOKED_TEXTURE_VERSION &&
+                     (header.internal_format == COMPRESSED_SRGB_BC1 ||
+                      header.internal_format == COMPRESSED_SRGB_ALPHA_BC3) &&
+                     header.level_count > 0 &&
+                     file->size() - sizeof(header) >= header.level_count * sizeof(cooked_level_record_t);
+
+        // a missing source means only the cooked texture is shipped
+        int64_t source_size = 0;
+        int64_t source_modification_time = 0;
+
+        if (valid && stat_file(source_path, source_size, source_modification_time))
+        {
+            valid = source_size == header.source_size &&
+                    source_modification_time == header.source_modification_time;
+        }
+
+        if (!valid)
+        {
+            return false;
+        }
+
+        image.internal_format = header.internal_format;
+        image.source_hash = header.source_hash;
+        image.levels.clear();
+
+        for (uint32_t idx = 0; idx < header.level_count; idx++)
+        {
+            cooked_level_record_t record{};
+            std::memcpy(&record,
+                        file->data() + sizeof(header) + idx * sizeof(cooked_level_record_t),
+                        sizeof(record));
+
+            if (record.offset > file->size() ||
+                file->size() - record.offset < record.size ||
+                record.size != get_level_size(header.internal_format, record.width, record.height))
+            {
+                return false;
+            }
+
+            image.levels.push_back({static_cast<int>(record.width),
+                                    static_cast<int>(record.height),
+                                    reinterpret_cast<const unsigned char*>(file->data() + record.offset),
+                                    static_cast<size_t>(record.size)});
+        }
+
+        image.file = std::move(file);
+
+        return true;
+    }
+
+    bool CompressedTexture::save(const std::string& source_path, const compressed_image_t& image)
+    {
+        cooked_texture_header_t header{};
+        std::memcpy(header.magic, COOKED_TEXTURE_MAGIC, sizeof(COOKED_TEXTURE_MAGIC));
+        header.version = COOKED_TEXTURE_VERSION;
+        header.internal_format = image.internal_format;
+        header.level_count = static_cast<uint32_t>(image.levels.size());
+        header.source_hash = image.source_hash;
+
+        if (!stat_file(source_path, header.source_size, header.source_modification_time))
+        {
+            return false;
+        }
+
+        std::vector<cooked_level_record_t> records{};
+        uint64_t offset = sizeof(header) + image.levels.size() * sizeof(cooked_level_record_t);
+
+        for (const auto& level: image.levels)
+        {
+            offset += (COOKED_TEXTURE_ALIGNMENT - offset % COOKED_TEXTURE_ALIGNMENT) % COOKED_TEXTURE_ALIGNMENT;
+            records.push_back({static_cast<uint32_t>(level.width), static_cast<uint32_t>(level.height), offset, level.size});
+            offset += level.size;
+        }
+
+        // write next to the cooked file and rename, so a reader never sees half a file
+        std::string cooked_path = get_cooked_path(source_path);
+        std::string temporary_path = cooked_path + ".tmp";
+
+        {
+            std::ofstream cooked_file(temporary_path, std::ios::binary | std::ios::trunc);
+
+            cooked_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            cooked_file.write(reinterpret_cast<const char*>(records.data()),
+                              static_cast<std::streamsize>(records.size() * sizeof(cooked_level_record_t)));
+
+            for (size_t idx = 0; idx < image.levels.size(); idx++)
+            {
+                static const char padding[COOKED_TEXTURE_ALIGNMENT] = {};
+                auto position = static_cast<uint64_t>(cooked_file.tellp());
+
+                cooked_file.write(padding, static_cast<std::streamsize>(records[idx].offset - position));
+                cooked_file.write(reinterpret_cast<const char*>(image.levels[idx].data),
+                                  static_cast<std::streamsize>(image.levels[idx].size));
+            }
+
+            if (!cooked_file)
+            {
+                std::cerr << "WARNING: could not write cooked texture " << cooked_path << "\n";
+                return false;
+            }
+        }
+
+        std::error_code error{};
+        std::filesystem::rename(temporary_path, cooked_path, error);
+
+        if (error)
+        {
+            std::filesystem::remove(temporary_path, error);
+            std::cerr << "WARNING: could not write cooked texture " << cooked_path << "\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompressedTexture::is_supported()
+    {
+        static int supported = -1;
+
+        if (supported < 0)
+        {
+            bool has_s3tc = false;
+            bool has_srgb = false;
+
+            GLint extension_count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &extension_count);
+
+            for (GLint idx = 0; idx < extension_count; idx++)
+            {
+                const auto* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, idx));
+
+                if (extension == nullptr)
+                {
+                    continue;
+                }
+
+                has_s3tc = has_s3tc || std::strcmp(extension, "GL_EXT_texture_compression_s3tc") == 0;
+                has_srgb = has_srgb ||
+                           std::strcmp(extension, "GL_EXT_texture_sRGB") == 0 ||
+                           std::strcmp(extension, "GL_EXT_texture_compression_s3tc_srgb") == 0;
+            }
+
+            supported = has_s3tc && has_srgb ? 1 : 0;
+        }
+
+        return supported == 1;
+    }
+
+    GLuint CompressedTexture::upload(const compressed_image_t& image)
+    {
+        GLuint texture_id;
+        glGenTextures(1, &texture_id);
+        glBindTexture(GL_TEXTURE_2D, texture_id);
+
+        const auto level_count = static_cast<GLint>(image.levels.size());
+
+        for (GLint level = 0; level < level_count; level++)
+        {
+            glCompressedTexImage2D(GL_TEXTURE_2D,
+                                   level,
+                                   image.internal_format,
+                                   image.levels[level].width,
+                                   image.levels[level].height,
+                                   0,
+                                   static_cast<GLsizei>(image.levels[level].size),
+                                   image.levels[level].data);
+        }
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level_count - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        return texture_id;
+    }
+
+    size_t CompressedTexture::get_byte_size(const compressed_image_t& image) noexcept
+    {
+        size_t byte_size = 0;
+
+        for (const auto& level: image.levels)
+        {
+            byte_size += level.size;
+        }
+
+        return byte_size;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,580 @@
+///
+/// @file geometry_arena.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the GeometryArena class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include "geometry_arena.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr size_t MIN_VERTEX_CAPACITY = 65536; ///< Vertices of a pool's first vertex buffer.
+    constexpr size_t MIN_INDEX_CAPACITY = 1 << 20; ///< Bytes of a pool's first index buffer.
+    constexpr size_t INDEX_ALIGNMENT = sizeof(GLuint); ///< Index ranges start aligned for either index type.
+
+    ///
+    /// @brief Maps a vertex format to the index of its pool.
+    ///
+    static size_t pool_index(VERTEX_FORMAT vertex_format)
+    {
+        return vertex_format == VERTEX_FORMAT::COMPACT ? 1 : 0;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    GeometryArena::GeometryArena()
+        : m_pools{},
+          m_allocations{},
+          m_free_handles{},
+          m_draw_offsets{},
+          m_draw_base_vertices{},
+          m_bound_vertex_array{0},
+          m_draw_id_buffer{0}
+    {
+        this->m_pools[pool_index(VERTEX_FORMAT::FULL)].vertex_size = sizeof(vertex_t);
+        this->m_pools[pool_index(VERTEX_FORMAT::COMPACT)].vertex_size = sizeof(compact_vertex_t);
+    }
+
+    uint32_t GeometryArena::allocate(VERTEX_FORMAT vertex_format,
+                                     const void* vertex_data,
+                                     size_t vertex_count,
+                                     const void* index_data,
+                                     size_t index_byte_size)
+    {
+        pool_t& pool = this->m_pools[pool_index(vertex_format)];
+
+        allocation_t allocation{vertex_format,
+                                0,
+                                vertex_count,
+                                0,
+                                (index_byte_size + INDEX_ALIGNMENT - 1) / INDEX_ALIGNMENT * INDEX_ALIGNMENT,
+                                true};
+
+        if (allocation.vertex_count > 0 &&
+            !take_range(pool.free_vertices, allocation.vertex_count, allocation.vertex_offset))
+        {
+            this->grow_vertices(vertex_format,
+                                std::max({pool.vertex_capacity * 2,
+                                          pool.vertex_capacity + allocation.vertex_count,
+                                          MIN_VERTEX_CAPACITY}));
+
+            take_range(pool.free_vertices, allocation.vertex_count, allocation.vertex_offset);
+        }
+
+        if (allocation.index_size > 0 &&
+            !take_range(pool.free_indices, allocation.index_size, allocation.index_offset))
+        {
+            this->grow_indices(vertex_format,
+                               std::max({pool.index_capacity * 2,
+                                         pool.index_capacity + allocation.index_size,
+                                         MIN_INDEX_CAPACITY}));
+
+            take_range(pool.free_indices, allocation.index_size, allocation.index_offset);
+        }
+
+        // the copy targets are not part of any vertex array object, so uploads leave the bound one alone
+        if (allocation.vertex_count > 0)
+        {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, pool.buffers.VBO);
+            glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(allocation.vertex_offset * pool.vertex_size),
+                            static_cast<GLsizeiptr>(allocation.vertex_count * pool.vertex_size),
+                            vertex_data);
+        }
+
+        if (index_byte_size > 0)
+        {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, pool.buffers.EBO);
+            glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(allocation.index_offset),
+                            static_cast<GLsizeiptr>(index_byte_size),
+                            index_data);
+        }
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        if (!this->m_free_handles.empty())
+        {
+            uint32_t handle = this->m_free_handles.back();
+            this->m_free_handles.pop_back();
+            this->m_allocations[handle] = allocation;
+            return handle;
+        }
+
+        this->m_allocations.push_back(allocation);
+
+        return static_cast<uint32_t>(this->m_allocations.size() - 1);
+    }
+
+    void GeometryArena::release(uint32_t handle)
+    {
+        if (handle >= this->m_allocations.size() || !this->m_allocations[handle].live)
+        {
+            return;
+        }
+
+        allocation_t& allocation = this->m_allocations[handle];
+        pool_t& pool = this->m_pools[pool_index(allocation.vertex_format)];
+
+        if (allocation.vertex_count > 0)
+        {
+            give_range(pool.free_vertices, allocation.vertex_offset, allocation.vertex_count);
+        }
+
+        if (allocation.index_size > 0)
+        {
+            give_range(pool.free_indices, allocation.index_offset, allocation.index_size);
+        }
+
+        allocation.live = false;
+        this->m_free_handles.push_back(handle);
+    }
+
+    void GeometryArena::draw(uint32_t handle,
+                             GLenum index_type,
+                             const GLsizei* counts,
+                             const size_t* offsets,
+                             size_t draw_count,
+                             GLsizei instance_count)
+    {
+        if (draw_count == 0 || instance_count == 0)
+        {
+            return;
+        }
+
+        const allocation_t& allocation = this->m_allocations[handle];
+        const pool_t& pool = this->m_pools[pool_index(allocation.vertex_format)];
+
+        if (this->m_bound_vertex_array != pool.buffers.VAO)
+        {
+            glBindVertexArray(pool.buffers.VAO);
+            this->m_bound_vertex_array = pool.buffers.VAO;
+        }
+
+        GLint base_vertex = static_cast<GLint>(allocation.vertex_offset);
+
+        // there is no instanced multi-draw before indirect draws, each range is its own call
+        if (instance_count > 1)
+        {
+            for (size_t idx = 0; idx < draw_count; idx++)
+            {
+                glDrawElementsInstancedBaseVertex(GL_TRIANGLES,
+                                                  counts[idx],
+                                                  index_type,
+                                                  reinterpret_cast<const GLvoid*>(allocation.index_offset + offsets[idx]),
+                                                  instance_count,
+                                                  base_vertex);
+            }
+
+            return;
+        }
+
+        if (draw_count == 1)
+        {
+            glDrawElementsBaseVertex(GL_TRIANGLES,
+                                     counts[0],
+                                     index_type,
+                                     reinterpret_cast<const GLvoid*>(allocation.index_offset + offsets[0]),
+                                     base_vertex);
+            return;
+        }
+
+        this->m_draw_offsets.resize(draw_count);
+        this->m_draw_base_vertices.assign(draw_count, base_vertex);
+
+        for (size_t idx = 0; idx < draw_count; idx++)
+        {
+            this->m_draw_offsets[idx] = reinterpret_cast<const GLvoid*>(allocation.index_offset + offsets[idx]);
+        }
+
+        glMultiDrawElementsBaseVertex(GL_TRIANGLES,
+                                      counts,
+                                      index_type,
+                                      this->m_draw_offsets.data(),
+                                      static_cast<GLsizei>(draw_count),
+                                      this->m_draw_base_vertices.data());
+    }
+
+    void GeometryArena::compact()
+    {
+        for (VERTEX_FORMAT vertex_format: {VERTEX_FORMAT::FULL, VERTEX_FORMAT::COMPACT})
+        {
+            pool_t& pool = this->m_pools[pool_index(vertex_format)];
+
+            if (pool.buffers.VAO == 0)
+            {
+                continue;
+            }
+
+            std::vector<allocation_t*> allocations{};
+
+            for (auto& allocation: this->m_allocations)
+            {
+                if (allocation.live && allocation.vertex_format == vertex_format)
+                {
+                    allocations.push_back(&allocation);
+                }
+            }
+
+            GLuint vertex_buffer = create_buffer(0, 0, pool.vertex_capacity * pool.vertex_size);
+            GLuint index_buffer = create_buffer(0, 0, pool.index_capacity);
+
+            size_t vertex_end = 0;
+            size_t index_end = 0;
+
+            glBindBuffer(GL_COPY_WRITE_BUFFER, vertex_buffer);
+            glBindBuffer(GL_COPY_READ_BUFFER, pool.buffers.VBO);
+
+            // in offset order every range moves towards the front, so the packed ranges keep their order
+            std::sort(allocations.begin(),
+                      allocations.end(),
+                      [](const allocation_t* lhs, const allocation_t* rhs) { return lhs->vertex_offset < rhs->vertex_offset; });
+
+            for (allocation_t* allocation: allocations)
+            {
+                glCopyBufferSubData(GL_COPY_READ_BUFFER,
+                                    GL_COPY_WRITE_BUFFER,
+                                    static_cast<GLintptr>(allocation->vertex_offset * pool.vertex_size),
+                                    static_cast<GLintptr>(vertex_end * pool.vertex_size),
+                                    static_cast<GLsizeiptr>(allocation->vertex_count * pool.vertex_size));
+
+                allocation->vertex_offset = vertex_end;
+                vertex_end += allocation->vertex_count;
+            }
+
+            glBindBuffer(GL_COPY_WRITE_BUFFER, index_buffer);
+            glBindBuffer(GL_COPY_READ_BUFFER, pool.buffers.EBO);
+
+            std::sort(allocations.begin(),
+                      allocations.end(),
+                      [](const allocation_t* lhs, const allocation_t* rhs) { return lhs->index_offset < rhs->index_offset; });
+
+            for (allocation_t* allocation: allocations)
+            {
+                glCopyBufferSubData(GL_COPY_READ_BUFFER,
+                                    GL_COPY_WRITE_BUFFER,
+                                    static_cast<GLintptr>(allocation->index_offset),
+                                    static_cast<GLintptr>(index_end),
+                                    static_cast<GLsizeiptr>(allocation->index_size));
+
+                allocation->index_offset = index_end;
+                index_end += allocation->index_size;
+            }
+
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+            glDeleteBuffers(1, &pool.buffers.VBO);
+            glDeleteBuffers(1, &pool.buffers.EBO);
+
+            pool.buffers.VBO = vertex_buffer;
+            pool.buffers.EBO = index_buffer;
+
+            pool.free_vertices.clear();
+            pool.free_indices.clear();
+            give_range(pool.free_vertices, vertex_end, pool.vertex_capacity - vertex_end);
+            give_range(pool.free_indices, index_end, pool.index_capacity - index_end);
+
+            this->setup_vertex_array(vertex_format);
+        }
+    }
+
+    void GeometryArena::set_draw_id_buffer(GLuint buffer)
+    {
+        this->m_draw_id_buffer = buffer;
+
+        for (VERTEX_FORMAT vertex_format: {VERTEX_FORMAT::FULL, VERTEX_FORMAT::COMPACT})
+        {
+            if (this->m_pools[pool_index(vertex_format)].buffers.VAO != 0)
+            {
+                this->setup_vertex_array(vertex_format);
+            }
+        }
+    }
+
+    GLint GeometryArena::get_base_vertex(uint32_t handle) const noexcept
+    {
+        return static_cast<GLint>(this->m_allocations[handle].vertex_offset);
+    }
+
+    size_t GeometryArena::get_index_offset(uint32_t handle) const noexcept
+    {
+        return this->m_allocations[handle].index_offset;
+    }
+
+    size_t GeometryArena::get_byte_size(uint32_t handle) const noexcept
+    {
+        const allocation_t& allocation = this->m_allocations[handle];
+
+        return allocation.vertex_count * this->m_pools[pool_index(allocation.vertex_format)].vertex_size
+            + allocation.index_size;
+    }
+
+    void GeometryArena::reset_bindings() noexcept
+    {
+        this->m_bound_vertex_array = 0;
+    }
+
+    buffers_t GeometryArena::get_buffers(VERTEX_FORMAT vertex_format) const noexcept
+    {
+        return this->m_pools[pool_index(vertex_format)].buffers;
+    }
+
+    geometry_arena_stats_t GeometryArena::get_stats() const noexcept
+    {
+        geometry_arena_stats_t stats{0, 0, 0, 0};
+
+        for (const auto& pool: this->m_pools)
+        {
+            stats.buffer_bytes += pool.vertex_capacity * pool.vertex_size + pool.index_capacity;
+            stats.free_range_count += pool.free_vertices.size() + pool.free_indices.size();
+        }
+
+        for (const auto& allocation: this->m_allocations)
+        {
+            if (allocation.live)
+            {
+                const pool_t& pool = this->m_pools[pool_index(allocation.vertex_format)];
+
+                stats.used_bytes += allocation.vertex_count * pool.vertex_size + allocation.index_size;
+                stats.allocation_count++;
+            }
+        }
+
+        return stats;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    bool GeometryArena::take_range(std::vector<free_range_t>& free_ranges, size_t size, size_t& offset)
+    {
+        for (auto range = free_ranges.begin(); range != free_ranges.end(); ++range)
+        {
+            if (range->size < size)
+            {
+                continue;
+            }
+
+            offset = range->offset;
+            range->offset += size;
+            range->size -= size;
+
+            if (range->size == 0)
+            {
+                free_ranges.erase(range);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void GeometryArena::give_range(std::vector<free_range_t>& free_ranges, size_t offset, size_t size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+
+        auto next = std::lower_bound(free_ranges.begin(),
+                                     free_ranges.end(),
+                                     offset,
+                                     [](const free_range_t& range, size_t value) { return range.offset < value; });
+
+        bool joins_previous = next != free_ranges.begin() && std::prev(next)->offset + std::prev(next)->size == offset;
+        bool joins_next = next != free_ranges.end() && offset + size == next->offset;
+
+        if (joins_previous && joins_next)
+        {
+            std::prev(next)->size += size + next->size;
+            free_ranges.erase(next);
+        }
+        else if (joins_previous)
+        {
+            std::prev(next)->size += size;
+        }
+        else if (joins_next)
+        {
+            next->offset = offset;
+            next->size += size;
+        }
+        else
+        {
+            free_ranges.insert(next, {offset, size});
+        }
+    }
+
+    GLuint GeometryArena::create_buffer(GLuint source, size_t copy_size, size_t capacity)
+    {
+        GLuint buffer = 0;
+
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(capacity), nullptr, GL_STATIC_DRAW);
+
+        if (source != 0 && copy_size > 0)
+        {
+            glBindBuffer(GL_COPY_READ_BUFFER, source);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, static_cast<GLsizeiptr>(copy_size));
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        }
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        return buffer;
+    }
+
+    void GeometryArena::setup_vertex_array(VERTEX_FORMAT vertex_format)
+    {
+        pool_t& pool = this->m_pools[pool_index(vertex_format)];
+
+        if (pool.buffers.VAO == 0)
+        {
+            glGenVertexArrays(1, &pool.buffers.VAO);
+        }
+
+        glBindVertexArray(pool.buffers.VAO);
+
+        if (pool.buffers.VBO != 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, pool.buffers.VBO);
+
+            if (vertex_format == VERTEX_FORMAT::COMPACT)
+            {
+                // Vertex Positions, normalized to [0, 1] within the mesh bounds
+                glEnableVertexAttribArray(0);
+                glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(compact_vertex_t), nullptr);
+
+                // Vertex Normals, the shader reads xyz of the normalized 2_10_10_10 value
+                glEnableVertexAttribArray(1);
+                glVertexAttribPointer(1,
+                                      4,
+                                      GL_INT_2_10_10_10_REV,
+                                      GL_TRUE,
+                                      sizeof(compact_vertex_t),
+                                      reinterpret_cast<GLvoid*>(offsetof(compact_vertex_t, Normal)));
+
+                // Vertex Texture Coords
+                glEnableVertexAttribArray(2);
+                glVertexAttribPointer(2,
+                                      2,
+                                      GL_HALF_FLOAT,
+                                      GL_FALSE,
+                                      sizeof(compact_vertex_t),
+                                      reinterpret_cast<GLvoid*>(offsetof(compact_vertex_t, TexCoords)));
+            }
+            else
+            {
+                // Vertex Positions
+                glEnableVertexAttribArray(0);
+                glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(vertex_t), nullptr);
+
+                // Vertex Normals
+                glEnableVertexAttribArray(1);
+                glVertexAttribPointer(1,
+                                      3,
+                                      GL_FLOAT,
+                                      GL_FALSE,
+                                      sizeof(vertex_t),
+                                      reinterpret_cast<GLvoid*>(offsetof(vertex_t, Normal)));
+
+                // Vertex Texture Coords
+                glEnableVertexAttribArray(2);
+                glVertexAttribPointer(2,
+                                      2,
+                                      GL_FLOAT,
+                                      GL_FALSE,
+                                      sizeof(vertex_t),
+                                      reinterpret_cast<GLvoid*>(offsetof(vertex_t, TexCoords)));
+            }
+        }
+
+        if (this->m_draw_id_buffer != 0)
+        {
+            // Draw Ids, one per instance, the base instance of an indirect command picks its id
+            glBindBuffer(GL_ARRAY_BUFFER, this->m_draw_id_buffer);
+            glEnableVertexAttribArray(3);
+            glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(GLuint), nullptr);
+            glVertexAttribDivisor(3, 1);
+        }
+        else
+        {
+            glDisableVertexAttribArray(3);
+        }
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, pool.buffers.EBO);
+
+        glBindVertexArray(0);
+        this->m_bound_vertex_array = 0;
+    }
+
+    void GeometryArena::grow_vertices(VERTEX_FORMAT vertex_format, size_t vertex_capacity)
+    {
+        pool_t& pool = this->m_pools[pool_index(vertex_format)];
+
+        GLuint buffer = create_buffer(pool.buffers.VBO,
+                                      pool.vertex_capacity * pool.vertex_size,
+                                      vertex_capacity * pool.vertex_size);
+
+        if (pool.buffers.VBO != 0)
+        {
+            glDeleteBuffers(1, &pool.buffers.VBO);
+        }
+
+        give_range(pool.free_vertices, pool.vertex_capacity, vertex_capacity - pool.vertex_capacity);
+
+        pool.buffers.VBO = buffer;
+        pool.vertex_capacity = vertex_capacity;
+
+        this->setup_vertex_array(vertex_format);
+    }
+
+    void GeometryArena::grow_indices(VERTEX_FORMAT vertex_format, size_t index_capacity)
+    {
+        pool_t& pool = this->m_pools[pool_index(vertex_format)];
+
+        GLuint buffer = create_buffer(pool.buffers.EBO, pool.index_capacity, index_capacity);
+
+        if (pool.buffers.EBO != 0)
+        {
+            glDeleteBuffers(1, &pool.buffers.EBO);
+        }
+
+        give_range(pool.free_indices, pool.index_capacity, index_capacity - pool.index_capacity);
+
+        pool.buffers.EBO = buffer;
+        pool.index_capacity = index_capacity;
+
+        this->setup_vertex_array(vertex_format);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
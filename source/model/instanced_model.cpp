@@ -0,0 +1,200 @@
+///
+/// @file instanced_model.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the InstancedModel class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "frustum_utils.hpp"
+#include "instanced_model.hpp"
+#include "core_components.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/matrix_inverse.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ///
+    /// @brief Gets the largest scale a transform applies along its axes.
+    ///
+    static float max_axis_scale(const glm::mat4& transform)
+    {
+        return std::max(glm::length(glm::vec3(transform[0])),
+                        std::max(glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2]))));
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    InstancedModel::InstancedModel(const std::string& file_path)
+        : m_model{CoreComponents::asset_manager->acquire(file_path)},
+          m_draws{},
+          m_file_path{AssetManager::canonicalize(file_path)},
+          m_transforms{},
+          m_scales{},
+          m_visible_matrices{},
+          m_spheres{},
+          m_culler{},
+          m_instance_buffer{0},
+          m_instance_texture{0},
+          m_triangle_count{0},
+          m_culled_count{0}
+    {
+        glGenBuffers(1, &this->m_instance_buffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, this->m_instance_buffer);
+        glBufferData(GL_TEXTURE_BUFFER, 2 * sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+        glGenTextures(1, &this->m_instance_texture);
+        glBindTexture(GL_TEXTURE_BUFFER, this->m_instance_texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, this->m_instance_buffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+    }
+
+    InstancedModel::~InstancedModel()
+    {
+        glDeleteTextures(1, &this->m_instance_texture);
+        glDeleteBuffers(1, &this->m_instance_buffer);
+    }
+
+    size_t InstancedModel::add_instance(const glm::mat4& transform)
+    {
+        this->m_transforms.push_back(transform);
+        this->m_scales.push_back(max_axis_scale(transform));
+
+        return this->m_transforms.size() - 1;
+    }
+
+    void InstancedModel::set_instance(size_t instance, const glm::mat4& transform)
+    {
+        this->m_transforms[instance] = transform;
+        this->m_scales[instance] = max_axis_scale(transform);
+    }
+
+    size_t InstancedModel::get_instance_count() const noexcept
+    {
+        return this->m_transforms.size();
+    }
+
+    const std::string& InstancedModel::get_file_path() const noexcept
+    {
+        return this->m_file_path;
+    }
+
+    void InstancedModel::render(InstancedShader& shader,
+                                const glm::mat4& view_projection,
+                                const glm::vec3& camera_position,
+                                float pixels_per_unit_at_one,
+                                const lod_settings_t& settings)
+    {
+        this->m_triangle_count = 0;
+        this->m_culled_count = 0;
+
+        if (!this->m_model)
+        {
+            return;
+        }
+
+        frustum_t frustum = extract_frustum(view_projection);
+
+        bounding_sphere_t sphere = this->m_model->get_bounding_sphere();
+
+        float pixels_per_unit = 0.0f;
+
+        this->m_visible_matrices.clear();
+        this->m_spheres.resize(this->m_transforms.size());
+        this->m_culler.clear();
+
+        for (size_t idx = 0; idx < this->m_transforms.size(); idx++)
+        {
+            this->m_spheres[idx] = {glm::vec3(this->m_transforms[idx] * glm::vec4(sphere.center, 1.0f)),
+                                    sphere.radius * this->m_scales[idx]};
+
+            this->m_culler.add(this->m_spheres[idx]);
+        }
+
+        this->m_culled_count = this->m_culler.cull(frustum);
+
+        for (size_t idx = 0; idx < this->m_transforms.size(); idx++)
+        {
+            if (!this->m_culler.is_visible(idx))
+            {
+                continue;
+            }
+
+            const glm::mat4& transform = this->m_transforms[idx];
+            const bounding_sphere_t& world_sphere = this->m_spheres[idx];
+
+            this->m_visible_matrices.push_back(transform);
+            this->m_visible_matrices.push_back(glm::inverseTranspose(transform));
+
+            // the closest instance picks the level of all of them
+            float distance = std::max(glm::length(world_sphere.center - camera_position) - world_sphere.radius, 0.001f);
+
+            pixels_per_unit = std::max(pixels_per_unit, pixels_per_unit_at_one * this->m_scales[idx] / distance);
+        }
+
+        GLsizei visible_count = static_cast<GLsizei>(this->m_visible_matrices.size() / 2);
+
+        if (visible_count == 0)
+        {
+            return;
+        }
+
+        // orphaned, so the upload does not wait for the draws of the previous frame
+        glBindBuffer(GL_TEXTURE_BUFFER, this->m_instance_buffer);
+        glBufferData(GL_TEXTURE_BUFFER,
+                     static_cast<GLsizeiptr>(this->m_visible_matrices.size() * sizeof(glm::mat4)),
+                     nullptr,
+                     GL_STREAM_DRAW);
+        glBufferSubData(GL_TEXTURE_BUFFER,
+                        0,
+                        static_cast<GLsizeiptr>(this->m_visible_matrices.size() * sizeof(glm::mat4)),
+                        this->m_visible_matrices.data());
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+        glActiveTexture(GL_TEXTURE0 + InstancedShader::INSTANCE_TEXTURE_UNIT);
+        glBindTexture(GL_TEXTURE_BUFFER, this->m_instance_texture);
+
+        this->m_model->select_lod(pixels_per_unit, settings, this->m_draws);
+        this->m_model->draw_instances(shader.uniforms, this->m_draws, visible_count);
+
+        this->m_triangle_count = Model3D::get_triangle_count(this->m_draws) * static_cast<size_t>(visible_count);
+    }
+
+    size_t InstancedModel::get_triangle_count() const noexcept
+    {
+        return this->m_triangle_count;
+    }
+
+    size_t InstancedModel::get_culled_count() const noexcept
+    {
+        return this->m_culled_count;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
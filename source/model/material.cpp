@@ -0,0 +1,204 @@
+///
+/// @file material.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the Material class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include "hash_utils.hpp"
+#include "material.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+    ///
+    /// @brief Static member initialization for the registered sampler names.
+    ///
+    std::vector<uint64_t> Material::sampler_names{};
+
+    ///
+    /// @brief Static member initialization for the bound textures.
+    ///
+    std::vector<GLuint> Material::bound_textures{};
+
+    ///
+    /// @brief Static member initialization for the binding state.
+    ///
+    bool Material::bindings_known{false};
+
+    ///
+    /// @brief Static member initialization for the bind counter.
+    ///
+    size_t Material::bind_count{0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr size_t MAX_TEXTURE_UNITS = 16; ///< Fragment shader texture units guaranteed by OpenGL 3.3.
+    constexpr GLuint UNKNOWN_TEXTURE = std::numeric_limits<GLuint>::max(); ///< Binding of a unit that was not tracked yet.
+    constexpr uint32_t SORT_KEY_MASK = (1u << 20) - 1; ///< Bits of the sort key of a material.
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    Material::Material(const std::vector<texture_t>& textures)
+        : m_bindings{},
+          m_sort_key{0}
+    {
+        for (const auto& texture: textures)
+        {
+            GLint unit = get_texture_unit(texture.type);
+
+            if (unit < 0)
+            {
+                continue;
+            }
+
+            auto binding = std::find_if(this->m_bindings.begin(),
+                                        this->m_bindings.end(),
+                                        [unit](const texture_binding_t& other) { return other.unit == unit; });
+
+            if (binding != this->m_bindings.end())
+            {
+                binding->texture = texture.id;
+            }
+            else
+            {
+                this->m_bindings.push_back({unit, texture.id});
+            }
+        }
+
+        std::sort(this->m_bindings.begin(),
+                  this->m_bindings.end(),
+                  [](const texture_binding_t& lhs, const texture_binding_t& rhs) { return lhs.unit < rhs.unit; });
+
+        uint64_t hash = FNV1A_64_OFFSET_BASIS;
+
+        for (const auto& binding: this->m_bindings)
+        {
+            hash = fnv1a_hash_value(binding.unit, hash);
+            hash = fnv1a_hash_value(binding.texture, hash);
+        }
+
+        this->m_sort_key = static_cast<uint32_t>(hash ^ (hash >> 32)) & SORT_KEY_MASK;
+    }
+
+    void Material::bind(UniformTable& uniforms) const
+    {
+        resolve_samplers(uniforms);
+
+        if (!bindings_known)
+        {
+            bound_textures.assign(sampler_names.size(), UNKNOWN_TEXTURE);
+            bindings_known = true;
+        }
+
+        bound_textures.resize(sampler_names.size(), UNKNOWN_TEXTURE);
+
+        size_t next_binding = 0;
+
+        for (GLint unit = 0; unit < static_cast<GLint>(bound_textures.size()); unit++)
+        {
+            GLuint texture = 0;
+
+            if (next_binding < this->m_bindings.size() && this->m_bindings[next_binding].unit == unit)
+            {
+                texture = this->m_bindings[next_binding++].texture;
+            }
+
+            if (bound_textures[unit] == texture)
+            {
+                continue;
+            }
+
+            glActiveTexture(GL_TEXTURE0 + unit);
+            glBindTexture(GL_TEXTURE_2D, texture);
+
+            bound_textures[unit] = texture;
+            bind_count++;
+        }
+    }
+
+    bool Material::operator==(const Material& other) const noexcept
+    {
+        return std::equal(this->m_bindings.begin(),
+                          this->m_bindings.end(),
+                          other.m_bindings.begin(),
+                          other.m_bindings.end(),
+                          [](const texture_binding_t& lhs, const texture_binding_t& rhs)
+                          {
+                              return lhs.unit == rhs.unit && lhs.texture == rhs.texture;
+                          });
+    }
+
+    uint32_t Material::get_sort_key() const noexcept
+    {
+        return this->m_sort_key;
+    }
+
+    size_t Material::get_bind_count() noexcept
+    {
+        return bind_count;
+    }
+
+    void Material::reset_bindings() noexcept
+    {
+        bindings_known = false;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    GLint Material::get_texture_unit(const std::string& sampler_name)
+    {
+        uint64_t name_hash = fnv1a_hash(sampler_name);
+
+        auto name = std::find(sampler_names.begin(), sampler_names.end(), name_hash);
+
+        if (name != sampler_names.end())
+        {
+            return static_cast<GLint>(name - sampler_names.begin());
+        }
+
+        if (sampler_names.size() == MAX_TEXTURE_UNITS)
+        {
+            std::cerr << "WARNING: no texture unit left for sampler " << sampler_name << "\n";
+            return -1;
+        }
+
+        sampler_names.push_back(name_hash);
+
+        return static_cast<GLint>(sampler_names.size() - 1);
+    }
+
+    void Material::resolve_samplers(UniformTable& uniforms)
+    {
+        // sampler uniforms are program state, the table only sends the units a program does not have yet
+        for (size_t unit = 0; unit < sampler_names.size(); unit++)
+        {
+            uniforms.set(sampler_names[unit], static_cast<GLint>(unit));
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -11,14 +11,29 @@
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+#include "core_components.hpp"
+#include "draw_components.hpp"
 #include "mesh.hpp"
+#include "meshlet_builder.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
 namespace YB
 {
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr size_t MAX_SHORT_INDEX_VERTICES = 65536; ///< Vertex count from which 16-bit indices no longer fit.
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,92 +41,492 @@ namespace YB
     Mesh::Mesh(const std::vector<vertex_t>& vertices,
                const std::vector<GLuint>& indices,
                const std::vector<texture_t>& textures)
-       : m_vertices{vertices},
-         m_indices{indices},
+       : Mesh(std::vector<vertex_t>(vertices), std::vector<GLuint>(indices), std::vector<texture_t>(textures))
+    {
+    }
+
+    Mesh::Mesh(std::vector<vertex_t>&& vertices,
+               std::vector<GLuint>&& indices,
+               std::vector<texture_t>&& textures)
+       : Mesh(std::move(vertices),
+              std::move(indices),
+              std::vector<mesh_lod_t>{},
+              std::vector<meshlet_t>{},
+              std::move(textures),
+              VERTEX_FORMAT::FULL,
+              CPU_DATA_POLICY::KEEP_ALL)
+    {
+    }
+
+    Mesh::Mesh(std::vector<vertex_t>&& vertices,
+               std::vector<GLuint>&& indices,
+               std::vector<mesh_lod_t>&& lods,
+               std::vector<meshlet_t>&& meshlets,
+               std::vector<texture_t>&& textures,
+               VERTEX_FORMAT vertex_format,
+               CPU_DATA_POLICY cpu_data_policy)
+       : m_vertices{std::move(vertices)},
+         m_indices{std::move(indices)},
+         m_positions{},
+         m_textures{std::move(textures)},
+         m_material{this->m_textures},
+         m_geometry{0},
+         m_index_count{0},
+         m_index_type{GL_UNSIGNED_INT},
+         m_vertex_format{vertex_format},
+         m_position_transform{1.0f},
+         m_bounds{glm::vec3(0.0f), glm::vec3(0.0f)},
+         m_sphere{glm::vec3(0.0f), 0.0f},
+         m_cpu_data_policy{cpu_data_policy},
+         m_lods{std::move(lods)},
+         m_meshlets{std::move(meshlets)}
+    {
+        if (this->m_lods.empty())
+        {
+            this->m_lods.push_back({0, static_cast<uint32_t>(this->m_indices.size()), 0.0f, 0, 0});
+        }
+
+        this->compute_bounds(this->m_vertices.data(), this->m_vertices.size());
+
+        this->setup_mesh(this->m_vertices.data(),
+                         this->m_vertices.size(),
+                         this->m_indices.data(),
+                         this->m_indices.size());
+
+        this->apply_cpu_data_policy(this->m_vertices.data(),
+                                    this->m_vertices.size(),
+                                    this->m_indices.data(),
+                                    this->m_indices.size());
+    }
+
+    Mesh::Mesh(const vertex_t* vertices,
+               size_t vertex_count,
+               const GLuint* indices,
+               size_t index_count,
+               const std::vector<mesh_lod_t>& lods,
+               const std::vector<meshlet_t>& meshlets,
+               const std::vector<texture_t>& textures,
+               VERTEX_FORMAT vertex_format,
+               CPU_DATA_POLICY cpu_data_policy)
+       : m_vertices{},
+         m_indices{},
+         m_positions{},
          m_textures{textures},
-         m_buffers{}
+         m_material{textures},
+         m_geometry{0},
+         m_index_count{0},
+         m_index_type{GL_UNSIGNED_INT},
+         m_vertex_format{vertex_format},
+         m_position_transform{1.0f},
+         m_bounds{glm::vec3(0.0f), glm::vec3(0.0f)},
+         m_sphere{glm::vec3(0.0f), 0.0f},
+         m_cpu_data_policy{cpu_data_policy},
+         m_lods{lods},
+         m_meshlets{meshlets}
     {
-        this->setup_mesh();
+        if (this->m_lods.empty())
+        {
+            this->m_lods.push_back({0, static_cast<uint32_t>(index_count), 0.0f, 0, 0});
+        }
+
+        this->compute_bounds(vertices, vertex_count);
+
+        this->setup_mesh(vertices, vertex_count, indices, index_count);
+
+        this->apply_cpu_data_policy(vertices, vertex_count, indices, index_count);
     }
 
     buffers_t Mesh::get_buffers() const noexcept
     {
-        return this->m_buffers;
+        return CoreComponents::geometry_arena->get_buffers(this->m_vertex_format);
+    }
+
+    void Mesh::release()
+    {
+        CoreComponents::geometry_arena->release(this->m_geometry);
     }
 
-    void Mesh::draw(GLuint shader_program) const
+    asset_memory_t Mesh::get_memory_usage() const noexcept
     {
-        GLint textures_size = static_cast<GLint>(this->m_textures.size());
+        asset_memory_t memory{0, 0, 0};
+
+        memory.geometry_bytes = CoreComponents::geometry_arena->get_byte_size(this->m_geometry);
+        memory.cpu_bytes = this->m_vertices.capacity() * sizeof(vertex_t)
+            + this->m_indices.capacity() * sizeof(GLuint)
+            + this->m_positions.capacity() * sizeof(glm::vec3)
+            + this->m_lods.capacity() * sizeof(mesh_lod_t)
+            + this->m_meshlets.capacity() * sizeof(meshlet_t);
+
+        return memory;
+    }
+
+    const std::vector<vertex_t>& Mesh::get_vertices() const noexcept
+    {
+        return this->m_vertices;
+    }
 
-        //set textures
-        for (GLint idx = 0; idx < textures_size; idx++)
+    const std::vector<glm::vec3>& Mesh::get_positions() const noexcept
+    {
+        return this->m_positions;
+    }
+
+    const std::vector<GLuint>& Mesh::get_indices() const noexcept
+    {
+        return this->m_indices;
+    }
+
+    VERTEX_FORMAT Mesh::get_vertex_format() const noexcept
+    {
+        return this->m_vertex_format;
+    }
+
+    uint32_t Mesh::get_geometry() const noexcept
+    {
+        return this->m_geometry;
+    }
+
+    GLenum Mesh::get_index_type() const noexcept
+    {
+        return this->m_index_type;
+    }
+
+    const std::vector<mesh_lod_t>& Mesh::get_lods() const noexcept
+    {
+        return this->m_lods;
+    }
+
+    const glm::mat4& Mesh::get_position_transform() const noexcept
+    {
+        return this->m_position_transform;
+    }
+
+    const aabb_t& Mesh::get_bounds() const noexcept
+    {
+        return this->m_bounds;
+    }
+
+    const bounding_sphere_t& Mesh::get_bounding_sphere() const noexcept
+    {
+        return this->m_sphere;
+    }
+
+    const Material& Mesh::get_material() const noexcept
+    {
+        return this->m_material;
+    }
+
+    void Mesh::select_lod(float pixels_per_unit, const lod_settings_t& settings, mesh_draw_t& draw) const
+    {
+        // a draw that is new, or kept from a reloaded mesh with fewer levels, starts from the full level
+        if (settings.pixel_error <= 0.0f || draw.lod >= this->m_lods.size())
         {
-            glActiveTexture(GL_TEXTURE0 + idx);
+            draw.lod = 0;
+        }
+
+        if (settings.pixel_error <= 0.0f)
+        {
+            this->reset_draw_ranges(draw);
+            return;
+        }
+
+        auto coarsest_lod_within = [this, pixels_per_unit](float pixel_error)
+        {
+            size_t lod = 0;
 
-            GLint uniform_location
-                = glGetUniformLocation(shader_program, this->m_textures[idx].type.c_str());
+            // errors grow with the level, so the first level over the limit ends the search
+            while (lod + 1 < this->m_lods.size() && this->m_lods[lod + 1].error * pixels_per_unit <= pixel_error)
+            {
+                lod++;
+            }
 
-            glUniform1i(uniform_location, idx);
+            return lod;
+        };
 
-            glBindTexture(GL_TEXTURE_2D, this->m_textures[idx].id);
+        float current_error = this->m_lods[draw.lod].error * pixels_per_unit;
+
+        if (current_error > settings.pixel_error * (1.0f + settings.hysteresis))
+        {
+            draw.lod = coarsest_lod_within(settings.pixel_error);
+        }
+        else
+        {
+            draw.lod = std::max(draw.lod, coarsest_lod_within(settings.pixel_error * (1.0f - settings.hysteresis)));
         }
 
-        glBindVertexArray(this->m_buffers.VAO);
-        glDrawElements(GL_TRIANGLES, this->m_indices.size(), GL_UNSIGNED_INT, nullptr);
-        glBindVertexArray(0);
+        this->reset_draw_ranges(draw);
+    }
 
-        for(GLint i = 0; i < textures_size; i++)
+    void Mesh::cull_meshlets(const frustum_t& frustum, const glm::vec3& camera_position, mesh_draw_t& draw) const
+    {
+        const mesh_lod_t& lod = this->m_lods[draw.lod];
+
+        if (lod.meshlet_count == 0)
+        {
+            return;
+        }
+
+        draw.counts.clear();
+        draw.offsets.clear();
+        draw.index_count = 0;
+
+        for (uint32_t idx = lod.meshlet_offset; idx < lod.meshlet_offset + lod.meshlet_count; idx++)
         {
-            glActiveTexture(GL_TEXTURE0 + i);
-            glBindTexture(GL_TEXTURE_2D, 0);
+            const meshlet_t& meshlet = this->m_meshlets[idx];
+
+            if (!MeshletBuilder::is_culled(meshlet, frustum, camera_position))
+            {
+                this->add_draw_range(draw, meshlet.index_offset, meshlet.index_count);
+            }
         }
     }
 
-    void Mesh::setup_mesh()
+    void Mesh::draw(UniformTable& uniforms, const mesh_draw_t& draw) const
     {
-        // Create buffers/arrays
-        glGenVertexArrays(1, &this->m_buffers.VAO);
-        glGenBuffers(1, &this->m_buffers.VBO);
-        glGenBuffers(1, &this->m_buffers.EBO);
+        if (draw.counts.empty())
+        {
+            return;
+        }
 
-        glBindVertexArray(this->m_buffers.VAO);
-        // Load data into vertex buffers
-        glBindBuffer(GL_ARRAY_BUFFER, this->m_buffers.VBO);
-        glBufferData(GL_ARRAY_BUFFER, this->m_vertices.size() * sizeof(vertex_t), &this->m_vertices[0], GL_STATIC_DRAW);
+        this->m_material.bind(uniforms);
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->m_buffers.EBO);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->m_indices.size() * sizeof(GLuint), &this->m_indices[0], GL_STATIC_DRAW);
+        if (this->m_vertex_format == VERTEX_FORMAT::COMPACT && DrawComponents::shader)
+        {
+            // positions are stored relative to the mesh bounds, the model matrix takes them back to model space
+            uniforms.set(MODEL_UNIFORM, DrawComponents::shader->model_matrix * this->m_position_transform);
+        }
+
+        CoreComponents::geometry_arena->draw(this->m_geometry,
+                                             this->m_index_type,
+                                             draw.counts.data(),
+                                             draw.offsets.data(),
+                                             draw.counts.size());
+    }
 
-        // Set the vertex attribute pointers
-        // Vertex Positions
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(vertex_t), nullptr);
+    void Mesh::draw_instances(UniformTable& uniforms, const mesh_draw_t& draw, GLsizei instance_count) const
+    {
+        if (draw.counts.empty() || instance_count == 0)
+        {
+            return;
+        }
 
-        // Vertex Normals
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1,
-                              3,
-                              GL_FLOAT,
-                              GL_FALSE,
-                              sizeof(vertex_t),
-                              reinterpret_cast<GLvoid*>(offsetof(vertex_t, Normal)));
+        this->m_material.bind(uniforms);
+
+        uniforms.set(POSITION_TRANSFORM_UNIFORM, this->m_position_transform);
+
+        CoreComponents::geometry_arena->draw(this->m_geometry,
+                                             this->m_index_type,
+                                             draw.counts.data(),
+                                             draw.offsets.data(),
+                                             draw.counts.size(),
+                                             instance_count);
+    }
+
+    void Mesh::setup_mesh(const vertex_t* vertices,
+                          size_t vertex_count,
+                          const GLuint* indices,
+                          size_t index_count)
+    {
+        this->m_index_count = static_cast<GLsizei>(index_count);
 
-        // Vertex Texture Coords
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2,
-                              2,
-                              GL_FLOAT,
-                              GL_FALSE,
-                              sizeof(vertex_t),
-                              reinterpret_cast<GLvoid*>(offsetof(vertex_t, TexCoords)));
+        std::vector<compact_vertex_t> compact_vertices{};
+        const void* vertex_data = vertices;
+
+        if (this->m_vertex_format == VERTEX_FORMAT::COMPACT)
+        {
+            compact_vertices = this->quantize_vertices(vertices, vertex_count);
+            vertex_data = compact_vertices.data();
+        }
+
+        std::vector<GLushort> short_indices{};
+        const void* index_data = indices;
+        size_t index_byte_size = index_count * sizeof(GLuint);
+
+        // indices are relative to the first vertex of the mesh, so they fit 16 bits wherever the arena puts it
+        if (this->m_vertex_format == VERTEX_FORMAT::COMPACT && vertex_count < MAX_SHORT_INDEX_VERTICES)
+        {
+            short_indices.assign(indices, indices + index_count);
+
+            this->m_index_type = GL_UNSIGNED_SHORT;
+            index_data = short_indices.data();
+            index_byte_size = index_count * sizeof(GLushort);
+        }
+        else
+        {
+            this->m_index_type = GL_UNSIGNED_INT;
+        }
 
-        glBindVertexArray(0);
+        this->m_geometry = CoreComponents::geometry_arena->allocate(this->m_vertex_format,
+                                                                    vertex_data,
+                                                                    vertex_count,
+                                                                    index_data,
+                                                                    index_byte_size);
     }
 
 ////////////////////////////////////////////////////////////////////////////////
 // Private Functions
 ////////////////////////////////////////////////////////////////////////////////
 
+    void Mesh::compute_bounds(const vertex_t* vertices, size_t vertex_count)
+    {
+        if (vertex_count == 0)
+        {
+            return;
+        }
+
+        this->m_bounds = {vertices[0].Position, vertices[0].Position};
+
+        for (size_t idx = 1; idx < vertex_count; idx++)
+        {
+            this->m_bounds.min = glm::min(this->m_bounds.min, vertices[idx].Position);
+            this->m_bounds.max = glm::max(this->m_bounds.max, vertices[idx].Position);
+        }
+
+        // centered on the box, but only as large as the farthest vertex, which is tighter than half the diagonal
+        glm::vec3 center = (this->m_bounds.min + this->m_bounds.max) * 0.5f;
+        float radius_squared = 0.0f;
+
+        for (size_t idx = 0; idx < vertex_count; idx++)
+        {
+            glm::vec3 offset = vertices[idx].Position - center;
+
+            radius_squared = std::max(radius_squared, glm::dot(offset, offset));
+        }
+
+        this->m_sphere = {center, std::sqrt(radius_squared)};
+    }
+
+    std::vector<compact_vertex_t> Mesh::quantize_vertices(const vertex_t* vertices, size_t vertex_count)
+    {
+        const glm::vec3& bounds_min = this->m_bounds.min;
+
+        glm::vec3 extent = this->m_bounds.max - bounds_min;
+        glm::vec3 inverse_extent(0.0f);
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            inverse_extent[axis] = extent[axis] > 0.0f ? 1.0f / extent[axis] : 0.0f;
+        }
+
+        this->m_position_transform = glm::scale(glm::translate(glm::mat4(1.0f), bounds_min), extent);
+
+        std::vector<compact_vertex_t> compact_vertices(vertex_count);
+
+        for (size_t idx = 0; idx < vertex_count; idx++)
+        {
+            const vertex_t& vertex = vertices[idx];
+            compact_vertex_t& compact_vertex = compact_vertices[idx];
+
+            glm::vec3 position = (vertex.Position - bounds_min) * inverse_extent;
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                compact_vertex.Position[axis]
+                    = static_cast<uint16_t>(std::lround(std::clamp(position[axis], 0.0f, 1.0f) * 65535.0f));
+            }
+
+            compact_vertex.Position[3] = 0;
+
+            float normal_length = glm::length(vertex.Normal);
+            glm::vec3 normal = normal_length > 0.0f ? vertex.Normal / normal_length : glm::vec3(0.0f);
+
+            compact_vertex.Normal = glm::packSnorm3x10_1x2(glm::vec4(normal, 0.0f));
+            compact_vertex.TexCoords = glm::packHalf2x16(vertex.TexCoords);
+        }
+
+        return compact_vertices;
+    }
+
+    void Mesh::apply_cpu_data_policy(const vertex_t* vertices,
+                                     size_t vertex_count,
+                                     const GLuint* indices,
+                                     size_t index_count)
+    {
+        switch (this->m_cpu_data_policy)
+        {
+            case CPU_DATA_POLICY::KEEP_ALL:
+            {
+                // blobs are copied, vectors the mesh took over are kept as they are
+                if (this->m_vertices.data() != vertices)
+                {
+                    this->m_vertices.assign(vertices, vertices + vertex_count);
+                }
+
+                if (this->m_indices.data() != indices)
+                {
+                    this->m_indices.assign(indices, indices + index_count);
+                }
+
+                break;
+            }
+            case CPU_DATA_POLICY::KEEP_POSITIONS:
+            {
+                this->m_positions.resize(vertex_count);
+
+                for (size_t idx = 0; idx < vertex_count; idx++)
+                {
+                    this->m_positions[idx] = vertices[idx].Position;
+                }
+
+                const mesh_lod_t& full_lod = this->m_lods.front();
+
+                // copied before assigning, the source may be the vector that is replaced
+                std::vector<GLuint> full_indices(indices + full_lod.index_offset,
+                                                 indices + full_lod.index_offset + full_lod.index_count);
+
+                this->m_indices = std::move(full_indices);
+                this->m_vertices = std::vector<vertex_t>{};
+
+                break;
+            }
+            case CPU_DATA_POLICY::RELEASE:
+            {
+                this->m_vertices = std::vector<vertex_t>{};
+                this->m_indices = std::vector<GLuint>{};
+
+                break;
+            }
+        }
+    }
+
+    void Mesh::reset_draw_ranges(mesh_draw_t& draw) const
+    {
+        const mesh_lod_t& lod = this->m_lods[draw.lod];
+
+        draw.counts.clear();
+        draw.offsets.clear();
+        draw.index_count = 0;
+
+        this->add_draw_range(draw, lod.index_offset, lod.index_count);
+    }
+
+    void Mesh::add_draw_range(mesh_draw_t& draw, uint32_t index_offset, uint32_t index_count) const
+    {
+        if (index_count == 0)
+        {
+            return;
+        }
+
+        size_t index_size = this->m_index_type == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+        size_t byte_offset = index_offset * index_size;
+
+        draw.index_count += index_count;
+
+        // neighbouring meshlets are stored back to back, so runs of visible ones collapse into one range
+        if (!draw.counts.empty())
+        {
+            size_t previous_end = draw.offsets.back() + static_cast<size_t>(draw.counts.back()) * index_size;
+
+            if (previous_end == byte_offset)
+            {
+                draw.counts.back() += static_cast<GLsizei>(index_count);
+                return;
+            }
+        }
+
+        draw.counts.push_back(static_cast<GLsizei>(index_count));
+        draw.offsets.push_back(byte_offset);
+    }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Protected Functions
 ////////////////////////////////////////////////////////////////////////////////
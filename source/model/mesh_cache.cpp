@@ -0,0 +1,478 @@
+///
+/// @file mesh_cache.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the MeshCache class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string_view>
+#include "mesh_cache.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr char MESH_CACHE_MAGIC[8] = {'Y', 'B', 'M', 'E', 'S', 'H', '\0', '\0'}; ///< File signature.
+    constexpr uint32_t MESH_CACHE_VERSION = 3; ///< Bumped whenever the layout of the file changes.
+    constexpr size_t MESH_CACHE_ALIGNMENT = 16; ///< Alignment of the vertex and index blobs.
+
+    ///
+    /// @struct mesh_cache_header_s
+    /// @brief Fixed size header at the start of a cache file.
+    ///
+    typedef struct mesh_cache_header_s
+    {
+        char magic[8]; ///< Always MESH_CACHE_MAGIC.
+        uint32_t version; ///< Always MESH_CACHE_VERSION.
+        uint32_t vertex_size; ///< sizeof(vertex_t) of the writer.
+        uint64_t settings_hash; ///< Hash of the import settings.
+        uint32_t source_count; ///< Number of source file records.
+        uint32_t mesh_count; ///< Number of mesh records.
+    } mesh_cache_header_t;
+
+    ///
+    /// @brief Appends the bytes of a value to a buffer.
+    ///
+    template <typename T>
+    static void append_value(std::vector<char>& buffer, const T& value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    ///
+    /// @brief Appends a length prefixed string to a buffer.
+    ///
+    static void append_string(std::vector<char>& buffer, const std::string& text)
+    {
+        append_value(buffer, static_cast<uint32_t>(text.size()));
+        buffer.insert(buffer.end(), text.begin(), text.end());
+    }
+
+    ///
+    /// @brief Pads a buffer with zeros up to the blob alignment.
+    ///
+    static void append_padding(std::vector<char>& buffer)
+    {
+        size_t padding = (MESH_CACHE_ALIGNMENT - buffer.size() % MESH_CACHE_ALIGNMENT) % MESH_CACHE_ALIGNMENT;
+        buffer.insert(buffer.end(), padding, '\0');
+    }
+
+    ///
+    /// @struct cache_reader_s
+    /// @brief Bounds checked cursor over the mapped cache file.
+    ///
+    typedef struct cache_reader_s
+    {
+        const char* data; ///< First byte of the file.
+        size_t size; ///< Size of the file.
+        size_t offset; ///< Current read position.
+
+        template <typename T>
+        bool read_value(T& value)
+        {
+            if (this->size - this->offset < sizeof(T))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, this->data + this->offset, sizeof(T));
+            this->offset += sizeof(T);
+            return true;
+        }
+
+        bool read_string(std::string& text)
+        {
+            uint32_t length = 0;
+
+            if (!this->read_value(length) || this->size - this->offset < length)
+            {
+                return false;
+            }
+
+            text.assign(this->data + this->offset, length);
+            this->offset += length;
+            return true;
+        }
+
+        const char* read_blob(size_t blob_size)
+        {
+            this->offset += (MESH_CACHE_ALIGNMENT - this->offset % MESH_CACHE_ALIGNMENT) % MESH_CACHE_ALIGNMENT;
+
+            if (this->offset > this->size || this->size - this->offset < blob_size)
+            {
+                return nullptr;
+            }
+
+            const char* blob = this->data + this->offset;
+            this->offset += blob_size;
+            return blob;
+        }
+    } cache_reader_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    MeshCache::MeshCache(const std::string& model_file_path, uint64_t settings_hash)
+        : m_model_file_path{model_file_path},
+          m_cache_path{model_file_path + ".ybmesh"},
+          m_settings_hash{settings_hash},
+          m_mapped_file{nullptr},
+          m_mesh_record_count{0}
+    {
+    }
+
+    bool MeshCache::load()
+    {
+        this->m_meshes.clear();
+        this->m_mapped_file = std::make_unique<MappedFile>(this->m_cache_path);
+
+        if (!this->m_mapped_file->is_open())
+        {
+            this->m_mapped_file.reset();
+            return false;
+        }
+
+        cache_reader_t reader{this->m_mapped_file->data(), this->m_mapped_file->size(), 0};
+
+        mesh_cache_header_t header{};
+
+        bool valid = reader.read_value(header) &&
+                     std::memcmp(header.magic, MESH_CACHE_MAGIC, sizeof(MESH_CACHE_MAGIC)) == 0 &&
+                     header.version == MESH_CACHE_VERSION &&
+                     header.vertex_size == sizeof(vertex_t) &&
+                     header.settings_hash == this->m_settings_hash;
+
+        // every source file must still have the size and time the cache was built from
+        for (uint32_t idx = 0; valid && idx < header.source_count; idx++)
+        {
+            source_file_t stored{};
+            source_file_t current{};
+
+            valid = reader.read_string(stored.path) &&
+                    reader.read_value(stored.size) &&
+                    reader.read_value(stored.modification_time) &&
+                    stat_source_file(stored.path, current) &&
+                    stored.size == current.size &&
+                    stored.modification_time == current.modification_time;
+        }
+
+        for (uint32_t idx = 0; valid && idx < header.mesh_count; idx++)
+        {
+            mesh_blob_t mesh{};
+            uint64_t vertex_count = 0;
+            uint64_t index_count = 0;
+            uint32_t lod_count = 0;
+            uint32_t meshlet_count = 0;
+            uint32_t texture_count = 0;
+
+            valid = reader.read_value(vertex_count) &&
+                    reader.read_value(index_count) &&
+                    reader.read_value(mesh.bounds) &&
+                    reader.read_value(lod_count);
+
+            for (uint32_t lod_idx = 0; valid && lod_idx < lod_count; lod_idx++)
+            {
+                mesh_lod_t lod{};
+                valid = reader.read_value(lod) &&
+                        lod.index_offset <= index_count &&
+                        lod.index_count <= index_count - lod.index_offset;
+                mesh.lods.push_back(lod);
+            }
+
+            valid = valid && reader.read_value(meshlet_count);
+
+            for (uint32_t meshlet_idx = 0; valid && meshlet_idx < meshlet_count; meshlet_idx++)
+            {
+                meshlet_t meshlet{};
+                valid = reader.read_value(meshlet) &&
+                        meshlet.index_offset <= index_count &&
+                        meshlet.index_count <= index_count - meshlet.index_offset;
+                mesh.meshlets.push_back(meshlet);
+            }
+
+            for (const auto& lod: mesh.lods)
+            {
+                valid = valid &&
+                        lod.meshlet_offset <= meshlet_count &&
+                        lod.meshlet_count <= meshlet_count - lod.meshlet_offset;
+            }
+
+            valid = valid && reader.read_value(texture_count);
+
+            for (uint32_t texture_idx = 0; valid && texture_idx < texture_count; texture_idx++)
+            {
+                texture_ref_t texture{};
+                valid = reader.read_string(texture.type) && reader.read_string(texture.path);
+                mesh.textures.push_back(texture);
+            }
+
+            const char* vertex_blob = valid ? reader.read_blob(vertex_count * sizeof(vertex_t)) : nullptr;
+            const char* index_blob = valid ? reader.read_blob(index_count * sizeof(GLuint)) : nullptr;
+
+            valid = vertex_blob != nullptr && index_blob != nullptr;
+
+            mesh.vertices = reinterpret_cast<const vertex_t*>(vertex_blob);
+            mesh.vertex_count = static_cast<size_t>(vertex_count);
+            mesh.indices = reinterpret_cast<const GLuint*>(index_blob);
+            mesh.index_count = static_cast<size_t>(index_count);
+
+            this->m_meshes.push_back(std::move(mesh));
+        }
+
+        if (!valid)
+        {
+            this->m_meshes.clear();
+            this->m_mapped_file.reset();
+        }
+
+        return valid;
+    }
+
+    const std::vector<mesh_blob_t>& MeshCache::get_meshes() const noexcept
+    {
+        return this->m_meshes;
+    }
+
+    void MeshCache::add_mesh(const std::vector<vertex_t>& vertices,
+                             const std::vector<GLuint>& indices,
+                             const std::vector<mesh_lod_t>& lods,
+                             const std::vector<meshlet_t>& meshlets,
+                             const std::vector<texture_ref_t>& textures,
+                             const aabb_t& bounds)
+    {
+        std::vector<char>& records = this->m_mesh_records;
+
+        // the blobs dominate the record, reserving for them up front grows the buffer once per mesh at most
+        size_t record_size = vertices.size() * sizeof(vertex_t) +
+                             indices.size() * sizeof(GLuint) +
+                             lods.size() * sizeof(mesh_lod_t) +
+                             meshlets.size() * sizeof(meshlet_t) +
+                             4 * MESH_CACHE_ALIGNMENT;
+
+        if (records.capacity() < records.size() + record_size)
+        {
+            records.reserve(std::max(records.size() + record_size, records.capacity() * 2));
+        }
+
+        append_value(records, static_cast<uint64_t>(vertices.size()));
+        append_value(records, static_cast<uint64_t>(indices.size()));
+        append_value(records, bounds);
+        append_value(records, static_cast<uint32_t>(lods.size()));
+
+        for (const auto& lod: lods)
+        {
+            append_value(records, lod);
+        }
+
+        append_value(records, static_cast<uint32_t>(meshlets.size()));
+
+        for (const auto& meshlet: meshlets)
+        {
+            append_value(records, meshlet);
+        }
+
+        append_value(records, static_cast<uint32_t>(textures.size()));
+
+        for (const auto& texture: textures)
+        {
+            append_string(records, texture.type);
+            append_string(records, texture.path);
+        }
+
+        append_padding(records);
+        const char* vertex_bytes = reinterpret_cast<const char*>(vertices.data());
+        records.insert(records.end(), vertex_bytes, vertex_bytes + vertices.size() * sizeof(vertex_t));
+
+        append_padding(records);
+        const char* index_bytes = reinterpret_cast<const char*>(indices.data());
+        records.insert(records.end(), index_bytes, index_bytes + indices.size() * sizeof(GLuint));
+
+        this->m_mesh_record_count++;
+    }
+
+    bool MeshCache::save()
+    {
+        std::vector<source_file_t> source_files = this->collect_source_files();
+
+        if (source_files.empty())
+        {
+            return false;
+        }
+
+        mesh_cache_header_t header{};
+        std::memcpy(header.magic, MESH_CACHE_MAGIC, sizeof(MESH_CACHE_MAGIC));
+        header.version = MESH_CACHE_VERSION;
+        header.vertex_size = sizeof(vertex_t);
+        header.settings_hash = this->m_settings_hash;
+        header.source_count = static_cast<uint32_t>(source_files.size());
+        header.mesh_count = this->m_mesh_record_count;
+
+        std::vector<char> buffer{};
+        buffer.reserve(sizeof(header) + this->m_mesh_records.size() + 1024);
+
+        append_value(buffer, header);
+
+        for (const auto& source_file: source_files)
+        {
+            append_string(buffer, source_file.path);
+            append_value(buffer, source_file.size);
+            append_value(buffer, source_file.modification_time);
+        }
+
+        // records are padded relative to their own start, so they have to start aligned
+        append_padding(buffer);
+        buffer.insert(buffer.end(), this->m_mesh_records.begin(), this->m_mesh_records.end());
+
+        // the records hold a copy of every mesh, they are not needed once serialized
+        this->m_mesh_records = std::vector<char>{};
+        this->m_mesh_record_count = 0;
+
+        // write next to the cache and rename, so a reader never sees half a file
+        std::string temporary_path = this->m_cache_path + ".tmp";
+
+        {
+            std::ofstream cache_file(temporary_path, std::ios::binary | std::ios::trunc);
+
+            if (!cache_file)
+            {
+                std::cerr << "WARNING: could not write mesh cache " << this->m_cache_path << "\n";
+                return false;
+            }
+
+            cache_file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+            if (!cache_file)
+            {
+                std::cerr << "WARNING: could not write mesh cache " << this->m_cache_path << "\n";
+                return false;
+            }
+        }
+
+        std::error_code error{};
+        std::filesystem::rename(temporary_path, this->m_cache_path, error);
+
+        if (error)
+        {
+            std::filesystem::remove(temporary_path, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    const std::string& MeshCache::get_cache_path() const noexcept
+    {
+        return this->m_cache_path;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<MeshCache::source_file_t> MeshCache::collect_source_files() const
+    {
+        std::vector<source_file_t> source_files{};
+        source_file_t model_file{};
+
+        if (!stat_source_file(this->m_model_file_path, model_file))
+        {
+            return source_files;
+        }
+
+        source_files.push_back(model_file);
+
+        // material libraries are found by scanning the mtllib statements of the .obj
+        MappedFile obj_file(this->m_model_file_path);
+
+        if (!obj_file.is_open())
+        {
+            return source_files;
+        }
+
+        std::filesystem::path base_path = std::filesystem::path(this->m_model_file_path).parent_path();
+        std::string_view text(obj_file.data(), obj_file.size());
+        constexpr std::string_view keyword = "mtllib";
+
+        for (size_t position = text.find(keyword);
+             position != std::string_view::npos;
+             position = text.find(keyword, position + keyword.size()))
+        {
+            if (position != 0 && text[position - 1] != '\n')
+            {
+                continue;
+            }
+
+            size_t line_end = text.find('\n', position);
+            std::string line(text.substr(position + keyword.size(),
+                                         line_end == std::string_view::npos ? std::string_view::npos
+                                                                            : line_end - position - keyword.size()));
+
+            std::istringstream line_stream(line);
+            std::string library_name{};
+
+            while (line_stream >> library_name)
+            {
+                source_file_t library_file{};
+
+                if (stat_source_file((base_path / library_name).string(), library_file))
+                {
+                    source_files.push_back(library_file);
+                }
+            }
+        }
+
+        return source_files;
+    }
+
+    bool MeshCache::stat_source_file(const std::string& path, source_file_t& source_file)
+    {
+        std::error_code error{};
+
+        auto file_size = std::filesystem::file_size(path, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        auto write_time = std::filesystem::last_write_time(path, error);
+
+        if (error)
+        {
+            return false;
+        }
+
+        source_file.path = path;
+        source_file.size = static_cast<int64_t>(file_size);
+        source_file.modification_time = static_cast<int64_t>(write_time.time_since_epoch().count());
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
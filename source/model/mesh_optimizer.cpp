@@ -0,0 +1,431 @@
+///
+/// @file mesh_optimizer.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the MeshOptimizer class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include "mesh_optimizer.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr float OVERDRAW_CLUSTER_THRESHOLD = 1.05f; ///< A cluster may end once its ACMR is within 5% of the mesh ACMR.
+
+    ///
+    /// @brief Computes twice the area weighted normal of a triangle.
+    ///
+    static glm::vec3 triangle_normal(const std::vector<vertex_t>& vertices, const GLuint* triangle)
+    {
+        glm::vec3 edge_1 = vertices[triangle[1]].Position - vertices[triangle[0]].Position;
+        glm::vec3 edge_2 = vertices[triangle[2]].Position - vertices[triangle[0]].Position;
+
+        return {edge_1.y * edge_2.z - edge_1.z * edge_2.y,
+                edge_1.z * edge_2.x - edge_1.x * edge_2.z,
+                edge_1.x * edge_2.y - edge_1.y * edge_2.x};
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    MeshOptimizer::MeshOptimizer(size_t cache_size)
+        : m_cache_size{cache_size > 3 ? cache_size : 3}
+    {
+    }
+
+    void MeshOptimizer::optimize(std::vector<vertex_t>& vertices, std::vector<GLuint>& indices) const
+    {
+        remove_degenerate_triangles(vertices, indices);
+
+        this->reorder_triangles(vertices, indices);
+
+        optimize_vertex_fetch(vertices, indices);
+    }
+
+    void MeshOptimizer::reorder_triangles(const std::vector<vertex_t>& vertices, std::vector<GLuint>& indices) const
+    {
+        std::vector<size_t> hard_boundaries = this->optimize_vertex_cache(indices, vertices.size());
+
+        this->optimize_overdraw(vertices, indices, hard_boundaries);
+    }
+
+    vertex_cache_stats_t MeshOptimizer::analyze(const std::vector<GLuint>& indices, size_t vertex_count) const
+    {
+        vertex_cache_stats_t stats{indices.size() / 3, 0, 0};
+
+        // a vertex is in the cache while fewer than m_cache_size vertices entered after it
+        std::vector<size_t> cache_time(vertex_count, 0);
+        std::vector<bool> referenced(vertex_count, false);
+        size_t timestamp = this->m_cache_size + 1;
+
+        for (GLuint index: indices)
+        {
+            if (timestamp - cache_time[index] > this->m_cache_size)
+            {
+                cache_time[index] = timestamp++;
+                stats.cache_misses++;
+            }
+
+            if (!referenced[index])
+            {
+                referenced[index] = true;
+                stats.vertex_count++;
+            }
+        }
+
+        return stats;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void MeshOptimizer::remove_degenerate_triangles(const std::vector<vertex_t>& vertices, std::vector<GLuint>& indices)
+    {
+        size_t write = 0;
+
+        for (size_t read = 0; read + 2 < indices.size(); read += 3)
+        {
+            const GLuint* triangle = &indices[read];
+
+            if (triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[0] == triangle[2])
+            {
+                continue;
+            }
+
+            if (triangle_normal(vertices, triangle) == glm::vec3(0.0f))
+            {
+                continue;
+            }
+
+            indices[write++] = triangle[0];
+            indices[write++] = triangle[1];
+            indices[write++] = triangle[2];
+        }
+
+        indices.resize(write);
+    }
+
+    std::vector<size_t> MeshOptimizer::optimize_vertex_cache(std::vector<GLuint>& indices, size_t vertex_count) const
+    {
+        const size_t triangle_count = indices.size() / 3;
+
+        // triangles around every vertex, stored as one array with per-vertex offsets
+        std::vector<uint32_t> live_triangles(vertex_count, 0);
+        std::vector<size_t> adjacency_offsets(vertex_count + 1, 0);
+        std::vector<uint32_t> adjacency(indices.size());
+
+        for (GLuint index: indices)
+        {
+            live_triangles[index]++;
+        }
+
+        for (size_t idx = 0; idx < vertex_count; idx++)
+        {
+            adjacency_offsets[idx + 1] = adjacency_offsets[idx] + live_triangles[idx];
+        }
+
+        {
+            std::vector<size_t> fill_offsets(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+
+            for (size_t idx = 0; idx < indices.size(); idx++)
+            {
+                adjacency[fill_offsets[indices[idx]]++] = static_cast<uint32_t>(idx / 3);
+            }
+        }
+
+        std::vector<size_t> cache_time(vertex_count, 0);
+        std::vector<bool> emitted(triangle_count, false);
+        std::vector<GLuint> dead_end_stack{};
+        std::vector<GLuint> candidates{};
+        std::vector<GLuint> output{};
+        std::vector<size_t> hard_boundaries{};
+        size_t timestamp = this->m_cache_size + 1;
+        size_t scan_cursor = 0;
+
+        dead_end_stack.reserve(indices.size());
+        output.reserve(indices.size());
+
+        constexpr size_t NO_VERTEX = std::numeric_limits<size_t>::max();
+
+        // recently used vertices first, then the next vertex in input order
+        auto skip_dead_end = [&]() -> size_t
+        {
+            while (!dead_end_stack.empty())
+            {
+                GLuint vertex = dead_end_stack.back();
+                dead_end_stack.pop_back();
+
+                if (live_triangles[vertex] > 0)
+                {
+                    return vertex;
+                }
+            }
+
+            for (; scan_cursor < vertex_count; scan_cursor++)
+            {
+                if (live_triangles[scan_cursor] > 0)
+                {
+                    return scan_cursor;
+                }
+            }
+
+            return NO_VERTEX;
+        };
+
+        size_t fanning_vertex = skip_dead_end();
+
+        if (fanning_vertex != NO_VERTEX)
+        {
+            hard_boundaries.push_back(0);
+        }
+
+        while (fanning_vertex != NO_VERTEX)
+        {
+            candidates.clear();
+
+            for (size_t slot = adjacency_offsets[fanning_vertex]; slot < adjacency_offsets[fanning_vertex + 1]; slot++)
+            {
+                uint32_t triangle = adjacency[slot];
+
+                if (emitted[triangle])
+                {
+                    continue;
+                }
+
+                emitted[triangle] = true;
+
+                for (int corner = 0; corner < 3; corner++)
+                {
+                    GLuint vertex = indices[triangle * 3 + corner];
+
+                    output.push_back(vertex);
+                    dead_end_stack.push_back(vertex);
+                    candidates.push_back(vertex);
+                    live_triangles[vertex]--;
+
+                    if (timestamp - cache_time[vertex] > this->m_cache_size)
+                    {
+                        cache_time[vertex] = timestamp++;
+                    }
+                }
+            }
+
+            // prefer the vertex that stays in the cache longest while all its triangles are emitted
+            size_t next_vertex = NO_VERTEX;
+            size_t best_priority = 0;
+
+            for (GLuint vertex: candidates)
+            {
+                if (live_triangles[vertex] == 0)
+                {
+                    continue;
+                }
+
+                size_t age = timestamp - cache_time[vertex];
+                size_t priority = age + 2 * live_triangles[vertex] <= this->m_cache_size ? age + 1 : 1;
+
+                if (priority > best_priority)
+                {
+                    best_priority = priority;
+                    next_vertex = vertex;
+                }
+            }
+
+            if (next_vertex == NO_VERTEX)
+            {
+                next_vertex = skip_dead_end();
+
+                if (next_vertex != NO_VERTEX)
+                {
+                    hard_boundaries.push_back(output.size() / 3);
+                }
+            }
+
+            fanning_vertex = next_vertex;
+        }
+
+        indices.swap(output);
+
+        return hard_boundaries;
+    }
+
+    void MeshOptimizer::optimize_overdraw(const std::vector<vertex_t>& vertices,
+                                          std::vector<GLuint>& indices,
+                                          const std::vector<size_t>& hard_boundaries) const
+    {
+        const size_t triangle_count = indices.size() / 3;
+
+        if (triangle_count == 0)
+        {
+            return;
+        }
+
+        vertex_cache_stats_t mesh_stats = this->analyze(indices, vertices.size());
+        const float threshold
+            = OVERDRAW_CLUSTER_THRESHOLD * static_cast<float>(mesh_stats.cache_misses) / static_cast<float>(triangle_count);
+
+        // cut a cluster as soon as its own ACMR is close to the mesh ACMR, the cache starts cold in every cluster
+        std::vector<size_t> clusters{};
+        std::vector<size_t> cache_time(vertices.size(), 0);
+        size_t timestamp = this->m_cache_size + 1;
+
+        for (size_t hard_idx = 0; hard_idx < hard_boundaries.size(); hard_idx++)
+        {
+            size_t end = hard_idx + 1 < hard_boundaries.size() ? hard_boundaries[hard_idx + 1] : triangle_count;
+            size_t start = hard_boundaries[hard_idx];
+            size_t misses = 0;
+
+            clusters.push_back(start);
+            timestamp += this->m_cache_size + 1;
+
+            for (size_t triangle = start; triangle < end; triangle++)
+            {
+                for (int corner = 0; corner < 3; corner++)
+                {
+                    GLuint vertex = indices[triangle * 3 + corner];
+
+                    if (timestamp - cache_time[vertex] > this->m_cache_size)
+                    {
+                        cache_time[vertex] = timestamp++;
+                        misses++;
+                    }
+                }
+
+                if (triangle + 1 < end &&
+                    static_cast<float>(misses) <= threshold * static_cast<float>(triangle + 1 - start))
+                {
+                    start = triangle + 1;
+                    misses = 0;
+                    clusters.push_back(start);
+                    timestamp += this->m_cache_size + 1;
+                }
+            }
+        }
+
+        // area weighted centroids and normals of the mesh and of every cluster
+        glm::vec3 mesh_centroid(0.0f);
+        float mesh_area = 0.0f;
+
+        std::vector<glm::vec3> cluster_centroids(clusters.size(), glm::vec3(0.0f));
+        std::vector<glm::vec3> cluster_normals(clusters.size(), glm::vec3(0.0f));
+
+        for (size_t cluster = 0; cluster < clusters.size(); cluster++)
+        {
+            size_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangle_count;
+            float cluster_area = 0.0f;
+
+            for (size_t triangle = clusters[cluster]; triangle < end; triangle++)
+            {
+                const GLuint* corners = &indices[triangle * 3];
+
+                glm::vec3 normal = triangle_normal(vertices, corners);
+                glm::vec3 centroid = (vertices[corners[0]].Position +
+                                      vertices[corners[1]].Position +
+                                      vertices[corners[2]].Position) / 3.0f;
+                float area = glm::length(normal);
+
+                cluster_centroids[cluster] += centroid * area;
+                cluster_normals[cluster] += normal;
+                cluster_area += area;
+            }
+
+            mesh_centroid += cluster_centroids[cluster];
+            mesh_area += cluster_area;
+
+            if (cluster_area > 0.0f)
+            {
+                cluster_centroids[cluster] /= cluster_area;
+            }
+        }
+
+        if (mesh_area > 0.0f)
+        {
+            mesh_centroid /= mesh_area;
+        }
+
+        std::vector<float> sort_keys(clusters.size(), 0.0f);
+        std::vector<size_t> cluster_order(clusters.size());
+
+        for (size_t cluster = 0; cluster < clusters.size(); cluster++)
+        {
+            float normal_length = glm::length(cluster_normals[cluster]);
+
+            if (normal_length > 0.0f)
+            {
+                sort_keys[cluster]
+                    = glm::dot(cluster_centroids[cluster] - mesh_centroid, cluster_normals[cluster] / normal_length);
+            }
+
+            cluster_order[cluster] = cluster;
+        }
+
+        // clusters facing away from the center are the likeliest occluders, draw them first
+        std::stable_sort(cluster_order.begin(), cluster_order.end(), [&sort_keys](size_t lhs, size_t rhs)
+        {
+            return sort_keys[lhs] > sort_keys[rhs];
+        });
+
+        std::vector<GLuint> output{};
+        output.reserve(indices.size());
+
+        for (size_t cluster: cluster_order)
+        {
+            size_t end = cluster + 1 < clusters.size() ? clusters[cluster + 1] : triangle_count;
+
+            output.insert(output.end(),
+                          indices.begin() + static_cast<std::ptrdiff_t>(clusters[cluster] * 3),
+                          indices.begin() + static_cast<std::ptrdiff_t>(end * 3));
+        }
+
+        indices.swap(output);
+    }
+
+    void MeshOptimizer::optimize_vertex_fetch(std::vector<vertex_t>& vertices, std::vector<GLuint>& indices)
+    {
+        constexpr GLuint UNUSED_VERTEX = std::numeric_limits<GLuint>::max();
+
+        std::vector<GLuint> remap(vertices.size(), UNUSED_VERTEX);
+        std::vector<vertex_t> output{};
+        output.reserve(vertices.size());
+
+        for (GLuint& index: indices)
+        {
+            if (remap[index] == UNUSED_VERTEX)
+            {
+                remap[index] = static_cast<GLuint>(output.size());
+                output.push_back(vertices[index]);
+            }
+
+            index = remap[index];
+        }
+
+        vertices.swap(output);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,507 @@
+///
+/// @file mesh_simplifier.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the MeshSimplifier class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include "hash_utils.hpp"
+#include "mesh_simplifier.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ///
+    /// @struct collapse_s
+    /// @brief An edge collapse candidate, moving one position onto another.
+    ///
+    typedef struct collapse_s
+    {
+        GLuint from; ///< Position that is removed.
+        GLuint to; ///< Position that is kept.
+        double cost; ///< Quadric error at the kept position.
+    } collapse_t;
+
+    ///
+    /// @brief Computes the unnormalized normal of a triangle, its length is twice the area.
+    ///
+    static glm::vec3 cross_product(const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p2)
+    {
+        glm::vec3 edge_1 = p1 - p0;
+        glm::vec3 edge_2 = p2 - p0;
+
+        return {edge_1.y * edge_2.z - edge_1.z * edge_2.y,
+                edge_1.z * edge_2.x - edge_1.x * edge_2.z,
+                edge_1.x * edge_2.y - edge_1.y * edge_2.x};
+    }
+
+    ///
+    /// @brief Builds an order independent key of an edge between two positions.
+    ///
+    static uint64_t edge_key(GLuint a, GLuint b)
+    {
+        return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+    }
+
+    ///
+    /// @brief Hash functor for positions, consistent with comparing them with ==.
+    ///
+    struct position_hash
+    {
+        size_t operator()(const glm::vec3& position) const noexcept
+        {
+            // adding zero turns -0 into +0, which compares equal
+            float components[3] = {position.x + 0.0f, position.y + 0.0f, position.z + 0.0f};
+
+            return static_cast<size_t>(fnv1a_hash(components, sizeof(components)));
+        }
+    };
+
+    ///
+    /// @brief Measures how different the attributes of two vertices are.
+    ///
+    static float attribute_distance(const vertex_t& lhs, const vertex_t& rhs)
+    {
+        glm::vec3 normal_delta = lhs.Normal - rhs.Normal;
+        glm::vec2 uv_delta = lhs.TexCoords - rhs.TexCoords;
+
+        return glm::dot(normal_delta, normal_delta) + glm::dot(uv_delta, uv_delta);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    float MeshSimplifier::simplify(const std::vector<vertex_t>& vertices,
+                                   const std::vector<GLuint>& indices,
+                                   size_t target_index_count,
+                                   std::vector<GLuint>& output)
+    {
+        // group the vertices that share a position, seams collapse as one
+        std::unordered_map<glm::vec3, GLuint, position_hash> position_lookup{};
+        std::vector<GLuint> vertex_positions(vertices.size());
+        std::vector<glm::vec3> positions{};
+
+        position_lookup.reserve(vertices.size());
+
+        for (size_t idx = 0; idx < vertices.size(); idx++)
+        {
+            auto inserted = position_lookup.emplace(vertices[idx].Position, static_cast<GLuint>(positions.size()));
+
+            if (inserted.second)
+            {
+                positions.push_back(vertices[idx].Position);
+            }
+
+            vertex_positions[idx] = inserted.first->second;
+        }
+
+        const size_t position_count = positions.size();
+
+        std::vector<size_t> position_vertex_offsets(position_count + 1, 0);
+        std::vector<GLuint> position_vertices(vertices.size());
+
+        for (GLuint position: vertex_positions)
+        {
+            position_vertex_offsets[position + 1]++;
+        }
+
+        for (size_t idx = 0; idx < position_count; idx++)
+        {
+            position_vertex_offsets[idx + 1] += position_vertex_offsets[idx];
+        }
+
+        {
+            std::vector<size_t> fill_offsets(position_vertex_offsets.begin(), position_vertex_offsets.end() - 1);
+
+            for (size_t idx = 0; idx < vertices.size(); idx++)
+            {
+                position_vertices[fill_offsets[vertex_positions[idx]]++] = static_cast<GLuint>(idx);
+            }
+        }
+
+        // triangles over positions, plane quadrics and edge use counts
+        std::vector<GLuint> triangles{};
+        std::vector<quadric_t> quadrics(position_count, quadric_t{});
+        std::unordered_map<uint64_t, uint32_t> edge_uses{};
+
+        triangles.reserve(indices.size());
+        edge_uses.reserve(indices.size());
+
+        for (size_t idx = 0; idx + 2 < indices.size(); idx += 3)
+        {
+            GLuint corners[3] = {vertex_positions[indices[idx]],
+                                 vertex_positions[indices[idx + 1]],
+                                 vertex_positions[indices[idx + 2]]};
+
+            if (corners[0] == corners[1] || corners[1] == corners[2] || corners[0] == corners[2])
+            {
+                continue;
+            }
+
+            quadric_t plane = make_plane_quadric(positions[corners[0]], positions[corners[1]], positions[corners[2]]);
+
+            for (int corner = 0; corner < 3; corner++)
+            {
+                triangles.push_back(corners[corner]);
+                quadrics[corners[corner]].add(plane);
+                edge_uses[edge_key(corners[corner], corners[(corner + 1) % 3])]++;
+            }
+        }
+
+        // positions on open or non-manifold edges stay where they are
+        std::vector<bool> locked(position_count, false);
+
+        for (const auto& edge: edge_uses)
+        {
+            if (edge.second != 2)
+            {
+                locked[static_cast<GLuint>(edge.first >> 32)] = true;
+                locked[static_cast<GLuint>(edge.first & 0xFFFFFFFFu)] = true;
+            }
+        }
+
+        std::vector<GLuint> remap(position_count);
+
+        for (size_t idx = 0; idx < position_count; idx++)
+        {
+            remap[idx] = static_cast<GLuint>(idx);
+        }
+
+        const size_t target_triangle_count = target_index_count / 3;
+        double max_cost = 0.0;
+
+        std::vector<uint32_t> adjacency{};
+        std::vector<size_t> adjacency_offsets{};
+        std::vector<collapse_t> collapses{};
+        std::vector<bool> touched{};
+
+        // every pass applies the cheapest collapses that do not share a neighbourhood
+        while (triangles.size() / 3 > target_triangle_count)
+        {
+            adjacency_offsets.assign(position_count + 1, 0);
+            adjacency.resize(triangles.size());
+
+            for (GLuint position: triangles)
+            {
+                adjacency_offsets[position + 1]++;
+            }
+
+            for (size_t idx = 0; idx < position_count; idx++)
+            {
+                adjacency_offsets[idx + 1] += adjacency_offsets[idx];
+            }
+
+            {
+                std::vector<size_t> fill_offsets(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+
+                for (size_t idx = 0; idx < triangles.size(); idx++)
+                {
+                    adjacency[fill_offsets[triangles[idx]]++] = static_cast<uint32_t>(idx / 3);
+                }
+            }
+
+            collapses.clear();
+
+            for (size_t idx = 0; idx < triangles.size(); idx += 3)
+            {
+                for (int corner = 0; corner < 3; corner++)
+                {
+                    GLuint from = triangles[idx + corner];
+                    GLuint to = triangles[idx + (corner + 1) % 3];
+
+                    quadric_t quadric = quadrics[from];
+                    quadric.add(quadrics[to]);
+
+                    if (!locked[from])
+                    {
+                        collapses.push_back({from, to, quadric.evaluate(positions[to])});
+                    }
+
+                    if (!locked[to])
+                    {
+                        collapses.push_back({to, from, quadric.evaluate(positions[from])});
+                    }
+                }
+            }
+
+            std::sort(collapses.begin(), collapses.end(), [](const collapse_t& lhs, const collapse_t& rhs)
+            {
+                return lhs.cost < rhs.cost;
+            });
+
+            touched.assign(position_count, false);
+
+            size_t triangles_to_remove = triangles.size() / 3 - target_triangle_count;
+            size_t triangles_removed = 0;
+            bool collapsed = false;
+
+            for (const auto& collapse: collapses)
+            {
+                if (triangles_removed >= triangles_to_remove)
+                {
+                    break;
+                }
+
+                if (touched[collapse.from] || touched[collapse.to])
+                {
+                    continue;
+                }
+
+                if (collapse_flips(positions, triangles, adjacency, adjacency_offsets, collapse.from, collapse.to))
+                {
+                    continue;
+                }
+
+                // the one-ring of the removed position changes shape, keep it out of this pass
+                for (size_t slot = adjacency_offsets[collapse.from]; slot < adjacency_offsets[collapse.from + 1]; slot++)
+                {
+                    const GLuint* triangle = &triangles[adjacency[slot] * 3];
+
+                    touched[triangle[0]] = true;
+                    touched[triangle[1]] = true;
+                    touched[triangle[2]] = true;
+
+                    if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+                    {
+                        triangles_removed++;
+                    }
+                }
+
+                remap[collapse.from] = collapse.to;
+                quadrics[collapse.to].add(quadrics[collapse.from]);
+                max_cost = std::max(max_cost, collapse.cost);
+                collapsed = true;
+            }
+
+            if (!collapsed)
+            {
+                break;
+            }
+
+            size_t write = 0;
+
+            for (size_t read = 0; read < triangles.size(); read += 3)
+            {
+                GLuint a = remap[triangles[read]];
+                GLuint b = remap[triangles[read + 1]];
+                GLuint c = remap[triangles[read + 2]];
+
+                if (a == b || b == c || a == c)
+                {
+                    continue;
+                }
+
+                triangles[write++] = a;
+                triangles[write++] = b;
+                triangles[write++] = c;
+            }
+
+            triangles.resize(write);
+        }
+
+        // follow the collapse chains to the surviving position of every position
+        for (size_t idx = 0; idx < position_count; idx++)
+        {
+            GLuint target = remap[idx];
+
+            while (remap[target] != target)
+            {
+                target = remap[target];
+            }
+
+            remap[idx] = target;
+        }
+
+        // every vertex moves to the vertex of its surviving position with the closest attributes
+        constexpr GLuint UNMAPPED_VERTEX = std::numeric_limits<GLuint>::max();
+        std::vector<GLuint> vertex_remap(vertices.size(), UNMAPPED_VERTEX);
+
+        auto map_vertex = [&](GLuint vertex) -> GLuint
+        {
+            if (vertex_remap[vertex] != UNMAPPED_VERTEX)
+            {
+                return vertex_remap[vertex];
+            }
+
+            GLuint target_position = remap[vertex_positions[vertex]];
+            GLuint best_vertex = vertex;
+
+            if (target_position != vertex_positions[vertex])
+            {
+                float best_distance = std::numeric_limits<float>::max();
+
+                for (size_t slot = position_vertex_offsets[target_position];
+                     slot < position_vertex_offsets[target_position + 1];
+                     slot++)
+                {
+                    float distance = attribute_distance(vertices[vertex], vertices[position_vertices[slot]]);
+
+                    if (distance < best_distance)
+                    {
+                        best_distance = distance;
+                        best_vertex = position_vertices[slot];
+                    }
+                }
+            }
+
+            vertex_remap[vertex] = best_vertex;
+
+            return best_vertex;
+        };
+
+        output.clear();
+        output.reserve(triangles.size());
+
+        for (size_t idx = 0; idx + 2 < indices.size(); idx += 3)
+        {
+            GLuint a = remap[vertex_positions[indices[idx]]];
+            GLuint b = remap[vertex_positions[indices[idx + 1]]];
+            GLuint c = remap[vertex_positions[indices[idx + 2]]];
+
+            if (a == b || b == c || a == c)
+            {
+                continue;
+            }
+
+            output.push_back(map_vertex(indices[idx]));
+            output.push_back(map_vertex(indices[idx + 1]));
+            output.push_back(map_vertex(indices[idx + 2]));
+        }
+
+        return static_cast<float>(std::sqrt(std::max(max_cost, 0.0)));
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void MeshSimplifier::quadric_s::add(const quadric_s& other) noexcept
+    {
+        this->a00 += other.a00;
+        this->a01 += other.a01;
+        this->a02 += other.a02;
+        this->a11 += other.a11;
+        this->a12 += other.a12;
+        this->a22 += other.a22;
+        this->b0 += other.b0;
+        this->b1 += other.b1;
+        this->b2 += other.b2;
+        this->c += other.c;
+        this->weight += other.weight;
+    }
+
+    double MeshSimplifier::quadric_s::evaluate(const glm::vec3& point) const noexcept
+    {
+        if (this->weight <= 0.0)
+        {
+            return 0.0;
+        }
+
+        double x = point.x;
+        double y = point.y;
+        double z = point.z;
+
+        double error = this->a00 * x * x + this->a11 * y * y + this->a22 * z * z +
+                       2.0 * (this->a01 * x * y + this->a02 * x * z + this->a12 * y * z) +
+                       2.0 * (this->b0 * x + this->b1 * y + this->b2 * z) +
+                       this->c;
+
+        return std::fabs(error) / this->weight;
+    }
+
+    MeshSimplifier::quadric_t MeshSimplifier::make_plane_quadric(const glm::vec3& p0,
+                                                                 const glm::vec3& p1,
+                                                                 const glm::vec3& p2) noexcept
+    {
+        glm::vec3 normal = cross_product(p0, p1, p2);
+        float length = glm::length(normal);
+
+        if (length <= 0.0f)
+        {
+            return quadric_t{};
+        }
+
+        normal /= length;
+
+        double area = 0.5 * length;
+        double nx = normal.x;
+        double ny = normal.y;
+        double nz = normal.z;
+        double d = -glm::dot(normal, p0);
+
+        return {area * nx * nx, area * nx * ny, area * nx * nz,
+                area * ny * ny, area * ny * nz, area * nz * nz,
+                area * nx * d, area * ny * d, area * nz * d,
+                area * d * d,
+                area};
+    }
+
+    bool MeshSimplifier::collapse_flips(const std::vector<glm::vec3>& positions,
+                                        const std::vector<GLuint>& triangles,
+                                        const std::vector<uint32_t>& adjacency,
+                                        const std::vector<size_t>& adjacency_offsets,
+                                        GLuint from,
+                                        GLuint to)
+    {
+        for (size_t slot = adjacency_offsets[from]; slot < adjacency_offsets[from + 1]; slot++)
+        {
+            const GLuint* triangle = &triangles[adjacency[slot] * 3];
+
+            // triangles on the collapsed edge disappear
+            if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+            {
+                continue;
+            }
+
+            glm::vec3 corners[3] = {positions[triangle[0]], positions[triangle[1]], positions[triangle[2]]};
+            glm::vec3 normal_before = cross_product(corners[0], corners[1], corners[2]);
+
+            for (int corner = 0; corner < 3; corner++)
+            {
+                if (triangle[corner] == from)
+                {
+                    corners[corner] = positions[to];
+                }
+            }
+
+            glm::vec3 normal_after = cross_product(corners[0], corners[1], corners[2]);
+
+            // rotations of more than about 75 degrees count as flips, so repeated collapses cannot fold a triangle over
+            if (glm::dot(normal_before, normal_after) <= 0.25f * glm::length(normal_before) * glm::length(normal_after))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,162 @@
+///
+/// @file mesh_welder.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the MeshWelder class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "mesh_welder.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ///
+    /// @brief Mixes a 64 bit value into a running hash.
+    ///
+    /// @param seed The running hash.
+    /// @param value The value to mix in.
+    /// @return uint64_t The updated hash.
+    ///
+    static uint64_t hash_combine(uint64_t seed, uint64_t value) noexcept
+    {
+        // splitmix64 finalizer, spreads neighbouring indices over the whole table
+        value += 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2);
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return seed ^ (value ^ (value >> 31));
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    MeshWelder::MeshWelder(float epsilon)
+        : m_epsilon{epsilon > 0.0f ? epsilon : 0.0f},
+          m_corner_count{0}
+    {
+    }
+
+    void MeshWelder::reserve(size_t corner_count)
+    {
+        // a closed triangle mesh has roughly one unique vertex per six corners,
+        // reserving for the worst case keeps the table from rehashing
+        this->m_vertices.reserve(corner_count);
+
+        if (this->m_epsilon > 0.0f)
+        {
+            this->m_value_lookup.reserve(corner_count);
+        }
+        else
+        {
+            this->m_index_lookup.reserve(corner_count);
+        }
+    }
+
+    GLuint MeshWelder::add_corner(const glm::ivec3& attribute_indices, const vertex_t& vertex)
+    {
+        this->m_corner_count++;
+
+        const auto next_index = static_cast<GLuint>(this->m_vertices.size());
+
+        bool inserted = false;
+        GLuint welded_index = next_index;
+
+        if (this->m_epsilon > 0.0f)
+        {
+            auto result = this->m_value_lookup.try_emplace(this->make_value_key(vertex), next_index);
+            inserted = result.second;
+            welded_index = result.first->second;
+        }
+        else
+        {
+            index_key_t key{attribute_indices.x, attribute_indices.y, attribute_indices.z};
+            auto result = this->m_index_lookup.try_emplace(key, next_index);
+            inserted = result.second;
+            welded_index = result.first->second;
+        }
+
+        if (inserted)
+        {
+            this->m_vertices.push_back(vertex);
+        }
+
+        return welded_index;
+    }
+
+    std::vector<vertex_t> MeshWelder::take_vertices() noexcept
+    {
+        this->m_index_lookup.clear();
+        this->m_value_lookup.clear();
+
+        return std::move(this->m_vertices);
+    }
+
+    weld_stats_t MeshWelder::get_stats() const noexcept
+    {
+        return weld_stats_t{this->m_corner_count, this->m_vertices.size()};
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    size_t MeshWelder::index_key_hash::operator()(const index_key_t& key) const noexcept
+    {
+        uint64_t hash = hash_combine(0, static_cast<uint32_t>(key.position));
+        hash = hash_combine(hash, static_cast<uint32_t>(key.normal));
+        hash = hash_combine(hash, static_cast<uint32_t>(key.texcoord));
+
+        return static_cast<size_t>(hash);
+    }
+
+    size_t MeshWelder::value_key_hash::operator()(const value_key_t& key) const noexcept
+    {
+        uint64_t hash = 0;
+
+        for (int64_t cell : key.cells)
+        {
+            hash = hash_combine(hash, static_cast<uint64_t>(cell));
+        }
+
+        return static_cast<size_t>(hash);
+    }
+
+    MeshWelder::value_key_t MeshWelder::make_value_key(const vertex_t& vertex) const noexcept
+    {
+        const float values[8] = {
+            vertex.Position.x, vertex.Position.y, vertex.Position.z,
+            vertex.Normal.x, vertex.Normal.y, vertex.Normal.z,
+            vertex.TexCoords.x, vertex.TexCoords.y
+        };
+
+        value_key_t key{};
+
+        for (int idx = 0; idx < 8; idx++)
+        {
+            key.cells[idx] = static_cast<int64_t>(std::floor(values[idx] / this->m_epsilon));
+        }
+
+        return key;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,322 @@
+///
+/// @file meshlet_builder.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the MeshletBuilder class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "frustum_utils.hpp"
+#include "meshlet_builder.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr float CONE_WEIGHT = 2.0f; ///< Cost of bending the normal cone, relative to one new vertex.
+    constexpr float MIN_CONE_DOT = 0.1f; ///< Cones wider than this (about 84 degrees) are never culled.
+    constexpr uint32_t NO_MESHLET = std::numeric_limits<uint32_t>::max(); ///< Marks vertices and triangles of no meshlet.
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void MeshletBuilder::build(const std::vector<vertex_t>& vertices,
+                               std::vector<GLuint>& indices,
+                               mesh_lod_t& lod,
+                               std::vector<meshlet_t>& meshlets)
+    {
+        lod.meshlet_offset = static_cast<uint32_t>(meshlets.size());
+        lod.meshlet_count = 0;
+
+        size_t triangle_count = lod.index_count / 3;
+
+        if (triangle_count == 0)
+        {
+            return;
+        }
+
+        const std::vector<GLuint> triangles(indices.begin() + lod.index_offset,
+                                            indices.begin() + lod.index_offset + triangle_count * 3);
+
+        std::vector<glm::vec3> face_normals(triangle_count);
+
+        for (size_t triangle = 0; triangle < triangle_count; triangle++)
+        {
+            const glm::vec3& p0 = vertices[triangles[triangle * 3 + 0]].Position;
+            const glm::vec3& p1 = vertices[triangles[triangle * 3 + 1]].Position;
+            const glm::vec3& p2 = vertices[triangles[triangle * 3 + 2]].Position;
+
+            glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+            float length = glm::length(normal);
+
+            face_normals[triangle] = length > 0.0f ? normal / length : glm::vec3(0.0f);
+        }
+
+        // triangles around every vertex, stored back to back
+        std::vector<uint32_t> adjacency_offsets(vertices.size() + 1, 0);
+
+        for (GLuint vertex: triangles)
+        {
+            adjacency_offsets[vertex + 1]++;
+        }
+
+        for (size_t vertex = 0; vertex < vertices.size(); vertex++)
+        {
+            adjacency_offsets[vertex + 1] += adjacency_offsets[vertex];
+        }
+
+        std::vector<uint32_t> adjacency(triangles.size());
+        std::vector<uint32_t> adjacency_cursor(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+
+        for (size_t corner = 0; corner < triangles.size(); corner++)
+        {
+            adjacency[adjacency_cursor[triangles[corner]]++] = static_cast<uint32_t>(corner / 3);
+        }
+
+        std::vector<bool> emitted(triangle_count, false);
+        std::vector<uint32_t> vertex_meshlet(vertices.size(), NO_MESHLET);
+        std::vector<uint32_t> candidate_meshlet(triangle_count, NO_MESHLET);
+
+        std::vector<GLuint> output{};
+        output.reserve(triangles.size());
+
+        std::vector<uint32_t> candidates{};
+        std::vector<uint32_t> meshlet_triangles{};
+        std::vector<GLuint> meshlet_indices{};
+        std::vector<glm::vec3> meshlet_normals{};
+
+        size_t seed = 0;
+
+        for (uint32_t meshlet_id = 0;; meshlet_id++)
+        {
+            while (seed < triangle_count && emitted[seed])
+            {
+                seed++;
+            }
+
+            if (seed == triangle_count)
+            {
+                break;
+            }
+
+            candidates.clear();
+            meshlet_triangles.clear();
+
+            size_t meshlet_vertex_count = 0;
+            glm::vec3 normal_sum(0.0f);
+
+            auto count_new_vertices = [&](uint32_t triangle)
+            {
+                size_t count = 0;
+
+                for (size_t corner = 0; corner < 3; corner++)
+                {
+                    count += vertex_meshlet[triangles[triangle * 3 + corner]] != meshlet_id ? 1 : 0;
+                }
+
+                return count;
+            };
+
+            auto add_triangle = [&](uint32_t triangle)
+            {
+                emitted[triangle] = true;
+                meshlet_triangles.push_back(triangle);
+                normal_sum += face_normals[triangle];
+
+                for (size_t corner = 0; corner < 3; corner++)
+                {
+                    GLuint vertex = triangles[triangle * 3 + corner];
+
+                    if (vertex_meshlet[vertex] == meshlet_id)
+                    {
+                        continue;
+                    }
+
+                    vertex_meshlet[vertex] = meshlet_id;
+                    meshlet_vertex_count++;
+
+                    for (uint32_t idx = adjacency_offsets[vertex]; idx < adjacency_offsets[vertex + 1]; idx++)
+                    {
+                        uint32_t neighbour = adjacency[idx];
+
+                        if (!emitted[neighbour] && candidate_meshlet[neighbour] != meshlet_id)
+                        {
+                            candidate_meshlet[neighbour] = meshlet_id;
+                            candidates.push_back(neighbour);
+                        }
+                    }
+                }
+            };
+
+            add_triangle(static_cast<uint32_t>(seed));
+
+            while (meshlet_triangles.size() < MAX_TRIANGLES)
+            {
+                float axis_length = glm::length(normal_sum);
+                glm::vec3 axis = axis_length > 0.0f ? normal_sum / axis_length : glm::vec3(0.0f);
+
+                uint32_t best_triangle = NO_MESHLET;
+                float best_score = std::numeric_limits<float>::max();
+                size_t kept = 0;
+
+                for (uint32_t candidate: candidates)
+                {
+                    if (emitted[candidate])
+                    {
+                        continue;
+                    }
+
+                    candidates[kept++] = candidate;
+
+                    size_t new_vertices = count_new_vertices(candidate);
+
+                    if (meshlet_vertex_count + new_vertices > MAX_VERTICES)
+                    {
+                        continue;
+                    }
+
+                    float score = static_cast<float>(new_vertices) +
+                                  CONE_WEIGHT * (1.0f - glm::dot(face_normals[candidate], axis));
+
+                    if (score < best_score)
+                    {
+                        best_score = score;
+                        best_triangle = candidate;
+                    }
+                }
+
+                candidates.resize(kept);
+
+                if (best_triangle == NO_MESHLET)
+                {
+                    break;
+                }
+
+                add_triangle(best_triangle);
+            }
+
+            meshlet_indices.clear();
+            meshlet_normals.clear();
+
+            for (uint32_t triangle: meshlet_triangles)
+            {
+                meshlet_indices.insert(meshlet_indices.end(),
+                                       triangles.begin() + triangle * 3,
+                                       triangles.begin() + triangle * 3 + 3);
+                meshlet_normals.push_back(face_normals[triangle]);
+            }
+
+            meshlet_t meshlet{};
+            meshlet.index_offset = static_cast<uint32_t>(lod.index_offset + output.size());
+            meshlet.index_count = static_cast<uint32_t>(meshlet_indices.size());
+
+            compute_bounds(vertices, meshlet_indices, meshlet_normals, meshlet);
+
+            meshlets.push_back(meshlet);
+            output.insert(output.end(), meshlet_indices.begin(), meshlet_indices.end());
+        }
+
+        std::copy(output.begin(), output.end(), indices.begin() + lod.index_offset);
+
+        lod.meshlet_count = static_cast<uint32_t>(meshlets.size() - lod.meshlet_offset);
+    }
+
+    bool MeshletBuilder::is_culled(const meshlet_t& meshlet,
+                                   const frustum_t& frustum,
+                                   const glm::vec3& camera_position) noexcept
+    {
+        if (is_sphere_outside(frustum, meshlet.center, meshlet.radius))
+        {
+            return true;
+        }
+
+        // the camera is behind every triangle when the view direction stays inside the cone widened by the sphere
+        glm::vec3 view = meshlet.center - camera_position;
+
+        return glm::dot(view, meshlet.cone_axis) >= meshlet.cone_cutoff * glm::length(view) + meshlet.radius;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void MeshletBuilder::compute_bounds(const std::vector<vertex_t>& vertices,
+                                        const std::vector<GLuint>& indices,
+                                        const std::vector<glm::vec3>& normals,
+                                        meshlet_t& meshlet)
+    {
+        glm::vec3 bounds_min = vertices[indices.front()].Position;
+        glm::vec3 bounds_max = bounds_min;
+
+        for (GLuint vertex: indices)
+        {
+            bounds_min = glm::min(bounds_min, vertices[vertex].Position);
+            bounds_max = glm::max(bounds_max, vertices[vertex].Position);
+        }
+
+        meshlet.center = (bounds_min + bounds_max) * 0.5f;
+        meshlet.radius = 0.0f;
+
+        for (GLuint vertex: indices)
+        {
+            meshlet.radius = std::max(meshlet.radius, glm::length(vertices[vertex].Position - meshlet.center));
+        }
+
+        glm::vec3 normal_sum(0.0f);
+
+        for (const auto& normal: normals)
+        {
+            normal_sum += normal;
+        }
+
+        float axis_length = glm::length(normal_sum);
+
+        meshlet.cone_axis = axis_length > 0.0f ? normal_sum / axis_length : glm::vec3(0.0f, 0.0f, 1.0f);
+        meshlet.cone_cutoff = 1.0f;
+
+        if (axis_length <= 0.0f)
+        {
+            return;
+        }
+
+        float min_dot = 1.0f;
+
+        for (const auto& normal: normals)
+        {
+            // degenerate triangles are not drawn and do not widen the cone
+            if (normal != glm::vec3(0.0f))
+            {
+                min_dot = std::min(min_dot, glm::dot(normal, meshlet.cone_axis));
+            }
+        }
+
+        if (min_dot > MIN_CONE_DOT)
+        {
+            meshlet.cone_cutoff = std::sqrt(1.0f - min_dot * min_dot);
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -11,32 +11,292 @@
 // Project Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <filesystem>
+#include <unordered_map>
 #include "model_3d.hpp"
+#include "mesh_optimizer.hpp"
+#include "mesh_simplifier.hpp"
+#include "mesh_welder.hpp"
+#include "meshlet_builder.hpp"
+#include "frustum_utils.hpp"
+#include "hash_utils.hpp"
+#include "obj_parser.hpp"
+#include "core_components.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <tiny_obj_loader.h>
-#include <stb_image.h>
 
 namespace YB
 {
+    ///
+    /// @brief Static member initialization for the import settings.
+    ///
+    import_settings_t Model3D::import_settings{0.0f,
+                                               true,
+                                               true,
+                                               true,
+                                               true,
+                                               VERTEX_FORMAT::FULL,
+                                               CPU_DATA_POLICY::RELEASE};
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr size_t VERTEX_CACHE_SIZE = 16; ///< Post-transform cache size the meshes are optimized for.
+    constexpr size_t MAX_LOD_COUNT = 5; ///< Full resolution level included.
+    constexpr size_t MIN_LOD_TRIANGLES = 64; ///< Meshes are not simplified below this many triangles.
+    constexpr float MIN_LOD_REDUCTION = 0.8f; ///< A level must keep at most this fraction of the previous level.
+
+    ///
+    /// @brief Grows the bounding box of a model by the bounds of its next mesh.
+    ///
+    static void merge_bounds(model_data_t& model_data, const aabb_t& bounds)
+    {
+        if (model_data.meshes.empty())
+        {
+            model_data.bounds = bounds;
+            return;
+        }
+
+        model_data.bounds.min = glm::min(model_data.bounds.min, bounds.min);
+        model_data.bounds.max = glm::max(model_data.bounds.max, bounds.max);
+    }
+
+    ///
+    /// @brief Appends simplified levels of detail, each about half the previous one, to the index buffer of a mesh.
+    ///
+    static void generate_lods(mesh_data_t& mesh, const MeshOptimizer& optimizer, std::vector<size_t>& lod_triangles)
+    {
+        std::vector<GLuint>& indices = mesh.indices;
+        const std::vector<GLuint> full_indices = indices;
+
+        mesh.lods.clear();
+        mesh.lods.push_back({0, static_cast<uint32_t>(indices.size()), 0.0f, 0, 0});
+
+        // every level halves the previous one, so all levels together stay under twice the full level
+        indices.reserve(indices.size() * 2);
+
+        std::vector<GLuint> lod_indices{};
+
+        while (mesh.lods.size() < MAX_LOD_COUNT)
+        {
+            const mesh_lod_t& previous = mesh.lods.back();
+            size_t target_index_count = previous.index_count / 6 * 3;
+
+            if (target_index_count / 3 < MIN_LOD_TRIANGLES)
+            {
+                break;
+            }
+
+            float error = MeshSimplifier::simplify(mesh.vertices, full_indices, target_index_count, lod_indices);
+
+            if (lod_indices.empty() ||
+                static_cast<float>(lod_indices.size()) > MIN_LOD_REDUCTION * static_cast<float>(previous.index_count))
+            {
+                break;
+            }
+
+            optimizer.reorder_triangles(mesh.vertices, lod_indices);
+
+            mesh.lods.push_back({static_cast<uint32_t>(indices.size()),
+                                 static_cast<uint32_t>(lod_indices.size()),
+                                 std::max(error, previous.error),
+                                 0,
+                                 0});
+
+            indices.insert(indices.end(), lod_indices.begin(), lod_indices.end());
+        }
+
+        if (lod_triangles.size() < mesh.lods.size())
+        {
+            lod_triangles.resize(mesh.lods.size(), 0);
+        }
+
+        for (size_t lod = 0; lod < mesh.lods.size(); lod++)
+        {
+            lod_triangles[lod] += mesh.lods[lod].index_count / 3;
+        }
+    }
+
+    ///
+    /// @brief Splits every level of detail of a mesh into meshlets.
+    ///
+    static void build_meshlets(mesh_data_t& mesh)
+    {
+        if (mesh.lods.empty())
+        {
+            mesh.lods.push_back({0, static_cast<uint32_t>(mesh.indices.size()), 0.0f, 0, 0});
+        }
+
+        mesh.meshlets.clear();
+
+        for (auto& lod: mesh.lods)
+        {
+            MeshletBuilder::build(mesh.vertices, mesh.indices, lod, mesh.meshlets);
+        }
+    }
+
+    ///
+    /// @brief Adds the counts of one mesh to the running totals of a model.
+    ///
+    static void merge_vertex_cache_stats(vertex_cache_stats_t& total, const vertex_cache_stats_t& stats)
+    {
+        total.triangle_count += stats.triangle_count;
+        total.vertex_count += stats.vertex_count;
+        total.cache_misses += stats.cache_misses;
+    }
+
+    ///
+    /// @brief Formats vertex cache statistics as "ACMR / ATVR".
+    ///
+    static std::string format_vertex_cache_stats(const vertex_cache_stats_t& stats)
+    {
+        char text[64];
+
+        std::snprintf(text,
+                      sizeof(text),
+                      "%.3f / %.3f",
+                      stats.triangle_count > 0 ? static_cast<double>(stats.cache_misses) / stats.triangle_count : 0.0,
+                      stats.vertex_count > 0 ? static_cast<double>(stats.cache_misses) / stats.vertex_count : 0.0);
+
+        return text;
+    }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-    Model3D::Model3D(const std::string& file_path,
-                     const std::string& model_name,
-                     const glm::vec3& position,
-                     const bool rotatable,
-                     const bool scalable)
-        : obj_position{position},
-          is_rotatable{rotatable},
-          is_scalable{scalable},
-          m_model_name{model_name}
+    Model3D::Model3D(const std::string& file_path)
+        : m_weld_stats{0, 0},
+          m_bounds{glm::vec3(0.0f), glm::vec3(0.0f)},
+          m_sphere{glm::vec3(0.0f), 0.0f}
+    {
+        std::unique_ptr<model_data_t> model_data = import_model(file_path);
+
+        if (!model_data)
+        {
+            exit(1);
+        }
+
+        decode_textures(*model_data);
+
+        this->upload(*model_data);
+    }
+
+    Model3D::Model3D(model_data_t& model_data)
+        : m_weld_stats{0, 0},
+          m_bounds{glm::vec3(0.0f), glm::vec3(0.0f)},
+          m_sphere{glm::vec3(0.0f), 0.0f}
+    {
+        this->upload(model_data);
+    }
+
+    Model3D::~Model3D()
+    {
+        for (auto& mesh: this->m_meshes)
+        {
+            mesh.release();
+        }
+    }
+
+    void Model3D::draw(UniformTable& uniforms, const std::vector<mesh_draw_t>& draws) const
+    {
+        for (size_t idx = 0; idx < this->m_meshes.size() && idx < draws.size(); idx++)
+        {
+            this->m_meshes[idx].draw(uniforms, draws[idx]);
+        }
+    }
+
+    void Model3D::draw_instances(UniformTable& uniforms, const std::vector<mesh_draw_t>& draws, GLsizei instance_count) const
+    {
+        for (size_t idx = 0; idx < this->m_meshes.size() && idx < draws.size(); idx++)
+        {
+            this->m_meshes[idx].draw_instances(uniforms, draws[idx], instance_count);
+        }
+    }
+
+    void Model3D::select_lod(float pixels_per_unit, const lod_settings_t& settings, std::vector<mesh_draw_t>& draws) const
+    {
+        draws.resize(this->m_meshes.size());
+
+        for (size_t idx = 0; idx < this->m_meshes.size(); idx++)
+        {
+            this->m_meshes[idx].select_lod(pixels_per_unit, settings, draws[idx]);
+        }
+    }
+
+    void Model3D::cull_meshlets(const glm::mat4& model_view_projection,
+                                const glm::vec3& camera_position,
+                                std::vector<mesh_draw_t>& draws) const
+    {
+        frustum_t frustum = extract_frustum(model_view_projection);
+
+        for (size_t idx = 0; idx < this->m_meshes.size() && idx < draws.size(); idx++)
+        {
+            this->m_meshes[idx].cull_meshlets(frustum, camera_position, draws[idx]);
+        }
+    }
+
+    size_t Model3D::get_triangle_count(const std::vector<mesh_draw_t>& draws) noexcept
+    {
+        size_t triangle_count = 0;
+
+        for (const auto& draw: draws)
+        {
+            triangle_count += draw.index_count / 3;
+        }
+
+        return triangle_count;
+    }
+
+    weld_stats_t Model3D::get_weld_stats() const noexcept
+    {
+        return this->m_weld_stats;
+    }
+
+    aabb_t Model3D::get_bounds() const noexcept
+    {
+        return this->m_bounds;
+    }
+
+    bounding_sphere_t Model3D::get_bounding_sphere() const noexcept
+    {
+        return this->m_sphere;
+    }
+
+    const std::vector<Mesh>& Model3D::get_meshes() const noexcept
+    {
+        return this->m_meshes;
+    }
+
+    asset_memory_t Model3D::get_memory_usage() const noexcept
+    {
+        asset_memory_t memory{0, 0, 0};
+
+        for (const auto& mesh: this->m_meshes)
+        {
+            asset_memory_t mesh_memory = mesh.get_memory_usage();
+
+            memory.geometry_bytes += mesh_memory.geometry_bytes;
+            memory.cpu_bytes += mesh_memory.cpu_bytes;
+        }
+
+        for (const auto& texture: this->m_textures)
+        {
+            memory.texture_bytes += texture->byte_size;
+        }
+
+        return memory;
+    }
+
+    std::unique_ptr<model_data_t> Model3D::import_model(const std::string& file_path)
     {
         std::string filepath = file_path;
         std::replace(filepath.begin(), filepath.end(), '\\', '/');
@@ -46,32 +306,58 @@ namespace YB
         filepath = canonical_path.make_preferred().string();
         std::string basepath = canonical_path.remove_filename().string();
 
-        this->read_obj(filepath, basepath);
-    }
+        auto model_data = std::make_unique<model_data_t>();
+        model_data->weld_stats = {0, 0};
+        model_data->bounds = {glm::vec3(0.0f), glm::vec3(0.0f)};
+        model_data->mesh_cache = std::make_unique<MeshCache>(filepath, hash_import_settings());
 
-    Model3D::~Model3D()
-    {
-        for (auto& m_loaded_texture: this->m_loaded_textures)
+        if (model_data->mesh_cache->load())
         {
-            glDeleteTextures(1, &m_loaded_texture.id);
+            std::cout << "Loading : " << model_data->mesh_cache->get_cache_path() << "\n";
+            read_mesh_cache(*model_data);
         }
-
-        for (auto& mesh: this->m_meshes)
+        else
         {
-            GLuint VBO = mesh.get_buffers().VBO;
-            GLuint EBO = mesh.get_buffers().EBO;
-            GLuint VAO = mesh.get_buffers().VAO;
-            glDeleteBuffers(1, &VBO);
-            glDeleteBuffers(1, &EBO);
-            glDeleteVertexArrays(1, &VAO);
+            if (!read_obj(filepath, basepath, *model_data, *model_data->mesh_cache))
+            {
+                return nullptr;
+            }
+
+            model_data->mesh_cache->save();
+
+            // the meshes own their data, the pointers are taken once the vectors stopped moving
+            for (auto& mesh: model_data->meshes)
+            {
+                mesh.vertex_data = mesh.vertices.data();
+                mesh.vertex_count = mesh.vertices.size();
+                mesh.index_data = mesh.indices.data();
+                mesh.index_count = mesh.indices.size();
+            }
         }
+
+        return model_data;
     }
 
-    void Model3D::draw(GLuint shader_program)
+    void Model3D::decode_textures(model_data_t& model_data)
     {
-        for (auto& mesh: this->m_meshes)
+        std::vector<std::string> paths{};
+
+        for (const auto& mesh: model_data.meshes)
+        {
+            for (const auto& texture: mesh.textures)
+            {
+                if (std::find(paths.begin(), paths.end(), texture.path) == paths.end())
+                {
+                    paths.push_back(texture.path);
+                }
+            }
+        }
+
+        model_data.images.reserve(model_data.images.size() + paths.size());
+
+        for (const auto& path: paths)
         {
-            mesh.draw(shader_program);
+            model_data.images.push_back(TextureLoader::decode_async(path));
         }
     }
 
@@ -79,8 +365,10 @@ namespace YB
 // Private Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-    void Model3D::read_obj(const std::string& file_path,
-                           const std::string& base_path)
+    bool Model3D::read_obj(const std::string& file_path,
+                           const std::string& base_path,
+                           model_data_t& model_data,
+                           MeshCache& mesh_cache)
     {
         std::cout << "Loading : " << file_path << "\n";
         tinyobj::attrib_t attrib{};
@@ -88,13 +376,30 @@ namespace YB
         std::vector<tinyobj::material_t> materials{};
 
         std::string err{};
-        bool ret = tinyobj::LoadObj(&attrib,
-                                    &shapes,
-                                    &materials,
-                                    &err,
-                                    file_path.c_str(),
-                                    base_path.c_str(),
-                                    GL_TRUE);
+        bool ret = false;
+
+        if (import_settings.use_native_obj_parser && CoreComponents::thread_pool)
+        {
+            ObjParser obj_parser(*CoreComponents::thread_pool);
+            ret = obj_parser.parse(file_path, base_path, attrib, shapes, materials, err);
+
+            if (!ret)
+            {
+                std::cerr << "ObjParser failed, falling back to tinyobj: " << err << std::endl;
+                err.clear();
+            }
+        }
+
+        if (!ret)
+        {
+            ret = tinyobj::LoadObj(&attrib,
+                                   &shapes,
+                                   &materials,
+                                   &err,
+                                   file_path.c_str(),
+                                   base_path.c_str(),
+                                   GL_TRUE);
+        }
 
         if (!err.empty())
         {
@@ -103,7 +408,7 @@ namespace YB
 
         if (!ret)
         {
-            exit(1);
+            return false;
         }
 
         int shapes_size = static_cast<int>(shapes.size());
@@ -112,12 +417,26 @@ namespace YB
         std::cout << "# of shapes    : " << shapes_size << "\n";
         std::cout << "# of materials : " << materials_count << "\n";
 
+        model_data.meshes.reserve(shapes.size());
+
+        MeshOptimizer optimizer(VERTEX_CACHE_SIZE);
+        vertex_cache_stats_t cache_stats_before{0, 0, 0};
+        vertex_cache_stats_t cache_stats_after{0, 0, 0};
+        std::vector<size_t> lod_triangles{};
+        size_t meshlet_count = 0;
+
         // Loop over shapes
         for (int s = 0; s < shapes_size; s++)
         {
-            std::vector<vertex_t> vertices{};
-            std::vector<GLuint> indices{};
-            std::vector<texture_t> textures{};
+            mesh_data_t mesh{};
+            std::vector<GLuint>& indices = mesh.indices;
+            std::vector<texture_ref_t>& textures = mesh.textures;
+
+            size_t corner_count = shapes[s].mesh.indices.size();
+
+            MeshWelder welder(import_settings.weld_epsilon);
+            welder.reserve(corner_count);
+            indices.reserve(corner_count);
 
             // Loop over faces(polygon)
             size_t index_offset = 0;
@@ -159,14 +478,58 @@ namespace YB
                     current_vertex.Normal = vertex_normal;
                     current_vertex.TexCoords = vertex_texture_coords;
 
-                    vertices.push_back(current_vertex);
+                    glm::ivec3 attribute_indices(idx.vertex_index,
+                                                 idx.normal_index,
+                                                 idx.texcoord_index);
 
-                    indices.push_back(index_offset + v);
+                    indices.push_back(welder.add_corner(attribute_indices, current_vertex));
                 }
 
                 index_offset += fv;
             }
 
+            weld_stats_t weld_stats = welder.get_stats();
+            model_data.weld_stats.vertices_before += weld_stats.vertices_before;
+            model_data.weld_stats.vertices_after += weld_stats.vertices_after;
+
+            mesh.vertices = welder.take_vertices();
+            std::vector<vertex_t>& vertices = mesh.vertices;
+
+            if (import_settings.optimize_meshes)
+            {
+                merge_vertex_cache_stats(cache_stats_before, optimizer.analyze(indices, vertices.size()));
+                optimizer.optimize(vertices, indices);
+                merge_vertex_cache_stats(cache_stats_after, optimizer.analyze(indices, vertices.size()));
+            }
+
+            if (import_settings.generate_lods)
+            {
+                generate_lods(mesh, optimizer, lod_triangles);
+            }
+
+            if (import_settings.build_meshlets)
+            {
+                build_meshlets(mesh);
+                meshlet_count += mesh.meshlets.size();
+            }
+
+            aabb_t& bounds = mesh.bounds;
+            bounds = {glm::vec3(0.0f), glm::vec3(0.0f)};
+
+            if (!vertices.empty())
+            {
+                bounds.min = vertices[0].Position;
+                bounds.max = vertices[0].Position;
+            }
+
+            for (const auto& vertex: vertices)
+            {
+                bounds.min = glm::min(bounds.min, vertex.Position);
+                bounds.max = glm::max(bounds.max, vertex.Position);
+            }
+
+            merge_bounds(model_data, bounds);
+
             // get material id
             // Only try to read materials if the .mtl file is present
             size_t a = shapes[s].mesh.material_ids.size();
@@ -177,152 +540,190 @@ namespace YB
                 {
                     if (material_id != -1)
                     {
-                        material_t current_material;
-
-                        current_material.ambient
-                            = glm::vec3(materials[material_id].ambient[0],
-                                        materials[material_id].ambient[1],
-                                        materials[material_id].ambient[2]);
-
-                        current_material.diffuse
-                            = glm::vec3(materials[material_id].diffuse[0],
-                                        materials[material_id].diffuse[1],
-                                        materials[material_id].diffuse[2]);
-
-                        current_material.specular
-                            = glm::vec3(materials[material_id].specular[0],
-                                        materials[material_id].specular[1],
-                                        materials[material_id].specular[2]);
-
                         //ambient texture
                         std::string& ambient_texture_path = materials[material_id].ambient_texname;
 
                         if (!ambient_texture_path.empty())
                         {
-                            texture_t current_texture
-                                = this->load_texture(base_path + ambient_texture_path,
-                                                     "ambientTexture");
-
-                            textures.push_back(current_texture);
+                            textures.push_back({"ambientTexture", base_path + ambient_texture_path});
                         }
 
                         //diffuse texture
                         std::string& diffuse_texture_path = materials[material_id].diffuse_texname;
                         if (!diffuse_texture_path.empty())
                         {
-                            texture_t current_texture
-                                = this->load_texture(base_path + diffuse_texture_path,
-                                                     "diffuseTexture");
-
-                            textures.push_back(current_texture);
+                            textures.push_back({"diffuseTexture", base_path + diffuse_texture_path});
                         }
 
                         //specular texture
                         std::string& specular_texture_path = materials[material_id].specular_texname;
                         if (!specular_texture_path.empty())
                         {
-                            texture_t current_texture
-                                = this->load_texture(base_path + specular_texture_path,
-                                                     "specularTexture");
-
-                            textures.push_back(current_texture);
+                            textures.push_back({"specularTexture", base_path + specular_texture_path});
                         }
                     }
                 }
             }
 
-            this->m_meshes.emplace_back(vertices, indices, textures);
+            mesh_cache.add_mesh(vertices, indices, mesh.lods, mesh.meshlets, textures, bounds);
+
+            model_data.meshes.push_back(std::move(mesh));
         }
-    }
 
-    texture_t Model3D::load_texture(const std::string& path, const std::string& type)
-    {
-        const size_t loaded_textures_size = this->m_loaded_textures.size();
+        std::cout << "# of vertices  : " << model_data.weld_stats.vertices_before
+                  << " -> " << model_data.weld_stats.vertices_after << " after welding\n";
 
-        for (size_t idx = 0; idx < loaded_textures_size; idx++)
+        if (import_settings.optimize_meshes)
         {
-            if (this->m_loaded_textures[idx].path == path)
+            std::cout << "# ACMR / ATVR  : " << format_vertex_cache_stats(cache_stats_before)
+                      << " -> " << format_vertex_cache_stats(cache_stats_after) << " after optimizing\n";
+        }
+
+        if (!lod_triangles.empty())
+        {
+            std::cout << "# LOD triangles:";
+
+            for (size_t lod = 0; lod < lod_triangles.size(); lod++)
             {
-                //already loaded texture
-                return this->m_loaded_textures[idx];
+                std::cout << (lod == 0 ? " " : " / ") << lod_triangles[lod];
             }
-        }
 
-        texture_t current_texture;
-        current_texture.id = this->read_texture_from_file(path.c_str());
-        current_texture.type = type;
-        current_texture.path = path;
+            std::cout << "\n";
+        }
 
-        this->m_loaded_textures.push_back(current_texture);
+        if (import_settings.build_meshlets)
+        {
+            std::cout << "# of meshlets  : " << meshlet_count << "\n";
+        }
 
-        return current_texture;
+        return true;
     }
 
-    GLuint Model3D::read_texture_from_file(const char* file_name)
+    void Model3D::read_mesh_cache(model_data_t& model_data)
     {
-        int x, y, n;
-        int force_channels = 4;
-        uint8_t* image_data = stbi_load(file_name, &x, &y, &n, force_channels);
+        const std::vector<mesh_blob_t>& meshes = model_data.mesh_cache->get_meshes();
+
+        std::cout << "# of shapes    : " << meshes.size() << "\n";
 
-        if (!image_data)
+        model_data.meshes.reserve(meshes.size());
+
+        for (const auto& blob: meshes)
         {
-            fprintf(stderr, "ERROR: could not load %s\n", file_name);
-            return false;
+            merge_bounds(model_data, blob.bounds);
+
+            // every face corner of the full level owns one index, so its index count is the unwelded vertex count
+            model_data.weld_stats.vertices_before += blob.lods.empty() ? blob.index_count : blob.lods.front().index_count;
+            model_data.weld_stats.vertices_after += blob.vertex_count;
+
+            mesh_data_t mesh{};
+            mesh.vertex_data = blob.vertices;
+            mesh.vertex_count = blob.vertex_count;
+            mesh.index_data = blob.indices;
+            mesh.index_count = blob.index_count;
+            mesh.lods = blob.lods;
+            mesh.meshlets = blob.meshlets;
+            mesh.textures = blob.textures;
+            mesh.bounds = blob.bounds;
+
+            model_data.meshes.push_back(std::move(mesh));
         }
+    }
 
-        // NPOT check
-        if ((x & (x - 1)) != 0 || (y & (y - 1)) != 0)
+    uint64_t Model3D::hash_import_settings() noexcept
+    {
+        uint64_t hash = fnv1a_hash_value(import_settings.weld_epsilon);
+        hash = fnv1a_hash_value(import_settings.optimize_meshes, hash);
+        hash = fnv1a_hash_value(import_settings.generate_lods, hash);
+
+        return fnv1a_hash_value(import_settings.build_meshlets, hash);
+    }
+
+    void Model3D::upload(model_data_t& model_data)
+    {
+        this->m_weld_stats = model_data.weld_stats;
+        this->m_bounds = model_data.bounds;
+
+        std::unordered_map<std::string, GLuint> texture_ids{};
+
+        for (auto& image: model_data.images)
         {
-            fprintf(stderr, "WARNING: texture %s is not power-of-2 dimensions\n", file_name);
+            TextureLoader::wait(image);
+            image_data_t image_data = image.get();
+
+            // textures found by the decode are shared as they are, the others are uploaded
+            texture_handle_t texture = image_data.texture;
+
+            if (!texture)
+            {
+                texture = CoreComponents::texture_cache->insert(image_data);
+            }
+
+            texture_ids[image_data.path] = texture ? texture->id : 0;
+
+            if (texture)
+            {
+                this->m_textures.push_back(std::move(texture));
+            }
         }
 
-        int width_in_bytes = x * 4;
-        unsigned char* top = nullptr;
-        unsigned char* bottom = nullptr;
-        unsigned char temp = 0;
-        int half_height = y / 2;
+        model_data.images.clear();
 
-        for (int row = 0; row < half_height; row++)
+        this->m_meshes.reserve(model_data.meshes.size());
+
+        for (auto& mesh: model_data.meshes)
         {
-            top = image_data + row * width_in_bytes;
-            bottom = image_data + (y - row - 1) * width_in_bytes;
+            std::vector<texture_t> textures{};
+            textures.reserve(mesh.textures.size());
+
+            for (const auto& texture: mesh.textures)
+            {
+                auto texture_id = texture_ids.find(texture.path);
 
-            for (int col = 0; col < width_in_bytes; col++)
+                textures.push_back({texture_id != texture_ids.end() ? texture_id->second : 0,
+                                    texture.type,
+                                    texture.path});
+            }
+
+            // imported meshes hand their vectors over, cached ones are copied out of the mapping by the policy
+            if (!mesh.vertices.empty())
+            {
+                this->m_meshes.emplace_back(std::move(mesh.vertices),
+                                            std::move(mesh.indices),
+                                            std::move(mesh.lods),
+                                            std::move(mesh.meshlets),
+                                            std::move(textures),
+                                            import_settings.vertex_format,
+                                            import_settings.cpu_data_policy);
+            }
+            else
             {
-                temp = *top;
-                *top = *bottom;
-                *bottom = temp;
-                top++;
-                bottom++;
+                this->m_meshes.emplace_back(mesh.vertex_data,
+                                            mesh.vertex_count,
+                                            mesh.index_data,
+                                            mesh.index_count,
+                                            mesh.lods,
+                                            mesh.meshlets,
+                                            textures,
+                                            import_settings.vertex_format,
+                                            import_settings.cpu_data_policy);
             }
+
+            mesh.vertex_data = nullptr;
+            mesh.index_data = nullptr;
+        }
+
+        glm::vec3 center = (this->m_bounds.min + this->m_bounds.max) * 0.5f;
+        float radius = 0.0f;
+
+        for (const auto& mesh: this->m_meshes)
+        {
+            const bounding_sphere_t& sphere = mesh.get_bounding_sphere();
+
+            radius = std::max(radius, glm::length(sphere.center - center) + sphere.radius);
         }
 
-        GLuint texture_id;
-        glGenTextures(1, &texture_id);
-        glBindTexture(GL_TEXTURE_2D, texture_id);
-
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0,
-            GL_SRGB,
-            //GL_SRGB,//GL_RGBA,
-            x,
-            y,
-            0,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
-            image_data
-        );
-
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glBindTexture(GL_TEXTURE_2D, 0);
-
-        return texture_id;
+        // the spheres of the meshes are tighter than the box, unless they stick out of its corners
+        this->m_sphere = {center, std::min(radius, glm::length(this->m_bounds.max - this->m_bounds.min) * 0.5f)};
     }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,177 @@
+///
+/// @file model_load_request.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the ModelLoadRequest class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include "model_load_request.hpp"
+#include "core_components.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ModelLoadRequest::ModelLoadRequest(const std::string& file_path,
+                                       const std::string& model_name,
+                                       const glm::vec3& position,
+                                       bool rotatable,
+                                       bool scalable,
+                                       const model_load_callbacks_t& callbacks)
+        : model_name{model_name},
+          obj_position{position},
+          is_rotatable{rotatable},
+          is_scalable{scalable},
+          m_file_path{file_path},
+          m_callbacks{callbacks},
+          m_state{LOAD_STATE::QUEUED},
+          m_progress{0.0f},
+          m_reported_progress{-1.0f},
+          m_has_bounds{false},
+          m_bounds{glm::vec3(0.0f), glm::vec3(0.0f)},
+          m_import{}
+    {
+    }
+
+    void ModelLoadRequest::load()
+    {
+        this->m_state = LOAD_STATE::LOADING;
+
+        auto on_progress = [this](const aabb_t& bounds, float progress)
+        {
+            {
+                std::lock_guard lock(this->m_mutex);
+                this->m_bounds = bounds;
+                this->m_has_bounds = true;
+            }
+
+            this->m_progress = progress;
+        };
+
+        // an invalid import means the model is loaded already, acquiring it on the render thread is enough
+        model_import_t pending = CoreComponents::asset_manager->import(this->m_file_path, on_progress);
+
+        if (!pending.valid())
+        {
+            this->m_progress = 1.0f;
+            this->m_state = LOAD_STATE::READY;
+            return;
+        }
+
+        // never wait here, the import may belong to a task further down this thread's own stack
+        std::lock_guard lock(this->m_mutex);
+
+        this->m_import = pending;
+    }
+
+    LOAD_STATE ModelLoadRequest::get_state() const noexcept
+    {
+        return this->m_state;
+    }
+
+    float ModelLoadRequest::get_progress() const noexcept
+    {
+        return this->m_progress;
+    }
+
+    bool ModelLoadRequest::get_bounds(aabb_t& bounds) const
+    {
+        std::lock_guard lock(this->m_mutex);
+
+        bounds = this->m_bounds;
+
+        return this->m_has_bounds;
+    }
+
+    const std::string& ModelLoadRequest::get_file_path() const noexcept
+    {
+        return this->m_file_path;
+    }
+
+    void ModelLoadRequest::report_progress()
+    {
+        if (this->m_state == LOAD_STATE::LOADING)
+        {
+            this->poll_import();
+        }
+
+        float progress = this->m_progress;
+
+        if (progress != this->m_reported_progress)
+        {
+            this->m_reported_progress = progress;
+
+            if (this->m_callbacks.on_progress)
+            {
+                this->m_callbacks.on_progress(this->model_name, progress);
+            }
+        }
+    }
+
+    void ModelLoadRequest::complete(bool success)
+    {
+        this->m_state = success ? LOAD_STATE::UPLOADED : LOAD_STATE::FAILED;
+
+        if (this->m_callbacks.on_complete)
+        {
+            this->m_callbacks.on_complete(this->model_name, success);
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void ModelLoadRequest::poll_import()
+    {
+        std::shared_ptr<model_data_t> model_data{};
+
+        {
+            std::lock_guard lock(this->m_mutex);
+
+            if (!this->m_import.valid()
+                || this->m_import.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                return;
+            }
+
+            model_data = this->m_import.get();
+            this->m_import = {};
+
+            if (model_data)
+            {
+                this->m_bounds = model_data->bounds;
+                this->m_has_bounds = true;
+            }
+        }
+
+        if (!model_data)
+        {
+            this->m_state = LOAD_STATE::FAILED;
+            return;
+        }
+
+        this->m_progress = 1.0f;
+        this->m_state = LOAD_STATE::READY;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
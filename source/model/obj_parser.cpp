@@ -0,0 +1,698 @@
+///
+/// @file obj_parser.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the ObjParser class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include "obj_parser.hpp"
+#include "mapped_file.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr size_t OBJ_MIN_CHUNK_SIZE = 1 << 20; ///< Files are not split into chunks smaller than this.
+
+    ///
+    /// @enum OBJ_EVENT
+    /// @brief Statements that change the state of the faces following them.
+    ///
+    enum class OBJ_EVENT
+    {
+        GROUP, ///< An o or g statement, starts a new shape.
+        USE_MATERIAL ///< An usemtl statement, changes the material of the following faces.
+    };
+
+    ///
+    /// @struct obj_event_s
+    /// @brief A state change recorded at a triangle position inside a chunk.
+    ///
+    typedef struct obj_event_s
+    {
+        size_t triangle_offset; ///< Number of triangles of the chunk before the statement.
+        OBJ_EVENT type; ///< Kind of the statement.
+        std::string name; ///< Group or material name.
+    } obj_event_t;
+
+    ///
+    /// @struct obj_chunk_s
+    /// @brief Result of parsing one line aligned slice of the file.
+    ///
+    /// Absolute indices are stored 0 based and global. Relative (negative) indices
+    /// can only be resolved against the chunk, so they are stored chunk local and
+    /// listed in relative_components until the merge adds the chunk offsets.
+    ///
+    typedef struct obj_chunk_s
+    {
+        const char* begin; ///< First byte of the chunk.
+        const char* end; ///< One past the last byte of the chunk.
+        std::vector<float> positions; ///< xyz of every v statement.
+        std::vector<float> normals; ///< xyz of every vn statement.
+        std::vector<float> texcoords; ///< uv of every vt statement.
+        std::vector<tinyobj::index_t> indices; ///< Triangulated face corners.
+        std::vector<size_t> relative_components; ///< corner * 3 + component of every chunk local index.
+        std::vector<obj_event_t> events; ///< o, g and usemtl statements.
+        std::vector<std::string> material_libraries; ///< Files named by mtllib statements.
+        int position_offset; ///< Positions of all previous chunks.
+        int normal_offset; ///< Normals of all previous chunks.
+        int texcoord_offset; ///< Texture coordinates of all previous chunks.
+        std::string error; ///< First parse error, empty on success.
+    } obj_chunk_t;
+
+    ///
+    /// @brief Checks for a blank character inside a line.
+    ///
+    static inline bool is_blank(char character) noexcept
+    {
+        return character == ' ' || character == '\t' || character == '\r';
+    }
+
+    ///
+    /// @brief Advances past blank characters.
+    ///
+    static inline const char* skip_blanks(const char* cursor, const char* end) noexcept
+    {
+        while (cursor < end && is_blank(*cursor))
+        {
+            cursor++;
+        }
+
+        return cursor;
+    }
+
+    ///
+    /// @brief Returns the rest of a line without surrounding blanks.
+    ///
+    static std::string read_name(const char* cursor, const char* end)
+    {
+        cursor = skip_blanks(cursor, end);
+
+        while (end > cursor && is_blank(*(end - 1)))
+        {
+            end--;
+        }
+
+        return std::string(cursor, end);
+    }
+
+    ///
+    /// @brief Checks whether a line starts with a keyword followed by a blank or the line end.
+    ///
+    static inline bool starts_with_keyword(const char* cursor, const char* end, const char* keyword) noexcept
+    {
+        size_t length = std::strlen(keyword);
+
+        return static_cast<size_t>(end - cursor) >= length &&
+               std::memcmp(cursor, keyword, length) == 0 &&
+               (cursor + length == end || is_blank(cursor[length]));
+    }
+
+    ///
+    /// @brief Parses up to count floats separated by blanks, missing values are left untouched.
+    ///
+    static const char* parse_floats(const char* cursor, const char* end, float* values, int count) noexcept
+    {
+        for (int idx = 0; idx < count; idx++)
+        {
+            cursor = skip_blanks(cursor, end);
+
+            if (cursor < end && *cursor == '+')
+            {
+                cursor++;
+            }
+
+            auto result = std::from_chars(cursor, end, values[idx]);
+
+            if (result.ec != std::errc())
+            {
+                break;
+            }
+
+            cursor = result.ptr;
+        }
+
+        return cursor;
+    }
+
+    ///
+    /// @brief Resolves one index of a face corner.
+    ///
+    /// @param value The 1 based (or negative relative) index from the file.
+    /// @param local_count Number of attributes of this kind parsed so far in the chunk.
+    /// @param index Receives the 0 based index.
+    /// @return 0 for an absolute index, 1 for a chunk local index, -1 for an invalid one.
+    ///
+    static inline int resolve_index(int value, size_t local_count, int& index) noexcept
+    {
+        if (value > 0)
+        {
+            index = value - 1;
+            return 0;
+        }
+
+        if (value < 0)
+        {
+            index = static_cast<int>(local_count) + value;
+            return 1;
+        }
+
+        return -1;
+    }
+
+    ///
+    /// @brief Parses an f statement and appends its fan triangulation to the chunk.
+    ///
+    static bool parse_face(const char* cursor, const char* end, obj_chunk_t& chunk)
+    {
+        // index and "is chunk local" flags of every corner, reused across faces
+        thread_local std::vector<tinyobj::index_t> corners{};
+        thread_local std::vector<unsigned char> relative_flags{};
+        corners.clear();
+        relative_flags.clear();
+
+        size_t position_count = chunk.positions.size() / 3;
+        size_t normal_count = chunk.normals.size() / 3;
+        size_t texcoord_count = chunk.texcoords.size() / 2;
+
+        while (true)
+        {
+            cursor = skip_blanks(cursor, end);
+
+            if (cursor >= end)
+            {
+                break;
+            }
+
+            int values[3] = {0, 0, 0};
+            int component = 0;
+
+            while (cursor < end && !is_blank(*cursor) && component < 3)
+            {
+                if (*cursor != '/')
+                {
+                    auto result = std::from_chars(cursor, end, values[component]);
+
+                    if (result.ec != std::errc())
+                    {
+                        return false;
+                    }
+
+                    cursor = result.ptr;
+                }
+
+                if (cursor < end && *cursor == '/')
+                {
+                    cursor++;
+                    component++;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            tinyobj::index_t corner{-1, -1, -1};
+            unsigned char flags = 0;
+
+            int kind = resolve_index(values[0], position_count, corner.vertex_index);
+
+            if (kind < 0)
+            {
+                return false;
+            }
+
+            flags |= kind ? 1u : 0u;
+
+            if (values[1] != 0)
+            {
+                kind = resolve_index(values[1], texcoord_count, corner.texcoord_index);
+                flags |= kind > 0 ? 4u : 0u;
+            }
+
+            if (values[2] != 0)
+            {
+                kind = resolve_index(values[2], normal_count, corner.normal_index);
+                flags |= kind > 0 ? 2u : 0u;
+            }
+
+            corners.push_back(corner);
+            relative_flags.push_back(flags);
+        }
+
+        if (corners.size() < 3)
+        {
+            return false;
+        }
+
+        // triangle fan around the first corner
+        for (size_t idx = 1; idx + 1 < corners.size(); idx++)
+        {
+            const size_t fan[3] = {0, idx, idx + 1};
+
+            for (size_t corner_idx : fan)
+            {
+                size_t flat_position = chunk.indices.size() * 3;
+                unsigned char flags = relative_flags[corner_idx];
+
+                // component order matches tinyobj::index_t: vertex, normal, texcoord
+                for (size_t component = 0; component < 3; component++)
+                {
+                    if (flags & (1u << component))
+                    {
+                        chunk.relative_components.push_back(flat_position + component);
+                    }
+                }
+
+                chunk.indices.push_back(corners[corner_idx]);
+            }
+        }
+
+        return true;
+    }
+
+    ///
+    /// @brief Parses one line aligned slice of the file.
+    ///
+    static void parse_chunk(obj_chunk_t& chunk)
+    {
+        // rough pre-sizing from the chunk size keeps the arrays from reallocating too often
+        size_t estimated_lines = static_cast<size_t>(chunk.end - chunk.begin) / 32;
+        chunk.positions.reserve(estimated_lines);
+        chunk.indices.reserve(estimated_lines * 2);
+
+        const char* cursor = chunk.begin;
+
+        while (cursor < chunk.end && chunk.error.empty())
+        {
+            const auto* line_end = static_cast<const char*>(std::memchr(cursor, '\n', chunk.end - cursor));
+
+            if (line_end == nullptr)
+            {
+                line_end = chunk.end;
+            }
+
+            const char* line = skip_blanks(cursor, line_end);
+
+            if (line < line_end)
+            {
+                if (starts_with_keyword(line, line_end, "v"))
+                {
+                    float values[3] = {0.0f, 0.0f, 0.0f};
+                    parse_floats(line + 1, line_end, values, 3);
+                    chunk.positions.insert(chunk.positions.end(), values, values + 3);
+                }
+                else if (starts_with_keyword(line, line_end, "vn"))
+                {
+                    float values[3] = {0.0f, 0.0f, 0.0f};
+                    parse_floats(line + 2, line_end, values, 3);
+                    chunk.normals.insert(chunk.normals.end(), values, values + 3);
+                }
+                else if (starts_with_keyword(line, line_end, "vt"))
+                {
+                    float values[2] = {0.0f, 0.0f};
+                    parse_floats(line + 2, line_end, values, 2);
+                    chunk.texcoords.insert(chunk.texcoords.end(), values, values + 2);
+                }
+                else if (starts_with_keyword(line, line_end, "f"))
+                {
+                    if (!parse_face(line + 1, line_end, chunk))
+                    {
+                        chunk.error = "invalid face: " + std::string(line, line_end);
+                    }
+                }
+                else if (starts_with_keyword(line, line_end, "o") || starts_with_keyword(line, line_end, "g"))
+                {
+                    chunk.events.push_back({chunk.indices.size() / 3, OBJ_EVENT::GROUP, read_name(line + 1, line_end)});
+                }
+                else if (starts_with_keyword(line, line_end, "usemtl"))
+                {
+                    chunk.events.push_back({chunk.indices.size() / 3, OBJ_EVENT::USE_MATERIAL, read_name(line + 6, line_end)});
+                }
+                else if (starts_with_keyword(line, line_end, "mtllib"))
+                {
+                    const char* name = line + 6;
+
+                    while ((name = skip_blanks(name, line_end)) < line_end)
+                    {
+                        const char* name_end = name;
+
+                        while (name_end < line_end && !is_blank(*name_end))
+                        {
+                            name_end++;
+                        }
+
+                        chunk.material_libraries.emplace_back(name, name_end);
+                        name = name_end;
+                    }
+                }
+            }
+
+            cursor = line_end + 1;
+        }
+    }
+
+    ///
+    /// @brief Copies a chunk into the merged arrays and turns its indices global.
+    ///
+    static bool merge_chunk(obj_chunk_t& chunk, tinyobj::attrib_t& attrib)
+    {
+        std::copy(chunk.positions.begin(), chunk.positions.end(), attrib.vertices.begin() + chunk.position_offset * 3);
+        std::copy(chunk.normals.begin(), chunk.normals.end(), attrib.normals.begin() + chunk.normal_offset * 3);
+        std::copy(chunk.texcoords.begin(), chunk.texcoords.end(), attrib.texcoords.begin() + chunk.texcoord_offset * 2);
+
+        const int offsets[3] = {chunk.position_offset, chunk.normal_offset, chunk.texcoord_offset};
+
+        for (size_t flat_position : chunk.relative_components)
+        {
+            tinyobj::index_t& corner = chunk.indices[flat_position / 3];
+            int* components[3] = {&corner.vertex_index, &corner.normal_index, &corner.texcoord_index};
+
+            *components[flat_position % 3] += offsets[flat_position % 3];
+        }
+
+        const int position_count = static_cast<int>(attrib.vertices.size() / 3);
+        const int normal_count = static_cast<int>(attrib.normals.size() / 3);
+        const int texcoord_count = static_cast<int>(attrib.texcoords.size() / 2);
+
+        for (const auto& corner : chunk.indices)
+        {
+            if (corner.vertex_index < 0 || corner.vertex_index >= position_count ||
+                corner.normal_index < -1 || corner.normal_index >= normal_count ||
+                corner.texcoord_index < -1 || corner.texcoord_index >= texcoord_count)
+            {
+                chunk.error = "face index out of range";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ///
+    /// @brief Appends a range of chunk triangles to a shape.
+    ///
+    static void append_triangles(const obj_chunk_t& chunk,
+                                 size_t first_triangle,
+                                 size_t last_triangle,
+                                 int material_id,
+                                 tinyobj::shape_t& shape)
+    {
+        if (last_triangle <= first_triangle)
+        {
+            return;
+        }
+
+        size_t triangle_count = last_triangle - first_triangle;
+
+        shape.mesh.indices.insert(shape.mesh.indices.end(),
+                                  chunk.indices.begin() + static_cast<std::ptrdiff_t>(first_triangle * 3),
+                                  chunk.indices.begin() + static_cast<std::ptrdiff_t>(last_triangle * 3));
+
+        shape.mesh.num_face_vertices.insert(shape.mesh.num_face_vertices.end(), triangle_count, 3);
+        shape.mesh.material_ids.insert(shape.mesh.material_ids.end(), triangle_count, material_id);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ObjParser::ObjParser(ThreadPool& thread_pool)
+        : m_thread_pool{thread_pool}
+    {
+    }
+
+    bool ObjParser::parse(const std::string& file_path,
+                          const std::string& base_path,
+                          tinyobj::attrib_t& attrib,
+                          std::vector<tinyobj::shape_t>& shapes,
+                          std::vector<tinyobj::material_t>& materials,
+                          std::string& error)
+    {
+        MappedFile file(file_path);
+
+        if (!file.is_open())
+        {
+            error = "could not map " + file_path;
+            return false;
+        }
+
+        // one chunk per worker plus one for the calling thread
+        size_t chunk_count = std::min(this->m_thread_pool.get_thread_count() + 1,
+                                      file.size() / OBJ_MIN_CHUNK_SIZE);
+        chunk_count = std::max<size_t>(chunk_count, 1);
+
+        std::vector<obj_chunk_t> chunks(chunk_count);
+
+        const char* file_begin = file.data();
+        const char* file_end = file.data() + file.size();
+        const char* chunk_begin = file_begin;
+
+        for (size_t idx = 0; idx < chunk_count; idx++)
+        {
+            const char* chunk_end = file_end;
+
+            if (idx + 1 < chunk_count)
+            {
+                // move the split forward to the next line boundary
+                chunk_end = std::max(chunk_begin, file_begin + file.size() * (idx + 1) / chunk_count);
+                const auto* newline = static_cast<const char*>(std::memchr(chunk_end, '\n', file_end - chunk_end));
+                chunk_end = newline != nullptr ? newline + 1 : file_end;
+            }
+
+            chunks[idx].begin = chunk_begin;
+            chunks[idx].end = chunk_end;
+            chunk_begin = chunk_end;
+        }
+
+        // parse every chunk, the calling thread takes the first one
+        std::vector<std::future<void>> parse_tasks{};
+
+        for (size_t idx = 1; idx < chunk_count; idx++)
+        {
+            parse_tasks.push_back(this->m_thread_pool.submit([&chunk = chunks[idx]]() { parse_chunk(chunk); }));
+        }
+
+        parse_chunk(chunks[0]);
+
+        for (auto& task : parse_tasks)
+        {
+            this->m_thread_pool.wait(task);
+        }
+
+        // prefix sum of the attribute counts gives every chunk its global offsets
+        int position_total = 0;
+        int normal_total = 0;
+        int texcoord_total = 0;
+
+        for (auto& chunk : chunks)
+        {
+            if (!chunk.error.empty())
+            {
+                error = chunk.error;
+                return false;
+            }
+
+            chunk.position_offset = position_total;
+            chunk.normal_offset = normal_total;
+            chunk.texcoord_offset = texcoord_total;
+
+            position_total += static_cast<int>(chunk.positions.size() / 3);
+            normal_total += static_cast<int>(chunk.normals.size() / 3);
+            texcoord_total += static_cast<int>(chunk.texcoords.size() / 2);
+        }
+
+        attrib = tinyobj::attrib_t{};
+        attrib.vertices.resize(static_cast<size_t>(position_total) * 3);
+        attrib.normals.resize(static_cast<size_t>(normal_total) * 3);
+        attrib.texcoords.resize(static_cast<size_t>(texcoord_total) * 2);
+
+        std::vector<std::future<bool>> merge_tasks{};
+
+        for (size_t idx = 1; idx < chunk_count; idx++)
+        {
+            merge_tasks.push_back(this->m_thread_pool.submit([&chunk = chunks[idx], &attrib]()
+            {
+                return merge_chunk(chunk, attrib);
+            }));
+        }
+
+        bool merged = merge_chunk(chunks[0], attrib);
+
+        for (auto& task : merge_tasks)
+        {
+            this->m_thread_pool.wait(task);
+            merged = task.get() && merged;
+        }
+
+        if (!merged)
+        {
+            error = "face index out of range in " + file_path;
+            return false;
+        }
+
+        // material libraries, the first material with a given name wins
+        materials.clear();
+        std::vector<std::string> material_names{};
+
+        for (const auto& chunk : chunks)
+        {
+            for (const auto& library : chunk.material_libraries)
+            {
+                std::string library_path = (std::filesystem::path(base_path) / library).string();
+
+                if (!parse_material_library(library_path, materials, material_names))
+                {
+                    error += "could not read material library " + library_path + "\n";
+                }
+            }
+        }
+
+        std::unordered_map<std::string, int> material_ids{};
+
+        for (size_t idx = 0; idx < material_names.size(); idx++)
+        {
+            material_ids.emplace(material_names[idx], static_cast<int>(idx));
+        }
+
+        // shapes are assembled in file order, o/g starts a new shape
+        shapes.clear();
+        tinyobj::shape_t current_shape{};
+        int current_material = -1;
+
+        for (const auto& chunk : chunks)
+        {
+            size_t triangle_cursor = 0;
+
+            for (const auto& event : chunk.events)
+            {
+                append_triangles(chunk, triangle_cursor, event.triangle_offset, current_material, current_shape);
+                triangle_cursor = event.triangle_offset;
+
+                if (event.type == OBJ_EVENT::GROUP)
+                {
+                    if (!current_shape.mesh.indices.empty())
+                    {
+                        shapes.push_back(std::move(current_shape));
+                        current_shape = tinyobj::shape_t{};
+                    }
+
+                    current_shape.name = event.name;
+                }
+                else
+                {
+                    auto material = material_ids.find(event.name);
+                    current_material = material != material_ids.end() ? material->second : -1;
+                }
+            }
+
+            append_triangles(chunk, triangle_cursor, chunk.indices.size() / 3, current_material, current_shape);
+        }
+
+        if (!current_shape.mesh.indices.empty())
+        {
+            shapes.push_back(std::move(current_shape));
+        }
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    bool ObjParser::parse_material_library(const std::string& file_path,
+                                           std::vector<tinyobj::material_t>& materials,
+                                           std::vector<std::string>& material_names)
+    {
+        std::ifstream library_file(file_path);
+
+        if (!library_file)
+        {
+            return false;
+        }
+
+        tinyobj::material_t* material = nullptr;
+        std::string line{};
+
+        while (std::getline(library_file, line))
+        {
+            const char* cursor = skip_blanks(line.data(), line.data() + line.size());
+            const char* end = line.data() + line.size();
+
+            if (starts_with_keyword(cursor, end, "newmtl"))
+            {
+                std::string name = read_name(cursor + 6, end);
+
+                if (std::find(material_names.begin(), material_names.end(), name) != material_names.end())
+                {
+                    // duplicate name, keep parsing into a throw-away material
+                    thread_local tinyobj::material_t ignored{};
+                    ignored = tinyobj::material_t{};
+                    material = &ignored;
+                    continue;
+                }
+
+                materials.emplace_back();
+                material_names.push_back(name);
+                material = &materials.back();
+                material->name = name;
+            }
+            else if (material == nullptr)
+            {
+                continue;
+            }
+            else if (starts_with_keyword(cursor, end, "Ka"))
+            {
+                parse_floats(cursor + 2, end, material->ambient, 3);
+            }
+            else if (starts_with_keyword(cursor, end, "Kd"))
+            {
+                parse_floats(cursor + 2, end, material->diffuse, 3);
+            }
+            else if (starts_with_keyword(cursor, end, "Ks"))
+            {
+                parse_floats(cursor + 2, end, material->specular, 3);
+            }
+            else if (starts_with_keyword(cursor, end, "map_Ka"))
+            {
+                material->ambient_texname = read_name(cursor + 6, end);
+            }
+            else if (starts_with_keyword(cursor, end, "map_Kd"))
+            {
+                material->diffuse_texname = read_name(cursor + 6, end);
+            }
+            else if (starts_with_keyword(cursor, end, "map_Ks"))
+            {
+                material->specular_texname = read_name(cursor + 6, end);
+            }
+        }
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
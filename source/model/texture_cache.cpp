@@ -0,0 +1,185 @@
+///
+/// @file texture_cache.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the TextureCache class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <filesystem>
+#include "texture_cache.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    TextureCache::TextureCache()
+        : m_registry{std::make_shared<registry_t>()}
+    {
+        this->m_registry->stats = {0, 0, 0, 0};
+    }
+
+    texture_handle_t TextureCache::find(const std::string& canonical_path)
+    {
+        std::lock_guard lock(this->m_registry->mutex);
+
+        auto entry = this->m_registry->by_path.find(canonical_path);
+
+        if (entry == this->m_registry->by_path.end())
+        {
+            return nullptr;
+        }
+
+        return this->record_hit(entry->second.lock());
+    }
+
+    texture_handle_t TextureCache::find_content(const std::string& canonical_path, uint64_t content_hash)
+    {
+        std::lock_guard lock(this->m_registry->mutex);
+
+        auto entry = this->m_registry->by_content.find(content_hash);
+
+        if (entry == this->m_registry->by_content.end())
+        {
+            return nullptr;
+        }
+
+        texture_handle_t texture = this->record_hit(entry->second.lock());
+
+        if (texture)
+        {
+            this->m_registry->by_path[canonical_path] = texture;
+        }
+
+        return texture;
+    }
+
+    texture_handle_t TextureCache::insert(const image_data_t& image_data)
+    {
+        if (!image_data.pixels && !image_data.compressed)
+        {
+            return nullptr;
+        }
+
+        std::string canonical_path = canonicalize(image_data.path);
+
+        // another load may have uploaded the same texture since the decode started
+        if (texture_handle_t texture = this->find(canonical_path))
+        {
+            return texture;
+        }
+
+        if (texture_handle_t texture = this->find_content(canonical_path, image_data.content_hash))
+        {
+            return texture;
+        }
+
+        auto* cached_texture = new cached_texture_t{};
+        cached_texture->id = TextureLoader::upload(image_data);
+        cached_texture->path = canonical_path;
+        cached_texture->content_hash = image_data.content_hash;
+
+        if (image_data.compressed)
+        {
+            cached_texture->byte_size = CompressedTexture::get_byte_size(*image_data.compressed);
+        }
+        else
+        {
+            // the mip chain adds a third of the base level
+            cached_texture->byte_size
+                = static_cast<size_t>(image_data.width) * static_cast<size_t>(image_data.height) * 4 * 4 / 3;
+        }
+
+        std::weak_ptr<registry_t> registry = this->m_registry;
+
+        texture_handle_t texture(cached_texture, [registry](const cached_texture_t* released)
+        {
+            glDeleteTextures(1, &released->id);
+
+            if (std::shared_ptr<registry_t> owner = registry.lock())
+            {
+                std::lock_guard lock(owner->mutex);
+
+                owner->stats.bytes_resident -= released->byte_size;
+
+                auto by_path = owner->by_path.find(released->path);
+
+                if (by_path != owner->by_path.end() && by_path->second.expired())
+                {
+                    owner->by_path.erase(by_path);
+                }
+
+                auto by_content = owner->by_content.find(released->content_hash);
+
+                if (by_content != owner->by_content.end() && by_content->second.expired())
+                {
+                    owner->by_content.erase(by_content);
+                }
+            }
+
+            delete released;
+        });
+
+        std::lock_guard lock(this->m_registry->mutex);
+
+        this->m_registry->by_path[canonical_path] = texture;
+        this->m_registry->by_content[image_data.content_hash] = texture;
+        this->m_registry->stats.misses++;
+        this->m_registry->stats.bytes_resident += cached_texture->byte_size;
+
+        return texture;
+    }
+
+    texture_cache_stats_t TextureCache::get_stats() const
+    {
+        std::lock_guard lock(this->m_registry->mutex);
+
+        return this->m_registry->stats;
+    }
+
+    std::string TextureCache::canonicalize(const std::string& path)
+    {
+        std::error_code error{};
+        std::filesystem::path canonical_path = std::filesystem::weakly_canonical(path, error);
+
+        if (error)
+        {
+            canonical_path = std::filesystem::path(path).lexically_normal();
+        }
+
+        return canonical_path.make_preferred().string();
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    texture_handle_t TextureCache::record_hit(const texture_handle_t& texture)
+    {
+        if (texture)
+        {
+            this->m_registry->stats.hits++;
+            this->m_registry->stats.bytes_saved += texture->byte_size;
+        }
+
+        return texture;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,221 @@
+///
+/// @file texture_loader.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the TextureLoader class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "texture_loader.hpp"
+#include "core_components.hpp"
+#include "hash_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stb_image.h>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    std::future<image_data_t> TextureLoader::decode_async(const std::string& file_name)
+    {
+        if (CoreComponents::thread_pool)
+        {
+            return CoreComponents::thread_pool->submit([file_name]() { return decode(file_name); });
+        }
+
+        std::promise<image_data_t> image{};
+        image.set_value(decode(file_name));
+
+        return image.get_future();
+    }
+
+    void TextureLoader::wait(const std::future<image_data_t>& image)
+    {
+        if (CoreComponents::thread_pool)
+        {
+            CoreComponents::thread_pool->wait(image);
+        }
+        else
+        {
+            image.wait();
+        }
+    }
+
+    image_data_t TextureLoader::decode(const std::string& file_name)
+    {
+        image_data_t image_data{file_name, 0, 0, nullptr, 0, nullptr, nullptr};
+
+        const std::shared_ptr<TextureCache>& texture_cache = CoreComponents::texture_cache;
+        std::string canonical_path = TextureCache::canonicalize(file_name);
+
+        if (texture_cache && (image_data.texture = texture_cache->find(canonical_path)))
+        {
+            return image_data;
+        }
+
+        auto compressed = std::make_shared<compressed_image_t>();
+
+        if (CompressedTexture::load(file_name, *compressed))
+        {
+            image_data.content_hash = compressed->source_hash;
+            image_data.width = compressed->levels.front().width;
+            image_data.height = compressed->levels.front().height;
+
+            if (texture_cache && (image_data.texture = texture_cache->find_content(canonical_path, image_data.content_hash)))
+            {
+                return image_data;
+            }
+
+            image_data.compressed = std::move(compressed);
+
+            return image_data;
+        }
+
+        std::vector<unsigned char> file_bytes = read_file(file_name);
+
+        image_data.content_hash = fnv1a_hash(file_bytes.data(), file_bytes.size());
+
+        if (texture_cache && (image_data.texture = texture_cache->find_content(canonical_path, image_data.content_hash)))
+        {
+            return image_data;
+        }
+
+        decode_pixels(file_bytes, image_data);
+
+        return image_data;
+    }
+
+    GLuint TextureLoader::upload(const image_data_t& image_data)
+    {
+        if (image_data.compressed)
+        {
+            if (CompressedTexture::is_supported())
+            {
+                return CompressedTexture::upload(*image_data.compressed);
+            }
+
+            image_data_t source_image = image_data;
+            source_image.compressed = nullptr;
+
+            if (!decode_pixels(read_file(image_data.path), source_image))
+            {
+                return 0;
+            }
+
+            return upload(source_image);
+        }
+
+        if (!image_data.pixels)
+        {
+            return 0;
+        }
+
+        GLuint texture_id;
+        glGenTextures(1, &texture_id);
+        glBindTexture(GL_TEXTURE_2D, texture_id);
+
+        glTexImage2D(
+            GL_TEXTURE_2D,
+            0,
+            GL_SRGB,
+            //GL_SRGB,//GL_RGBA,
+            image_data.width,
+            image_data.height,
+            0,
+            GL_RGBA,
+            GL_UNSIGNED_BYTE,
+            image_data.pixels.get()
+        );
+
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        return texture_id;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureLoader::decode_pixels(const std::vector<unsigned char>& file_bytes, image_data_t& image_data)
+    {
+        int x, y, n;
+        int force_channels = 4;
+        uint8_t* data = stbi_load_from_memory(file_bytes.data(),
+                                              static_cast<int>(file_bytes.size()),
+                                              &x,
+                                              &y,
+                                              &n,
+                                              force_channels);
+
+        if (!data)
+        {
+            fprintf(stderr, "ERROR: could not load %s\n", image_data.path.c_str());
+            return false;
+        }
+
+        image_data.pixels = std::shared_ptr<unsigned char>(data, stbi_image_free);
+        image_data.width = x;
+        image_data.height = y;
+
+        // NPOT check
+        if ((x & (x - 1)) != 0 || (y & (y - 1)) != 0)
+        {
+            fprintf(stderr, "WARNING: texture %s is not power-of-2 dimensions\n", image_data.path.c_str());
+        }
+
+        flip_rows(data, static_cast<size_t>(x) * force_channels, y);
+
+        return true;
+    }
+
+    std::vector<unsigned char> TextureLoader::read_file(const std::string& file_name)
+    {
+        std::ifstream file(file_name, std::ios::binary);
+
+        return std::vector<unsigned char>((std::istreambuf_iterator<char>(file)),
+                                          std::istreambuf_iterator<char>());
+    }
+
+    void TextureLoader::flip_rows(unsigned char* pixels, size_t row_size, int height)
+    {
+        int half_height = height / 2;
+
+        for (int row = 0; row < half_height; row++)
+        {
+            unsigned char* top = pixels + row * row_size;
+            unsigned char* bottom = pixels + (height - row - 1) * row_size;
+
+            // swap_ranges over contiguous bytes compiles to vector loads and stores
+            std::swap_ranges(top, top + row_size, bottom);
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -117,6 +117,13 @@ namespace YB
         return this->m_camera_front_direction;
     }
 
+    glm::vec3 Camera::get_camera_position() noexcept
+    {
+        std::lock_guard lock(this->m_mutex);
+
+        return this->m_camera_position;
+    }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Private Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,26 @@ namespace YB
     ///
     std::shared_ptr<Camera> CoreComponents::camera{nullptr};
 
+    ///
+    /// @brief Static member initialization for the ThreadPool component.
+    ///
+    std::shared_ptr<ThreadPool> CoreComponents::thread_pool{nullptr};
+
+    ///
+    /// @brief Static member initialization for the TextureCache component.
+    ///
+    std::shared_ptr<TextureCache> CoreComponents::texture_cache{std::make_shared<TextureCache>()};
+
+    ///
+    /// @brief Static member initialization for the GeometryArena component.
+    ///
+    std::shared_ptr<GeometryArena> CoreComponents::geometry_arena{std::make_shared<GeometryArena>()};
+
+    ///
+    /// @brief Static member initialization for the AssetManager component.
+    ///
+    std::shared_ptr<AssetManager> CoreComponents::asset_manager{std::make_shared<AssetManager>()};
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
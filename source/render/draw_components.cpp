@@ -29,6 +29,16 @@ namespace YB
     ///
     std::shared_ptr<Shader> DrawComponents::shader{nullptr};
 
+    ///
+    /// @brief Static member initialization for the shader library.
+    ///
+    std::shared_ptr<ShaderLibrary> DrawComponents::shader_library{nullptr};
+
+    ///
+    /// @brief Static member initialization for the uniform buffers.
+    ///
+    std::shared_ptr<UniformBuffers> DrawComponents::uniform_buffers{nullptr};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////
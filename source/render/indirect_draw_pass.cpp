@@ -0,0 +1,532 @@
+///
+/// @file indirect_draw_pass.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the IndirectDrawPass class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include "core_components.hpp"
+#include "draw_components.hpp"
+#include "indirect_draw_pass.hpp"
+#include "uniform_blocks.hpp"
+#include "uniform_buffers.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr GLuint OBJECT_BINDING = 0; ///< Storage buffer binding of the objects.
+    constexpr GLuint DRAW_BINDING = 1; ///< Storage buffer binding of the draw records.
+    constexpr GLuint LOD_BINDING = 2; ///< Storage buffer binding of the level records.
+    constexpr GLuint COMMAND_BINDING = 3; ///< Storage buffer binding of the indirect commands.
+
+    constexpr GLint VIEW_PROJECTION_LOCATION = 0; ///< Uniform location of the view projection matrix.
+    constexpr GLint CAMERA_POSITION_LOCATION = 1; ///< Uniform location of the camera position.
+    constexpr GLint PIXELS_PER_UNIT_LOCATION = 2; ///< Uniform location of the pixels per unit at distance 1.
+    constexpr GLint PIXEL_ERROR_LOCATION = 3; ///< Uniform location of the level of detail threshold.
+    constexpr GLint DRAW_COUNT_LOCATION = 4; ///< Uniform location of the number of draws.
+
+    constexpr GLuint CULL_GROUP_SIZE = 64; ///< Draws culled by one compute work group.
+    constexpr size_t COMMAND_SIZE = 5 * sizeof(GLuint); ///< Size of a DrawElementsIndirectCommand.
+    constexpr GLint MIN_VERTEX_STORAGE_BLOCKS = 2; ///< Storage buffers the vertex shader reads.
+
+    ///
+    /// @brief Storage buffers shared by the culling and drawing programs.
+    ///
+    constexpr const char* SHARED_BUFFERS_SOURCE = R"(
+struct Object
+{
+    mat4 model;
+    mat4 normal;
+};
+
+struct DrawRecord
+{
+    mat4 positionTransform;
+    vec4 sphere;
+    uint lodOffset;
+    uint lodCount;
+    int baseVertex;
+    uint object;
+};
+
+layout(std430, binding = 0) readonly buffer Objects { Object objects[]; };
+layout(std430, binding = 1) readonly buffer Draws { DrawRecord draws[]; };
+)";
+
+    ///
+    /// @brief Culls every draw against the frustum, picks its level and writes its command.
+    ///
+    constexpr const char* CULL_SOURCE = R"(
+layout(local_size_x = 64) in;
+
+struct LodRecord
+{
+    uint indexCount;
+    uint firstIndex;
+    float error;
+    uint padding;
+};
+
+struct Command
+{
+    uint count;
+    uint instanceCount;
+    uint firstIndex;
+    int baseVertex;
+    uint baseInstance;
+};
+
+layout(std430, binding = 2) readonly buffer Lods { LodRecord lods[]; };
+layout(std430, binding = 3) writeonly buffer Commands { Command commands[]; };
+
+layout(location = 0) uniform mat4 viewProjection;
+layout(location = 1) uniform vec3 cameraPosition;
+layout(location = 2) uniform float pixelsPerUnitAtOne;
+layout(location = 3) uniform float pixelError;
+layout(location = 4) uniform uint drawCount;
+
+void main()
+{
+    uint id = gl_GlobalInvocationID.x;
+
+    if (id >= drawCount)
+    {
+        return;
+    }
+
+    DrawRecord draw = draws[id];
+    mat4 model = objects[draw.object].model;
+
+    vec3 center = (model * vec4(draw.sphere.xyz, 1.0)).xyz;
+    float scale = max(length(model[0].xyz), max(length(model[1].xyz), length(model[2].xyz)));
+    float radius = draw.sphere.w * scale;
+
+    // Gribb-Hartmann planes, the rows of the view projection matrix
+    mat4 rows = transpose(viewProjection);
+    vec4 planes[6] = vec4[6](rows[3] + rows[0], rows[3] - rows[0],
+                             rows[3] + rows[1], rows[3] - rows[1],
+                             rows[3] + rows[2], rows[3] - rows[2]);
+
+    bool visible = true;
+
+    for (int idx = 0; idx < 6; idx++)
+    {
+        vec4 plane = planes[idx] / length(planes[idx].xyz);
+        visible = visible && dot(plane.xyz, center) + plane.w >= -radius;
+    }
+
+    float nearestDistance = max(length(center - cameraPosition) - radius, 0.001);
+    float pixelsPerUnit = pixelsPerUnitAtOne * scale / nearestDistance;
+
+    uint lod = 0;
+
+    while (pixelError > 0.0 && lod + 1 < draw.lodCount && lods[draw.lodOffset + lod + 1].error * pixelsPerUnit <= pixelError)
+    {
+        lod++;
+    }
+
+    LodRecord level = lods[draw.lodOffset + lod];
+
+    commands[id] = Command(level.indexCount, visible ? 1u : 0u, level.firstIndex, draw.baseVertex, id);
+}
+)";
+
+    ///
+    /// @brief Fetches the transforms of its draw through the draw id attribute.
+    ///
+    constexpr const char* VERTEX_SOURCE = R"(
+layout(location = 0) in vec3 vPosition;
+layout(location = 1) in vec3 vNormal;
+layout(location = 2) in vec2 vTexCoords;
+layout(location = 3) in uint drawId;
+
+out vec3 fPosition;
+out vec3 fNormal;
+out vec2 fTexCoords;
+
+void main()
+{
+    DrawRecord draw = draws[drawId];
+    Object object = objects[draw.object];
+
+    vec4 position = object.model * draw.positionTransform * vec4(vPosition, 1.0);
+
+    fPosition = position.xyz;
+    fNormal = mat3(object.normal) * vNormal;
+    fTexCoords = vTexCoords;
+
+    gl_Position = frame.viewProjection * position;
+}
+)";
+
+    ///
+    /// @brief Shades with the directional light of FrameBlock, in world space.
+    ///
+    constexpr const char* FRAGMENT_SOURCE = R"(
+in vec3 fPosition;
+in vec3 fNormal;
+in vec2 fTexCoords;
+
+uniform sampler2D diffuseTexture;
+uniform sampler2D specularTexture;
+
+out vec4 fColor;
+
+void main()
+{
+    vec3 normal = normalize(fNormal);
+    vec3 light = normalize(frame.lightDir.xyz);
+    vec3 halfway = normalize(light + normalize(frame.cameraPosition.xyz - fPosition));
+
+    vec3 diffuse = texture(diffuseTexture, fTexCoords).rgb;
+    float specular = pow(max(dot(normal, halfway), 0.0), 32.0) * texture(specularTexture, fTexCoords).r;
+
+    fColor = vec4((0.2 + max(dot(normal, light), 0.0)) * frame.lightColor.rgb * diffuse + specular * frame.lightColor.rgb, 1.0);
+}
+)";
+
+    constexpr const char* VERSION_SOURCE = "#version 430 core\n"; ///< Prepended to every stage.
+
+    ///
+    /// @brief Concatenates the sources of a stage.
+    ///
+    static std::string join_sources(std::initializer_list<const char*> sources)
+    {
+        std::string source{VERSION_SOURCE};
+
+        for (const char* part: sources)
+        {
+            source += part;
+        }
+
+        return source;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    IndirectDrawPass::IndirectDrawPass()
+        : m_cull_program{0},
+          m_draw_program{0},
+          m_draw_uniforms{},
+          m_object_buffer{0},
+          m_draw_buffer{0},
+          m_lod_buffer{0},
+          m_command_buffer{0},
+          m_draw_id_buffer{0},
+          m_objects{},
+          m_batches{},
+          m_model_count{0},
+          m_draw_count{0},
+          m_triangle_count{0}
+    {
+        std::string cull_source = join_sources({SHARED_BUFFERS_SOURCE, CULL_SOURCE});
+        std::string vertex_source = join_sources({SHARED_BUFFERS_SOURCE, FRAME_BLOCK_SOURCE, VERTEX_SOURCE});
+        std::string fragment_source = join_sources({FRAME_BLOCK_SOURCE, FRAGMENT_SOURCE});
+
+        this->m_cull_program = create_program({{GL_COMPUTE_SHADER, cull_source.c_str()}});
+        this->m_draw_program = create_program({{GL_VERTEX_SHADER, vertex_source.c_str()},
+                                               {GL_FRAGMENT_SHADER, fragment_source.c_str()}});
+
+        // the view and the light come from the per-frame block, like in the CPU path
+        if (this->m_draw_program != 0 && !UniformBuffers::bind_block(this->m_draw_program, FRAME_BLOCK_NAME))
+        {
+            std::cerr << "ERROR: indirect draw program does not read " << FRAME_BLOCK_NAME << "\n";
+
+            glDeleteProgram(this->m_draw_program);
+            this->m_draw_program = 0;
+        }
+
+        if (this->m_draw_program != 0)
+        {
+            this->m_draw_uniforms.reflect(this->m_draw_program);
+        }
+
+        glGenBuffers(1, &this->m_object_buffer);
+        glGenBuffers(1, &this->m_draw_buffer);
+        glGenBuffers(1, &this->m_lod_buffer);
+        glGenBuffers(1, &this->m_command_buffer);
+        glGenBuffers(1, &this->m_draw_id_buffer);
+
+        // the attribute is also fetched by the direct draws, which read the first id
+        const GLuint first_id = 0;
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, this->m_draw_id_buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, sizeof(first_id), &first_id, GL_STATIC_DRAW);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        CoreComponents::geometry_arena->set_draw_id_buffer(this->m_draw_id_buffer);
+    }
+
+    IndirectDrawPass::~IndirectDrawPass()
+    {
+        CoreComponents::geometry_arena->set_draw_id_buffer(0);
+
+        GLuint buffers[] = {this->m_object_buffer,
+                            this->m_draw_buffer,
+                            this->m_lod_buffer,
+                            this->m_command_buffer,
+                            this->m_draw_id_buffer};
+
+        glDeleteBuffers(5, buffers);
+        glDeleteProgram(this->m_cull_program);
+        glDeleteProgram(this->m_draw_program);
+    }
+
+    bool IndirectDrawPass::is_supported() noexcept
+    {
+        if (!GLAD_GL_VERSION_4_3)
+        {
+            return false;
+        }
+
+        // 4.3 only guarantees storage buffers in compute and fragment shaders
+        GLint vertex_storage_blocks = 0;
+        glGetIntegerv(GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &vertex_storage_blocks);
+
+        return vertex_storage_blocks >= MIN_VERTEX_STORAGE_BLOCKS;
+    }
+
+    bool IndirectDrawPass::is_valid() const noexcept
+    {
+        return this->m_cull_program != 0 && this->m_draw_program != 0;
+    }
+
+    void IndirectDrawPass::render(const std::vector<model_handle_t>& models,
+                                  const std::vector<glm::mat4>& model_matrices,
+                                  const lod_settings_t& settings)
+    {
+        if (models.size() != this->m_model_count)
+        {
+            this->rebuild(models);
+        }
+
+        if (this->m_draw_count == 0)
+        {
+            return;
+        }
+
+        this->m_objects.resize(model_matrices.size());
+
+        for (size_t idx = 0; idx < model_matrices.size(); idx++)
+        {
+            this->m_objects[idx] = {model_matrices[idx], glm::inverseTranspose(model_matrices[idx])};
+        }
+
+        // orphaned, so the upload does not wait for the draws of the previous frame
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, this->m_object_buffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER,
+                     static_cast<GLsizeiptr>(this->m_objects.size() * sizeof(object_t)),
+                     nullptr,
+                     GL_STREAM_DRAW);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER,
+                        0,
+                        static_cast<GLsizeiptr>(this->m_objects.size() * sizeof(object_t)),
+                        this->m_objects.data());
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        glm::mat4 view_projection = DrawComponents::shader->projection_matrix * CoreComponents::camera->get_view_matrix();
+        glm::vec3 camera_position = CoreComponents::camera->get_camera_position();
+
+        // projection[1][1] is cot(fov / 2), which maps a unit at distance 1 to half the viewport height
+        float pixels_per_unit_at_one = DrawComponents::shader->projection_matrix[1][1] *
+                                       static_cast<float>(CoreComponents::window->height) * 0.5f;
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, OBJECT_BINDING, this->m_object_buffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_BINDING, this->m_draw_buffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LOD_BINDING, this->m_lod_buffer);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, COMMAND_BINDING, this->m_command_buffer);
+
+        glUseProgram(this->m_cull_program);
+        glUniformMatrix4fv(VIEW_PROJECTION_LOCATION, 1, GL_FALSE, glm::value_ptr(view_projection));
+        glUniform3fv(CAMERA_POSITION_LOCATION, 1, glm::value_ptr(camera_position));
+        glUniform1f(PIXELS_PER_UNIT_LOCATION, pixels_per_unit_at_one);
+        glUniform1f(PIXEL_ERROR_LOCATION, settings.pixel_error);
+        glUniform1ui(DRAW_COUNT_LOCATION, static_cast<GLuint>(this->m_draw_count));
+
+        glDispatchCompute(static_cast<GLuint>((this->m_draw_count + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE), 1, 1);
+
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+
+        glUseProgram(this->m_draw_program);
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->m_command_buffer);
+
+        for (const auto& batch: this->m_batches)
+        {
+            batch.material.bind(this->m_draw_uniforms);
+
+            glBindVertexArray(CoreComponents::geometry_arena->get_buffers(batch.vertex_format).VAO);
+            glMultiDrawElementsIndirect(GL_TRIANGLES,
+                                        batch.index_type,
+                                        reinterpret_cast<const GLvoid*>(batch.first_draw * COMMAND_SIZE),
+                                        static_cast<GLsizei>(batch.draw_count),
+                                        0);
+        }
+
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glBindVertexArray(0);
+
+        CoreComponents::geometry_arena->reset_bindings();
+    }
+
+    size_t IndirectDrawPass::get_triangle_count() const noexcept
+    {
+        return this->m_triangle_count;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    GLuint IndirectDrawPass::create_program(const std::vector<std::pair<GLenum, const char*>>& stages)
+    {
+        GLuint program = glCreateProgram();
+        GLint success = GL_FALSE;
+        GLchar info_log[1024];
+
+        for (const auto& [type, source]: stages)
+        {
+            GLuint shader = glCreateShader(type);
+            glShaderSource(shader, 1, &source, nullptr);
+            glCompileShader(shader);
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+            if (!success)
+            {
+                glGetShaderInfoLog(shader, sizeof(info_log), nullptr, info_log);
+                std::cerr << "ERROR: indirect draw shader compilation failed\n" << info_log << "\n";
+            }
+
+            glAttachShader(program, shader);
+            glDeleteShader(shader);
+        }
+
+        glLinkProgram(program);
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+        if (!success)
+        {
+            glGetProgramInfoLog(program, sizeof(info_log), nullptr, info_log);
+            std::cerr << "ERROR: indirect draw program linking failed\n" << info_log << "\n";
+
+            glDeleteProgram(program);
+            return 0;
+        }
+
+        return program;
+    }
+
+    void IndirectDrawPass::rebuild(const std::vector<model_handle_t>& models)
+    {
+        std::vector<std::vector<draw_record_t>> batch_draws{};
+        std::vector<lod_record_t> lods{};
+
+        this->m_batches.clear();
+        this->m_triangle_count = 0;
+
+        for (size_t object = 0; object < models.size(); object++)
+        {
+            for (const auto& mesh: models[object]->get_meshes())
+            {
+                const std::vector<mesh_lod_t>& mesh_lods = mesh.get_lods();
+                const bounding_sphere_t& mesh_sphere = mesh.get_bounding_sphere();
+
+                glm::vec4 sphere(mesh_sphere.center, mesh_sphere.radius);
+
+                size_t index_size = mesh.get_index_type() == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+                size_t first_index = CoreComponents::geometry_arena->get_index_offset(mesh.get_geometry()) / index_size;
+
+                draw_record_t draw{mesh.get_position_transform(),
+                                   sphere,
+                                   static_cast<GLuint>(lods.size()),
+                                   static_cast<GLuint>(mesh_lods.size()),
+                                   CoreComponents::geometry_arena->get_base_vertex(mesh.get_geometry()),
+                                   static_cast<GLuint>(object)};
+
+                for (const auto& lod: mesh_lods)
+                {
+                    lods.push_back({lod.index_count, static_cast<GLuint>(first_index + lod.index_offset), lod.error, 0});
+                }
+
+                this->m_triangle_count += mesh_lods.front().index_count / 3;
+
+                auto batch = std::find_if(this->m_batches.begin(),
+                                          this->m_batches.end(),
+                                          [&mesh](const batch_t& other)
+                                          {
+                                              return other.vertex_format == mesh.get_vertex_format() &&
+                                                     other.index_type == mesh.get_index_type() &&
+                                                     other.material == mesh.get_material();
+                                          });
+
+                if (batch == this->m_batches.end())
+                {
+                    this->m_batches.push_back({mesh.get_vertex_format(), mesh.get_index_type(), mesh.get_material(), 0, 0});
+                    batch_draws.emplace_back();
+                    batch = this->m_batches.end() - 1;
+                }
+
+                batch_draws[static_cast<size_t>(batch - this->m_batches.begin())].push_back(draw);
+            }
+        }
+
+        // the draws of a batch are stored back to back, so one multi-draw reads their commands
+        std::vector<draw_record_t> draws{};
+
+        for (size_t idx = 0; idx < this->m_batches.size(); idx++)
+        {
+            this->m_batches[idx].first_draw = draws.size();
+            this->m_batches[idx].draw_count = batch_draws[idx].size();
+
+            draws.insert(draws.end(), batch_draws[idx].begin(), batch_draws[idx].end());
+        }
+
+        std::vector<GLuint> draw_ids(std::max<size_t>(draws.size(), 1));
+        std::iota(draw_ids.begin(), draw_ids.end(), 0);
+
+        auto upload = [](GLuint buffer, size_t size, const void* data)
+        {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(size), data, GL_STATIC_DRAW);
+        };
+
+        upload(this->m_draw_buffer, draws.size() * sizeof(draw_record_t), draws.data());
+        upload(this->m_lod_buffer, lods.size() * sizeof(lod_record_t), lods.data());
+        upload(this->m_command_buffer, draws.size() * COMMAND_SIZE, nullptr);
+        upload(this->m_draw_id_buffer, draw_ids.size() * sizeof(GLuint), draw_ids.data());
+
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        this->m_model_count = models.size();
+        this->m_draw_count = draws.size();
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
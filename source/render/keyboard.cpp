@@ -12,9 +12,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "keyboard.hpp"
-#include "directional_light_shader.hpp"
-#include "point_light_shader.hpp"
-#include "solid_shader.hpp"
+#include "draw_components.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -124,27 +122,22 @@ namespace YB
 
     void Keyboard::shader_change_key_pressed() const
     {
+        // the programs are built once by the library, holding a key only hands out the same handle again
         if (this->m_pressed_keys[GLFW_KEY_J])
         {
-            DrawComponents::shader.reset();
-            DrawComponents::shader = std::make_shared<DirectionalLightShader>();
-            DrawComponents::shader->init_uniforms();
+            DrawComponents::shader = DrawComponents::shader_library->get(SHADER_PROGRAM::DIRECTIONAL_LIGHT);
             glClearColor(0.7f, 0.7f, 0.7f, 1.0f);
         }
 
         if (this->m_pressed_keys[GLFW_KEY_K])
         {
-            DrawComponents::shader.reset();
-            DrawComponents::shader = std::make_shared<PointLightShader>();
-            DrawComponents::shader->init_uniforms();
+            DrawComponents::shader = DrawComponents::shader_library->get(SHADER_PROGRAM::POINT_LIGHT);
             glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
         }
 
         if (this->m_pressed_keys[GLFW_KEY_L])
         {
-            DrawComponents::shader.reset();
-            DrawComponents::shader = std::make_shared<SolidShader>();
-            DrawComponents::shader->init_uniforms();
+            DrawComponents::shader = DrawComponents::shader_library->get(SHADER_PROGRAM::SOLID);
             glClearColor(0.7f, 0.7f, 0.7f, 1.0f);
         }
     }
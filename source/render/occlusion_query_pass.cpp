@@ -0,0 +1,395 @@
+///
+/// @file occlusion_query_pass.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the OcclusionQueryPass class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include "core_components.hpp"
+#include "occlusion_query_pass.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/type_ptr.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ///
+    /// @brief Places the corners of the unit cube on the box.
+    ///
+    constexpr const char* BOX_VERTEX_SOURCE = R"(#version 330 core
+layout(location = 0) in vec3 vPosition;
+
+uniform mat4 boxMatrix;
+
+void main()
+{
+    gl_Position = boxMatrix * vec4(vPosition, 1.0);
+}
+)";
+
+    ///
+    /// @brief Writes nothing, the color and depth writes are off while the boxes are drawn.
+    ///
+    constexpr const char* BOX_FRAGMENT_SOURCE = R"(#version 330 core
+void main()
+{
+}
+)";
+
+    ///
+    /// @brief Compiles one stage of the box program.
+    /// @return The shader, 0 if it did not compile.
+    ///
+    static GLuint compile_stage(GLenum type, const char* source)
+    {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+
+        GLint success = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+        if (!success)
+        {
+            GLchar info_log[1024];
+            glGetShaderInfoLog(shader, sizeof(info_log), nullptr, info_log);
+            std::cerr << "ERROR: occlusion query shader compilation failed\n" << info_log << "\n";
+
+            glDeleteShader(shader);
+            return 0;
+        }
+
+        return shader;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    OcclusionQueryPass::OcclusionQueryPass()
+        : m_states{},
+          m_queried{},
+          m_requeried{},
+          m_waiting{},
+          m_draws{},
+          m_box{std::make_shared<BoxMesh>()},
+          m_program{0},
+          m_box_matrix_location{-1},
+          m_frame{0},
+          m_stats{0, 0, 0, 0.0f, 0}
+    {
+        GLuint vertex_shader = compile_stage(GL_VERTEX_SHADER, BOX_VERTEX_SOURCE);
+        GLuint fragment_shader = compile_stage(GL_FRAGMENT_SHADER, BOX_FRAGMENT_SOURCE);
+
+        if (vertex_shader == 0 || fragment_shader == 0)
+        {
+            glDeleteShader(vertex_shader);
+            glDeleteShader(fragment_shader);
+            return;
+        }
+
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vertex_shader);
+        glAttachShader(program, fragment_shader);
+        glLinkProgram(program);
+
+        glDeleteShader(vertex_shader);
+        glDeleteShader(fragment_shader);
+
+        GLint success = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+        if (!success)
+        {
+            GLchar info_log[1024];
+            glGetProgramInfoLog(program, sizeof(info_log), nullptr, info_log);
+            std::cerr << "ERROR: occlusion query program linking failed\n" << info_log << "\n";
+
+            glDeleteProgram(program);
+            return;
+        }
+
+        this->m_program = program;
+        this->m_box_matrix_location = glGetUniformLocation(program, "boxMatrix");
+    }
+
+    OcclusionQueryPass::~OcclusionQueryPass()
+    {
+        this->resize(0);
+
+        glDeleteProgram(this->m_program);
+    }
+
+    bool OcclusionQueryPass::is_supported() noexcept
+    {
+        return GLAD_GL_VERSION_3_3 != 0;
+    }
+
+    bool OcclusionQueryPass::is_valid() const noexcept
+    {
+        return this->m_program != 0;
+    }
+
+    void OcclusionQueryPass::render(const std::vector<uint32_t>& objects,
+                                    const std::vector<aabb_t>& boxes,
+                                    const glm::mat4& view_projection,
+                                    const occlusion_query_callbacks_t& callbacks)
+    {
+        this->m_frame++;
+        this->m_stats = {0, 0, 0, 0.0f, 0};
+
+        this->collect_results();
+
+        this->m_queried.clear();
+        this->m_requeried.clear();
+        this->m_waiting.clear();
+        this->m_draws.clear();
+
+        for (size_t idx = 0; idx < objects.size(); idx++)
+        {
+            query_state_t& state = this->m_states[objects[idx]];
+
+            if (crosses_near_plane(boxes[idx], view_projection))
+            {
+                // the camera is at or inside the box, the object counts as visible
+                state.visible = true;
+            }
+
+            if (!state.visible && state.pending)
+            {
+                // a new query would overwrite the result in flight before it is read
+                this->m_waiting.push_back(idx);
+            }
+            else if (!state.visible)
+            {
+                this->m_queried.push_back(idx);
+            }
+            else if (!state.pending && (this->m_frame + objects[idx]) % VISIBLE_QUERY_INTERVAL == 0)
+            {
+                // spread over the frames, so the queries of the visible objects do not come in waves
+                this->m_requeried.push_back(idx);
+            }
+            else
+            {
+                this->m_draws.push_back(objects[idx]);
+            }
+        }
+
+        // the objects seen last time fill the depth buffer the boxes are tested against
+        if (!this->m_draws.empty())
+        {
+            callbacks.draw(this->m_draws);
+        }
+
+        for (size_t idx : this->m_requeried)
+        {
+            this->begin_query(this->m_states[objects[idx]], false);
+            this->draw_one(objects[idx], callbacks);
+            glEndQuery(GL_ANY_SAMPLES_PASSED);
+        }
+
+        if (!this->m_queried.empty())
+        {
+            this->draw_boxes(objects, boxes, view_projection, callbacks);
+        }
+
+        for (size_t idx : this->m_queried)
+        {
+            this->draw_conditional(objects[idx], callbacks);
+        }
+
+        for (size_t idx : this->m_waiting)
+        {
+            this->draw_conditional(objects[idx], callbacks);
+        }
+    }
+
+    void OcclusionQueryPass::resize(size_t object_count)
+    {
+        for (size_t idx = object_count; idx < this->m_states.size(); idx++)
+        {
+            if (this->m_states[idx].query != 0)
+            {
+                glDeleteQueries(1, &this->m_states[idx].query);
+            }
+        }
+
+        this->m_states.resize(object_count, {0, 0, false, false, false, 0});
+    }
+
+    const occlusion_query_stats_t& OcclusionQueryPass::get_stats() const noexcept
+    {
+        return this->m_stats;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void OcclusionQueryPass::collect_results()
+    {
+        uint64_t total_latency = 0;
+
+        for (auto& state : this->m_states)
+        {
+            if (!state.pending)
+            {
+                continue;
+            }
+
+            GLuint available = GL_FALSE;
+            glGetQueryObjectuiv(state.query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+            if (!available)
+            {
+                this->m_stats.results_pending++;
+                continue;
+            }
+
+            GLuint samples_passed = GL_FALSE;
+            glGetQueryObjectuiv(state.query, GL_QUERY_RESULT, &samples_passed);
+
+            state.pending = false;
+            state.visible = samples_passed != GL_FALSE;
+
+            this->m_stats.results_read++;
+            this->m_stats.objects_skipped += !state.visible ? state.conditional_draws : 0;
+
+            total_latency += this->m_frame - state.issued_frame;
+        }
+
+        if (this->m_stats.results_read > 0)
+        {
+            this->m_stats.average_latency
+                = static_cast<float>(total_latency) / static_cast<float>(this->m_stats.results_read);
+        }
+    }
+
+    bool OcclusionQueryPass::crosses_near_plane(const aabb_t& box, const glm::mat4& view_projection) noexcept
+    {
+        for (int corner = 0; corner < 8; corner++)
+        {
+            glm::vec3 position((corner & 1) ? box.max.x : box.min.x,
+                               (corner & 2) ? box.max.y : box.min.y,
+                               (corner & 4) ? box.max.z : box.min.z);
+
+            glm::vec4 clip = view_projection * glm::vec4(position, 1.0f);
+
+            if (clip.z < -clip.w)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void OcclusionQueryPass::draw_one(uint32_t object, const occlusion_query_callbacks_t& callbacks)
+    {
+        this->m_draws.assign(1, object);
+
+        callbacks.draw(this->m_draws);
+    }
+
+    void OcclusionQueryPass::draw_boxes(const std::vector<uint32_t>& objects,
+                                        const std::vector<aabb_t>& boxes,
+                                        const glm::mat4& view_projection,
+                                        const occlusion_query_callbacks_t& callbacks)
+    {
+        // all boxes first, so the GPU has their results by the time the conditional draws come
+        GLboolean cull_face = glIsEnabled(GL_CULL_FACE);
+
+        glUseProgram(this->m_program);
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glDepthMask(GL_FALSE);
+        glDisable(GL_CULL_FACE);
+
+        for (size_t idx : this->m_queried)
+        {
+            query_state_t& state = this->m_states[objects[idx]];
+
+            glm::mat4 box_matrix = view_projection * BoxMesh::get_box_matrix(boxes[idx]);
+            glUniformMatrix4fv(this->m_box_matrix_location, 1, GL_FALSE, glm::value_ptr(box_matrix));
+
+            this->begin_query(state, true);
+            this->m_box->draw_solid();
+            glEndQuery(GL_ANY_SAMPLES_PASSED);
+        }
+
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glDepthMask(GL_TRUE);
+
+        // the box left its own vertex array bound
+        CoreComponents::geometry_arena->reset_bindings();
+
+        if (cull_face)
+        {
+            glEnable(GL_CULL_FACE);
+        }
+
+        if (callbacks.on_program_changed)
+        {
+            callbacks.on_program_changed();
+        }
+    }
+
+    void OcclusionQueryPass::draw_conditional(uint32_t object, const occlusion_query_callbacks_t& callbacks)
+    {
+        query_state_t& state = this->m_states[object];
+
+        if (!state.conditional)
+        {
+            // the pending query measured a draw of its own, there is no box to wait for
+            this->draw_one(object, callbacks);
+            return;
+        }
+
+        // the GPU waits for the result of the box, the CPU does not
+        glBeginConditionalRender(state.query, GL_QUERY_WAIT);
+
+        this->draw_one(object, callbacks);
+
+        glEndConditionalRender();
+
+        state.conditional_draws++;
+    }
+
+    void OcclusionQueryPass::begin_query(query_state_t& state, bool conditional)
+    {
+        if (state.query == 0)
+        {
+            glGenQueries(1, &state.query);
+        }
+
+        // callers only begin a query once the previous result has been read
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, state.query);
+
+        state.issued_frame = this->m_frame;
+        state.pending = true;
+        state.conditional = conditional;
+        state.conditional_draws = 0;
+
+        this->m_stats.queries_issued++;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
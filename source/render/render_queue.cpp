@@ -0,0 +1,359 @@
+///
+/// @file render_queue.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the RenderQueue class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include "core_components.hpp"
+#include "draw_components.hpp"
+#include "render_queue.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr uint32_t PASS_SHIFT = 62; ///< First bit of the pass in a key.
+    constexpr uint32_t SHADER_SHIFT = 54; ///< First bit of the shader in a key.
+    constexpr uint32_t MATERIAL_SHIFT = 34; ///< First bit of the material in a key.
+    constexpr uint32_t VERTEX_ARRAY_SHIFT = 26; ///< First bit of the vertex array in a key.
+    constexpr uint32_t DEPTH_BITS = 26; ///< Bits of the depth in a key.
+    constexpr uint32_t DEPTH_MASK = (1u << DEPTH_BITS) - 1; ///< Mask of the depth in a key.
+    constexpr size_t RADIX_BUCKETS = 256; ///< Buckets of one radix sort pass, one per byte value.
+
+    ///
+    /// @brief Quantizes a distance so that the order of the results is the order of the distances.
+    ///
+    /// The bits of a positive float grow with its value, so the top bits below
+    /// the sign keep the order without knowing the far plane.
+    ///
+    static uint32_t quantize_depth(float depth) noexcept
+    {
+        uint32_t bits = 0;
+
+        depth = std::max(depth, 0.0f);
+        std::memcpy(&bits, &depth, sizeof(bits));
+
+        return bits >> (31 - DEPTH_BITS);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void RenderQueue::begin_frame(const glm::mat4& view_matrix)
+    {
+        this->m_packets.clear();
+        this->m_entries.clear();
+        this->m_transforms.clear();
+        this->m_range_counts.clear();
+        this->m_range_offsets.clear();
+        this->m_shaders.clear();
+
+        this->m_view_matrix = view_matrix;
+        this->m_stats = {0, 0, 0, 0};
+
+        this->reset_bindings();
+    }
+
+    uint32_t RenderQueue::add_transform(const glm::mat4& model_matrix)
+    {
+        this->m_transforms.push_back(model_matrix);
+
+        return static_cast<uint32_t>(this->m_transforms.size() - 1);
+    }
+
+    void RenderQueue::add_mesh(Shader& shader,
+                               const Mesh& mesh,
+                               const mesh_draw_t& draw,
+                               uint32_t transform,
+                               float depth,
+                               RENDER_PASS pass)
+    {
+        const std::vector<GLsizei>& counts = draw.counts;
+        const std::vector<size_t>& offsets = draw.offsets;
+
+        if (counts.empty())
+        {
+            return;
+        }
+
+        draw_packet_t packet{&shader,
+                             &mesh,
+                             transform,
+                             static_cast<uint32_t>(this->m_range_counts.size()),
+                             static_cast<uint32_t>(counts.size())};
+
+        this->m_range_counts.insert(this->m_range_counts.end(), counts.begin(), counts.end());
+        this->m_range_offsets.insert(this->m_range_offsets.end(), offsets.begin(), offsets.end());
+
+        uint64_t key = make_key(pass, this->get_shader_index(shader), mesh, depth);
+
+        this->m_entries.push_back({key, static_cast<uint32_t>(this->m_packets.size())});
+        this->m_packets.push_back(packet);
+    }
+
+    void RenderQueue::submit()
+    {
+        this->m_scratch.resize(this->m_entries.size());
+
+        radix_sort(this->m_entries, this->m_scratch);
+
+        this->write_objects();
+
+        size_t first_bind_count = Material::get_bind_count();
+
+        for (size_t idx = 0; idx < this->m_entries.size(); idx++)
+        {
+            const draw_packet_t& packet = this->m_packets[this->m_entries[idx].packet];
+            Shader& shader = *packet.shader;
+            const Mesh& mesh = *packet.mesh;
+
+            if (&shader != this->m_bound_shader)
+            {
+                shader.use_shader_program();
+
+                // the view matrix is the same for the whole frame, it only has to reach every program once per switch
+                shader.view_matrix = this->m_view_matrix;
+
+                if (!shader.uses_frame_block)
+                {
+                    shader.uniforms.set(VIEW_UNIFORM, shader.view_matrix);
+                }
+
+                this->m_bound_shader = &shader;
+                this->m_bound_transform = NO_TRANSFORM;
+                this->m_stats.program_switches++;
+            }
+
+            const glm::mat4& model_matrix = this->m_transforms[packet.transform];
+            uint32_t object = this->m_entry_objects[idx];
+
+            if (object != NO_OBJECT)
+            {
+                // the matrices are already in the ring buffer, the draw only points the block at them
+                if (object != this->m_bound_object)
+                {
+                    DrawComponents::uniform_buffers->bind_object(this->m_object_offsets[object]);
+
+                    this->m_bound_object = object;
+                }
+            }
+            else if (packet.transform != this->m_bound_transform)
+            {
+                shader.model_matrix = model_matrix;
+                shader.normal_matrix = glm::mat3(glm::inverseTranspose(this->m_view_matrix * model_matrix));
+
+                shader.uniforms.set(MODEL_UNIFORM, shader.model_matrix);
+                shader.uniforms.set(NORMAL_MATRIX_UNIFORM, shader.normal_matrix);
+
+                this->m_bound_transform = packet.transform;
+            }
+
+            mesh.get_material().bind(shader.uniforms);
+
+            if (object == NO_OBJECT && mesh.get_vertex_format() == VERTEX_FORMAT::COMPACT)
+            {
+                // positions are stored relative to the mesh bounds, the model matrix takes them back to model space
+                shader.uniforms.set(MODEL_UNIFORM, model_matrix * mesh.get_position_transform());
+
+                this->m_bound_transform = NO_TRANSFORM;
+            }
+
+            CoreComponents::geometry_arena->draw(mesh.get_geometry(),
+                                                 mesh.get_index_type(),
+                                                 this->m_range_counts.data() + packet.first_range,
+                                                 this->m_range_offsets.data() + packet.first_range,
+                                                 packet.range_count);
+
+            this->m_stats.draw_count++;
+        }
+
+        this->m_stats.packet_count += this->m_entries.size();
+        this->m_stats.texture_binds += Material::get_bind_count() - first_bind_count;
+
+        this->m_packets.clear();
+        this->m_entries.clear();
+        this->m_transforms.clear();
+        this->m_range_counts.clear();
+        this->m_range_offsets.clear();
+        this->m_shaders.clear();
+
+        // the transform and object indices start over with the next packets
+        this->m_bound_transform = NO_TRANSFORM;
+        this->m_bound_object = NO_OBJECT;
+    }
+
+    void RenderQueue::reset_bindings() noexcept
+    {
+        this->m_bound_shader = nullptr;
+        this->m_bound_transform = NO_TRANSFORM;
+        this->m_bound_object = NO_OBJECT;
+    }
+
+    const render_queue_stats_t& RenderQueue::get_stats() const noexcept
+    {
+        return this->m_stats;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    uint32_t RenderQueue::get_shader_index(Shader& shader)
+    {
+        auto registered = std::find(this->m_shaders.begin(), this->m_shaders.end(), &shader);
+
+        if (registered != this->m_shaders.end())
+        {
+            return static_cast<uint32_t>(registered - this->m_shaders.begin());
+        }
+
+        if (this->m_shaders.size() == MAX_SHADERS)
+        {
+            return MAX_SHADERS - 1;
+        }
+
+        this->m_shaders.push_back(&shader);
+
+        return static_cast<uint32_t>(this->m_shaders.size() - 1);
+    }
+
+    void RenderQueue::write_objects()
+    {
+        this->m_objects.clear();
+        this->m_entry_objects.assign(this->m_entries.size(), NO_OBJECT);
+
+        if (!DrawComponents::uniform_buffers)
+        {
+            return;
+        }
+
+        uint32_t previous_transform = NO_TRANSFORM;
+
+        for (size_t idx = 0; idx < this->m_entries.size(); idx++)
+        {
+            const draw_packet_t& packet = this->m_packets[this->m_entries[idx].packet];
+
+            if (!packet.shader->uses_object_block)
+            {
+                continue;
+            }
+
+            const glm::mat4& model_matrix = this->m_transforms[packet.transform];
+            bool compact = packet.mesh->get_vertex_format() == VERTEX_FORMAT::COMPACT;
+
+            // sorted packets of the same object follow each other and share its block
+            if (!compact && packet.transform == previous_transform)
+            {
+                this->m_entry_objects[idx] = static_cast<uint32_t>(this->m_objects.size() - 1);
+                continue;
+            }
+
+            glm::mat4 normal_matrix = glm::mat4(glm::mat3(glm::inverseTranspose(this->m_view_matrix * model_matrix)));
+
+            // positions of compact meshes are stored relative to the mesh bounds, their block carries the way back
+            this->m_objects.push_back({compact ? model_matrix * packet.mesh->get_position_transform() : model_matrix,
+                                       normal_matrix});
+
+            this->m_entry_objects[idx] = static_cast<uint32_t>(this->m_objects.size() - 1);
+            previous_transform = compact ? NO_TRANSFORM : packet.transform;
+        }
+
+        // a single mapping of the ring for the whole submission
+        DrawComponents::uniform_buffers->write_objects(this->m_objects, this->m_object_offsets);
+
+        if (this->m_object_offsets.size() != this->m_objects.size())
+        {
+            // the ring could not be mapped, the draws fall back to the uniforms
+            this->m_entry_objects.assign(this->m_entries.size(), NO_OBJECT);
+        }
+    }
+
+    void RenderQueue::radix_sort(std::vector<sort_entry_t>& entries, std::vector<sort_entry_t>& scratch)
+    {
+        if (entries.size() < 2)
+        {
+            return;
+        }
+
+        // one histogram per byte, all filled in a single read of the keys
+        size_t histograms[sizeof(uint64_t)][RADIX_BUCKETS] = {};
+
+        for (const auto& entry : entries)
+        {
+            for (size_t byte = 0; byte < sizeof(uint64_t); byte++)
+            {
+                histograms[byte][(entry.key >> (8 * byte)) & 0xFF]++;
+            }
+        }
+
+        for (size_t byte = 0; byte < sizeof(uint64_t); byte++)
+        {
+            size_t* histogram = histograms[byte];
+
+            // every key has the same value in this byte, the pass would not move anything
+            if (histogram[(entries[0].key >> (8 * byte)) & 0xFF] == entries.size())
+            {
+                continue;
+            }
+
+            size_t offset = 0;
+
+            for (size_t bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+            {
+                size_t count = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += count;
+            }
+
+            for (const auto& entry : entries)
+            {
+                scratch[histogram[(entry.key >> (8 * byte)) & 0xFF]++] = entry;
+            }
+
+            entries.swap(scratch);
+        }
+    }
+
+    uint64_t RenderQueue::make_key(RENDER_PASS pass, uint32_t shader, const Mesh& mesh, float depth) noexcept
+    {
+        uint32_t depth_bits = quantize_depth(depth);
+
+        // blended draws cover what is behind them, so they go back to front
+        if (pass == RENDER_PASS::BLENDED)
+        {
+            depth_bits = DEPTH_MASK - depth_bits;
+        }
+
+        return (static_cast<uint64_t>(pass) << PASS_SHIFT)
+               | (static_cast<uint64_t>(shader) << SHADER_SHIFT)
+               | (static_cast<uint64_t>(mesh.get_material().get_sort_key()) << MATERIAL_SHIFT)
+               | (static_cast<uint64_t>(mesh.get_vertex_format()) << VERTEX_ARRAY_SHIFT)
+               | static_cast<uint64_t>(depth_bits & DEPTH_MASK);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
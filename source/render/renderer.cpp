@@ -84,8 +84,10 @@ namespace YB
     {
         this->init_opengl_state();
 
-        DrawComponents::shader = std::make_shared<DirectionalLightShader>();
-        DrawComponents::shader->init_uniforms();
+        DrawComponents::uniform_buffers = std::make_shared<UniformBuffers>();
+
+        DrawComponents::shader_library = std::make_shared<ShaderLibrary>();
+        DrawComponents::shader = DrawComponents::shader_library->get(SHADER_PROGRAM::DIRECTIONAL_LIGHT);
 
         DrawComponents::world = std::make_shared<DefaultWorld>();
 
@@ -160,35 +162,59 @@ namespace YB
 
     void Renderer::init_models()
     {
-        DrawComponents::world->add_model(R"(obj\teapot20segUT.obj)",
-                                         "teapot",
-                                         glm::vec3(0.0f, 0.0f, 0.0f),
-                                         true,
-                                         true);
-
-        DrawComponents::world->add_model(R"(obj\cube.obj)",
-                                         "cube",
-                                         glm::vec3(3.0f, 0.0f, 0.0f),
-                                         false,
-                                         false);
-
-        DrawComponents::world->add_model(R"(obj\sphere.obj)",
-                                         "sphere",
-                                         glm::vec3(-3.0f, 0.0f, 2.0f),
-                                         false,
-                                         false);
-
-        DrawComponents::world->add_model(R"(obj\monkey.obj)",
-                                         "monkey",
-                                         glm::vec3(-3.0f, 0.0f, -2.0f),
-                                         false,
-                                         false);
-
-        DrawComponents::world->add_model(R"(obj\plane3.obj)",
-                                         "plane3",
-                                         glm::vec3(0.0f, -1.0f, 0.0f),
-                                         false,
-                                         false);
+        // the models are loaded on the thread pool, the first frames show their bounding boxes
+        model_load_callbacks_t callbacks{};
+
+        callbacks.on_complete = [](const std::string& model_name, bool success)
+        {
+            if (!success)
+            {
+                std::cerr << "ERROR: could not load model " << model_name << "\n";
+                return;
+            }
+
+            texture_cache_stats_t stats = CoreComponents::texture_cache->get_stats();
+
+            std::cout << "Loaded  : " << model_name
+                      << " (texture cache: " << stats.hits << " hits, "
+                      << stats.misses << " misses, "
+                      << stats.bytes_saved / 1024 << " KB saved)\n";
+        };
+
+        DrawComponents::world->add_model_async(R"(obj\teapot20segUT.obj)",
+                                               "teapot",
+                                               glm::vec3(0.0f, 0.0f, 0.0f),
+                                               true,
+                                               true,
+                                               callbacks);
+
+        DrawComponents::world->add_model_async(R"(obj\cube.obj)",
+                                               "cube",
+                                               glm::vec3(3.0f, 0.0f, 0.0f),
+                                               false,
+                                               false,
+                                               callbacks);
+
+        DrawComponents::world->add_model_async(R"(obj\sphere.obj)",
+                                               "sphere",
+                                               glm::vec3(-3.0f, 0.0f, 2.0f),
+                                               false,
+                                               false,
+                                               callbacks);
+
+        DrawComponents::world->add_model_async(R"(obj\monkey.obj)",
+                                               "monkey",
+                                               glm::vec3(-3.0f, 0.0f, -2.0f),
+                                               false,
+                                               false,
+                                               callbacks);
+
+        DrawComponents::world->add_model_async(R"(obj\plane3.obj)",
+                                               "plane3",
+                                               glm::vec3(0.0f, -1.0f, 0.0f),
+                                               false,
+                                               false,
+                                               callbacks);
     }
 
 ////////////////////////////////////////////////////////////////////////////////
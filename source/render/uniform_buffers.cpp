@@ -0,0 +1,237 @@
+///
+/// @file uniform_buffers.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the UniformBuffers class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "uniform_buffers.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ///
+    /// @struct block_member_s
+    /// @brief A member of a uniform block, by its GLSL name, and its offset in the C++ struct.
+    ///
+    typedef struct block_member_s
+    {
+        const char* name; ///< Name reported by OpenGL, the block name and the member name.
+        size_t offset; ///< Offset in the C++ struct.
+    } block_member_t;
+
+    constexpr block_member_t FRAME_BLOCK_MEMBERS[] = {
+        {"FrameBlock.view", offsetof(frame_block_t, view)},
+        {"FrameBlock.projection", offsetof(frame_block_t, projection)},
+        {"FrameBlock.viewProjection", offsetof(frame_block_t, view_projection)},
+        {"FrameBlock.cameraPosition", offsetof(frame_block_t, camera_position)},
+        {"FrameBlock.lightDir", offsetof(frame_block_t, light_direction)},
+        {"FrameBlock.lightColor", offsetof(frame_block_t, light_color)},
+        {"FrameBlock.lightPosition", offsetof(frame_block_t, light_position)},
+        {"FrameBlock.lightAttenuation", offsetof(frame_block_t, light_attenuation)},
+    }; ///< Members of FrameBlock.
+
+    constexpr block_member_t OBJECT_BLOCK_MEMBERS[] = {
+        {"ObjectBlock.model", offsetof(object_block_t, model)},
+        {"ObjectBlock.normal", offsetof(object_block_t, normal)},
+    }; ///< Members of ObjectBlock.
+
+    ///
+    /// @brief Checks the offsets OpenGL gives the members of a block against the C++ struct.
+    /// @return True if every member the program knows is where the struct has it.
+    ///
+    template <size_t N>
+    static bool check_members(GLuint program, const block_member_t (&members)[N])
+    {
+        for (const auto& member : members)
+        {
+            GLuint index = GL_INVALID_INDEX;
+            glGetUniformIndices(program, 1, &member.name, &index);
+
+            if (index == GL_INVALID_INDEX)
+            {
+                continue;
+            }
+
+            GLint offset = -1;
+            glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &offset);
+
+            if (offset != static_cast<GLint>(member.offset))
+            {
+                std::cerr << "WARNING: " << member.name << " is at offset " << offset
+                          << " in program " << program << ", expected " << member.offset << "\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    UniformBuffers::UniformBuffers()
+        : m_frame_buffer{0},
+          m_object_buffer{0},
+          m_object_ring_size{OBJECT_RING_SIZE},
+          m_object_head{0},
+          m_object_stride{0}
+    {
+        GLint alignment = 1;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+
+        alignment = std::max(alignment, 1);
+
+        this->m_object_stride
+            = (static_cast<GLintptr>(sizeof(object_block_t)) + alignment - 1) / alignment * alignment;
+
+        glGenBuffers(1, &this->m_frame_buffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, this->m_frame_buffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(frame_block_t), nullptr, GL_DYNAMIC_DRAW);
+
+        glGenBuffers(1, &this->m_object_buffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, this->m_object_buffer);
+        glBufferData(GL_UNIFORM_BUFFER, this->m_object_ring_size, nullptr, GL_STREAM_DRAW);
+
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        glBindBufferBase(GL_UNIFORM_BUFFER, FRAME_BLOCK_BINDING, this->m_frame_buffer);
+    }
+
+    UniformBuffers::~UniformBuffers()
+    {
+        glDeleteBuffers(1, &this->m_frame_buffer);
+        glDeleteBuffers(1, &this->m_object_buffer);
+    }
+
+    void UniformBuffers::update_frame(const frame_block_t& block)
+    {
+        glBindBuffer(GL_UNIFORM_BUFFER, this->m_frame_buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(frame_block_t), &block);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+    void UniformBuffers::write_objects(const std::vector<object_block_t>& objects, std::vector<GLintptr>& offsets)
+    {
+        offsets.clear();
+
+        if (objects.empty())
+        {
+            return;
+        }
+
+        GLsizeiptr size = static_cast<GLsizeiptr>(objects.size()) * this->m_object_stride;
+
+        glBindBuffer(GL_UNIFORM_BUFFER, this->m_object_buffer);
+
+        if (size > this->m_object_ring_size || this->m_object_head + size > this->m_object_ring_size)
+        {
+            while (size > this->m_object_ring_size)
+            {
+                this->m_object_ring_size *= 2;
+            }
+
+            // orphaning: the draws still in flight keep reading the old storage
+            glBufferData(GL_UNIFORM_BUFFER, this->m_object_ring_size, nullptr, GL_STREAM_DRAW);
+            this->m_object_head = 0;
+        }
+
+        // nothing was written to this range since the last orphaning, so the GPU cannot be reading it
+        auto* data = static_cast<unsigned char*>(
+            glMapBufferRange(GL_UNIFORM_BUFFER,
+                             this->m_object_head,
+                             size,
+                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+
+        if (data == nullptr)
+        {
+            std::cerr << "ERROR: could not map the object uniform buffer\n";
+
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+            return;
+        }
+
+        for (size_t idx = 0; idx < objects.size(); idx++)
+        {
+            GLintptr offset = static_cast<GLintptr>(idx) * this->m_object_stride;
+
+            std::memcpy(data + offset, &objects[idx], sizeof(object_block_t));
+
+            offsets.push_back(this->m_object_head + offset);
+        }
+
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        this->m_object_head += size;
+    }
+
+    void UniformBuffers::bind_object(GLintptr offset) const
+    {
+        glBindBufferRange(GL_UNIFORM_BUFFER, OBJECT_BLOCK_BINDING, this->m_object_buffer, offset, sizeof(object_block_t));
+    }
+
+    bool UniformBuffers::bind_block(GLuint program, const char* block_name)
+    {
+        GLuint block_index = glGetUniformBlockIndex(program, block_name);
+
+        if (block_index == GL_INVALID_INDEX)
+        {
+            return false;
+        }
+
+        bool frame_block = std::strcmp(block_name, FRAME_BLOCK_NAME) == 0;
+        GLint expected_size = static_cast<GLint>(frame_block ? sizeof(frame_block_t) : sizeof(object_block_t));
+
+        GLint block_size = 0;
+        glGetActiveUniformBlockiv(program, block_index, GL_UNIFORM_BLOCK_DATA_SIZE, &block_size);
+
+        if (block_size != expected_size)
+        {
+            std::cerr << "WARNING: " << block_name << " is " << block_size << " bytes in program " << program
+                      << ", expected " << expected_size << "\n";
+            return false;
+        }
+
+        bool members_match = frame_block ? check_members(program, FRAME_BLOCK_MEMBERS)
+                                         : check_members(program, OBJECT_BLOCK_MEMBERS);
+
+        if (!members_match)
+        {
+            return false;
+        }
+
+        glUniformBlockBinding(program, block_index, frame_block ? FRAME_BLOCK_BINDING : OBJECT_BLOCK_BINDING);
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,136 @@
+///
+/// @file instanced_shader.cpp
+/// @author Yasin BASAR
+/// @brief Implements the InstancedShader class.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include "instanced_shader.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr const char* VERSION_SOURCE = "#version 330 core\n"; ///< Prepended to both stages, before the per-frame block.
+
+    ///
+    /// @brief Places every vertex with the matrices of its instance, read from the texture buffer.
+    ///
+    constexpr const char* VERTEX_SOURCE = R"(
+layout(location = 0) in vec3 vPosition;
+layout(location = 1) in vec3 vNormal;
+layout(location = 2) in vec2 vTexCoords;
+
+uniform samplerBuffer instanceTransforms;
+uniform mat4 positionTransform;
+
+out vec3 fPosition;
+out vec3 fNormal;
+out vec2 fTexCoords;
+
+mat4 fetchMatrix(int first)
+{
+    return mat4(texelFetch(instanceTransforms, first),
+                texelFetch(instanceTransforms, first + 1),
+                texelFetch(instanceTransforms, first + 2),
+                texelFetch(instanceTransforms, first + 3));
+}
+
+void main()
+{
+    mat4 model = fetchMatrix(gl_InstanceID * 8);
+    mat4 normal = fetchMatrix(gl_InstanceID * 8 + 4);
+
+    vec4 position = model * positionTransform * vec4(vPosition, 1.0);
+
+    fPosition = position.xyz;
+    fNormal = mat3(normal) * vNormal;
+    fTexCoords = vTexCoords;
+
+    gl_Position = frame.viewProjection * position;
+}
+)";
+
+    ///
+    /// @brief Shades with the directional light of FrameBlock, in world space.
+    ///
+    constexpr const char* FRAGMENT_SOURCE = R"(
+in vec3 fPosition;
+in vec3 fNormal;
+in vec2 fTexCoords;
+
+uniform sampler2D diffuseTexture;
+uniform sampler2D specularTexture;
+
+out vec4 fColor;
+
+void main()
+{
+    vec3 diffuse = texture(diffuseTexture, fTexCoords).rgb;
+
+    // shaders without a light leave it black in the block, the textures are then drawn unlit
+    if (frame.lightColor.rgb == vec3(0.0))
+    {
+        fColor = vec4(diffuse, 1.0);
+        return;
+    }
+
+    vec3 normal = normalize(fNormal);
+    vec3 light = normalize(frame.lightDir.xyz);
+    vec3 halfway = normalize(light + normalize(frame.cameraPosition.xyz - fPosition));
+
+    float specular = pow(max(dot(normal, halfway), 0.0), 32.0) * texture(specularTexture, fTexCoords).r;
+
+    fColor = vec4((0.2 + max(dot(normal, light), 0.0)) * frame.lightColor.rgb * diffuse + specular * frame.lightColor.rgb, 1.0);
+}
+)";
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    InstancedShader::InstancedShader()
+    {
+        this->load_shader_sources(std::string(VERSION_SOURCE) + FRAME_BLOCK_SOURCE + VERTEX_SOURCE,
+                                  std::string(VERSION_SOURCE) + FRAME_BLOCK_SOURCE + FRAGMENT_SOURCE);
+    }
+
+    void InstancedShader::use_shader_program()
+    {
+        Shader::use_shader_program();
+    }
+
+    void InstancedShader::init_uniforms()
+    {
+        Shader::init_uniforms();
+
+        // the transforms are read from a unit Material never hands out
+        this->uniforms.set(INSTANCE_TRANSFORMS_UNIFORM, INSTANCE_TEXTURE_UNIT);
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
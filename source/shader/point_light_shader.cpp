@@ -19,6 +19,14 @@
 
 namespace YB
 {
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr float CONSTANT_ATTENUATION = 1.0f; ///< Constant term of the light attenuation.
+    constexpr float LINEAR_ATTENUATION = 0.22f; ///< Linear term of the light attenuation.
+    constexpr float QUADRATIC_ATTENUATION = 0.20f; ///< Quadratic term of the light attenuation.
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -27,12 +35,6 @@ namespace YB
         : m_light_dir{0}, /* Initializes light direction to zero vector. */
           m_light_color{0}, /* Initializes light color to zero vector. */
           m_light_position{0}, /* Initializes light position to zero vector. */
-          m_light_dir_location{-1}, /* Initializes the location of light direction uniform to -1. */
-          m_light_color_location{-1}, /* Initializes the location of light color uniform to -1. */
-          m_light_position_location{-1}, /* Initializes the location of light position uniform to -1. */
-          m_constant{-1}, /* Initializes the location of constant attenuation uniform to -1. */
-          m_linear{-1}, /* Initializes the location of linear attenuation uniform to -1. */
-          m_quadratic{-1}, /* Initializes the location of quadratic attenuation uniform to -1. */
           m_shadow_map{0} /* Initializes the shadow map ID to 0. */
     {
         this->load_shader(R"(shader/point_light_vert.glsl)",
@@ -50,29 +52,26 @@ namespace YB
 
         // set the light direction (direction towards the light)
         this->m_light_dir = glm::vec3(2.0f, 2.0f, 2.0f);
-        this->m_light_dir_location = glGetUniformLocation(this->shader_program, "lightDir");
-        // send light dir to shader
-        glUniform3fv(this->m_light_dir_location, 1, glm::value_ptr(this->m_light_dir));
+        this->uniforms.set(LIGHT_DIR_UNIFORM, this->m_light_dir);
 
         // set light color
         this->m_light_color = glm::vec3(1.0f, 1.0f, 1.0f); //white light
-        this->m_light_dir_location = glGetUniformLocation(this->shader_program, "lightColor");
-        // send light color to shader
-        glUniform3fv(this->m_light_dir_location, 1, glm::value_ptr(this->m_light_color));
+        this->uniforms.set(LIGHT_COLOR_UNIFORM, this->m_light_color);
 
         this->m_light_position = glm::vec3(-2.0f, 10.0f, -1.0f);
-        this->m_light_position_location = glGetUniformLocation(this->shader_program, "lightPosition");
-        /*send light position to shader*/
-        glUniform3fv(this->m_light_position_location, 1, glm::value_ptr(this->m_light_position));
+        this->uniforms.set(LIGHT_POSITION_UNIFORM, this->m_light_position);
 
-        this->m_constant = glGetUniformLocation(this->shader_program, "constant");
-        glUniform1f(this->m_constant, 1.0f);
-
-        this->m_linear = glGetUniformLocation(this->shader_program, "linear_");
-        glUniform1f(this->m_linear, 0.22f);
+        this->uniforms.set(CONSTANT_UNIFORM, CONSTANT_ATTENUATION);
+        this->uniforms.set(LINEAR_UNIFORM, LINEAR_ATTENUATION);
+        this->uniforms.set(QUADRATIC_UNIFORM, QUADRATIC_ATTENUATION);
+    }
 
-        this->m_quadratic = glGetUniformLocation(this->shader_program, "quadratic");
-        glUniform1f(this->m_quadratic, 0.20f);
+    void PointLightShader::write_lights(frame_block_t& block) const
+    {
+        block.light_direction = glm::vec4(this->m_light_dir, 0.0f);
+        block.light_color = glm::vec4(this->m_light_color, 0.0f);
+        block.light_position = glm::vec4(this->m_light_position, 1.0f);
+        block.light_attenuation = glm::vec4(CONSTANT_ATTENUATION, LINEAR_ATTENUATION, QUADRATIC_ATTENUATION, 0.0f);
     }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,234 @@
+///
+/// @file program_cache.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the ProgramCache class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include "hash_utils.hpp"
+#include "program_cache.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr char PROGRAM_CACHE_MAGIC[8] = {'Y', 'B', 'P', 'R', 'O', 'G', '\0', '\0'}; ///< File signature.
+    constexpr uint32_t PROGRAM_CACHE_VERSION = 1; ///< Bumped whenever the layout of the file changes.
+    constexpr const char* PROGRAM_CACHE_DIRECTORY = "shader_cache"; ///< Directory of the cache files.
+
+    ///
+    /// @struct program_cache_header_s
+    /// @brief Fixed size header at the start of a cache file, followed by the driver string and the binary.
+    ///
+    typedef struct program_cache_header_s
+    {
+        char magic[8]; ///< Always PROGRAM_CACHE_MAGIC.
+        uint32_t version; ///< Always PROGRAM_CACHE_VERSION.
+        uint32_t binary_format; ///< Format returned by glGetProgramBinary.
+        uint64_t source_hash; ///< Hash of the vertex and fragment sources.
+        uint32_t driver_length; ///< Length of the driver string.
+        uint32_t binary_size; ///< Size of the binary in bytes.
+    } program_cache_header_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ProgramCache::ProgramCache(const std::string& vertex_shader_source, const std::string& fragment_shader_source)
+        : m_source_hash{fnv1a_hash(fragment_shader_source, fnv1a_hash(vertex_shader_source))}
+    {
+        // the driver is part of the name, so switching between GPUs keeps one binary for each
+        uint64_t file_hash = fnv1a_hash(get_driver_string(), this->m_source_hash);
+
+        char file_name[32] = {};
+        std::snprintf(file_name, sizeof(file_name), "%016llx.ybprog", static_cast<unsigned long long>(file_hash));
+
+        this->m_cache_path = (std::filesystem::path(PROGRAM_CACHE_DIRECTORY) / file_name).string();
+    }
+
+    bool ProgramCache::load(GLuint program) const
+    {
+        if (this->m_cache_path.empty() || !is_supported())
+        {
+            return false;
+        }
+
+        std::ifstream cache_file(this->m_cache_path, std::ios::binary);
+
+        if (!cache_file)
+        {
+            return false;
+        }
+
+        std::vector<char> buffer{std::istreambuf_iterator<char>(cache_file), std::istreambuf_iterator<char>()};
+
+        program_cache_header_t header{};
+
+        if (buffer.size() < sizeof(header))
+        {
+            return false;
+        }
+
+        std::memcpy(&header, buffer.data(), sizeof(header));
+
+        std::string driver_string = get_driver_string();
+
+        bool valid = std::memcmp(header.magic, PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC)) == 0 &&
+                     header.version == PROGRAM_CACHE_VERSION &&
+                     header.source_hash == this->m_source_hash &&
+                     header.driver_length == driver_string.size() &&
+                     buffer.size() - sizeof(header) >= static_cast<size_t>(header.driver_length) + header.binary_size &&
+                     driver_string.compare(0, driver_string.size(), buffer.data() + sizeof(header), header.driver_length) == 0;
+
+        if (!valid)
+        {
+            return false;
+        }
+
+        glProgramBinary(program,
+                        static_cast<GLenum>(header.binary_format),
+                        buffer.data() + sizeof(header) + header.driver_length,
+                        static_cast<GLsizei>(header.binary_size));
+
+        // a driver update with the same strings may still reject the binary, the caller then compiles the sources
+        GLint success = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+        return success == GL_TRUE;
+    }
+
+    bool ProgramCache::save(GLuint program) const
+    {
+        if (this->m_cache_path.empty() || !is_supported())
+        {
+            return false;
+        }
+
+        GLint binary_length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+
+        if (binary_length <= 0)
+        {
+            return false;
+        }
+
+        std::string driver_string = get_driver_string();
+
+        program_cache_header_t header{};
+        std::memcpy(header.magic, PROGRAM_CACHE_MAGIC, sizeof(PROGRAM_CACHE_MAGIC));
+        header.version = PROGRAM_CACHE_VERSION;
+        header.source_hash = this->m_source_hash;
+        header.driver_length = static_cast<uint32_t>(driver_string.size());
+
+        std::vector<char> binary(static_cast<size_t>(binary_length));
+        GLsizei written = 0;
+        GLenum binary_format = 0;
+
+        glGetProgramBinary(program, binary_length, &written, &binary_format, binary.data());
+
+        if (written <= 0)
+        {
+            return false;
+        }
+
+        header.binary_format = static_cast<uint32_t>(binary_format);
+        header.binary_size = static_cast<uint32_t>(written);
+
+        std::error_code error{};
+        std::filesystem::create_directories(PROGRAM_CACHE_DIRECTORY, error);
+
+        // write next to the cache and rename, so a reader never sees half a file
+        std::string temporary_path = this->m_cache_path + ".tmp";
+
+        {
+            std::ofstream cache_file(temporary_path, std::ios::binary | std::ios::trunc);
+
+            cache_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            cache_file.write(driver_string.data(), static_cast<std::streamsize>(driver_string.size()));
+            cache_file.write(binary.data(), written);
+
+            if (!cache_file)
+            {
+                std::cerr << "WARNING: could not write program cache " << this->m_cache_path << "\n";
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporary_path, this->m_cache_path, error);
+
+        if (error)
+        {
+            std::filesystem::remove(temporary_path, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    const std::string& ProgramCache::get_cache_path() const noexcept
+    {
+        return this->m_cache_path;
+    }
+
+    bool ProgramCache::is_supported()
+    {
+        if (!GLAD_GL_VERSION_4_1)
+        {
+            return false;
+        }
+
+        GLint format_count = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+
+        return format_count > 0;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    std::string ProgramCache::get_driver_string()
+    {
+        std::string driver_string{};
+
+        for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+        {
+            const GLubyte* value = glGetString(name);
+
+            if (value != nullptr)
+            {
+                driver_string += reinterpret_cast<const char*>(value);
+            }
+
+            driver_string += '\n';
+        }
+
+        return driver_string;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -15,6 +15,7 @@
 #include <fstream>
 #include <sstream>
 #include "shader.hpp"
+#include "uniform_buffers.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -34,19 +35,31 @@ namespace YB
           view_matrix{1.0f},
           projection_matrix{1.0f},
           normal_matrix{1.0f},
-          model_matrix_location{-1},
-          view_matrix_location{-1},
-          projection_matrix_location{-1},
-          normal_matrix_location{-1},
+          uniforms{},
+          uses_frame_block{false},
+          uses_object_block{false},
           m_vertex_shader{0},
-          m_fragment_shader{0}
+          m_fragment_shader{0},
+          m_program_cache{},
+          m_link_pending{false},
+          m_from_program_cache{false}
     {
     }
 
     Shader::~Shader()
     {
-        glDetachShader(this->shader_program, this->m_vertex_shader);
-        glDetachShader(this->shader_program, this->m_fragment_shader);
+        // the shaders are already gone once the link was checked, or when the program came from the cache
+        if (this->m_vertex_shader != 0)
+        {
+            glDetachShader(this->shader_program, this->m_vertex_shader);
+            glDeleteShader(this->m_vertex_shader);
+        }
+
+        if (this->m_fragment_shader != 0)
+        {
+            glDetachShader(this->shader_program, this->m_fragment_shader);
+            glDeleteShader(this->m_fragment_shader);
+        }
 
         if (this->shader_program != 0)
         {
@@ -59,6 +72,16 @@ namespace YB
         glUseProgram(this->shader_program);
     }
 
+    void Shader::write_lights(frame_block_t& block) const
+    {
+
+    }
+
+    bool Shader::is_from_program_cache() const noexcept
+    {
+        return this->m_from_program_cache;
+    }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Private Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -91,7 +114,7 @@ namespace YB
         delete[] info_log;
     }
 
-    void Shader::shader_link_log(GLuint shader_program_id)
+    bool Shader::shader_link_log(GLuint shader_program_id)
     {
         GLint success;
         GLchar* info_log = new GLchar[1024];
@@ -105,6 +128,34 @@ namespace YB
         }
 
         delete[] info_log;
+
+        return success == GL_TRUE;
+    }
+
+    void Shader::finish_link()
+    {
+        if (!this->m_link_pending)
+        {
+            return;
+        }
+
+        // these queries are the first to wait for the compiler threads
+        this->shader_compile_log(this->m_vertex_shader);
+        this->shader_compile_log(this->m_fragment_shader);
+
+        if (this->shader_link_log(this->shader_program))
+        {
+            this->m_program_cache.save(this->shader_program);
+        }
+
+        glDetachShader(this->shader_program, this->m_vertex_shader);
+        glDetachShader(this->shader_program, this->m_fragment_shader);
+        glDeleteShader(this->m_vertex_shader);
+        glDeleteShader(this->m_fragment_shader);
+
+        this->m_vertex_shader = 0;
+        this->m_fragment_shader = 0;
+        this->m_link_pending = false;
     }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -114,54 +165,72 @@ namespace YB
     void Shader::load_shader(const std::string &vertex_shader_file_name,
                              const std::string &fragment_shader_file_name)
     {
-        //read, parse and compile the vertex shader
-        std::string v = this->read_shader_file(vertex_shader_file_name);
-        const GLchar* vertex_shader_string = v.c_str();
+        this->load_shader_sources(this->read_shader_file(vertex_shader_file_name),
+                                  this->read_shader_file(fragment_shader_file_name));
+    }
+
+    void Shader::load_shader_sources(const std::string& vertex_shader_source,
+                                     const std::string& fragment_shader_source)
+    {
+        this->shader_program = glCreateProgram();
+        this->m_program_cache = ProgramCache(vertex_shader_source, fragment_shader_source);
+
+        if (this->m_program_cache.load(this->shader_program))
+        {
+            this->m_from_program_cache = true;
+            return;
+        }
+
+        //parse and compile the vertex shader
+        const GLchar* vertex_shader_string = vertex_shader_source.c_str();
         this->m_vertex_shader = glCreateShader(GL_VERTEX_SHADER);
         glShaderSource(this->m_vertex_shader, 1, &vertex_shader_string, nullptr);
         glCompileShader(this->m_vertex_shader);
-        //check compilation status
-        this->shader_compile_log(this->m_vertex_shader);
 
-        //read, parse and compile the fragment shader
-        std::string f = this->read_shader_file(fragment_shader_file_name);
-        const GLchar* fragment_shader_string = f.c_str();
+        //parse and compile the fragment shader
+        const GLchar* fragment_shader_string = fragment_shader_source.c_str();
         this->m_fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
         glShaderSource(this->m_fragment_shader, 1, &fragment_shader_string, nullptr);
         glCompileShader(this->m_fragment_shader);
-        //check compilation status
-        this->shader_compile_log(this->m_fragment_shader);
 
         //attach and link the shader programs
-        this->shader_program = glCreateProgram();
         glAttachShader(this->shader_program, this->m_vertex_shader);
         glAttachShader(this->shader_program, this->m_fragment_shader);
-        glLinkProgram(this->shader_program);
-        glDeleteShader(this->m_vertex_shader);
-        glDeleteShader(this->m_fragment_shader);
 
-        //check linking info
-        this->shader_link_log(this->shader_program);
+        if (ProgramCache::is_supported())
+        {
+            glProgramParameteri(this->shader_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
 
-        glUseProgram(this->shader_program);
+        glLinkProgram(this->shader_program);
+
+        // the compilation and link logs are read by finish_link(), reading them here would wait for the driver
+        this->m_link_pending = true;
     }
 
     void Shader::init_uniforms()
     {
+        this->finish_link();
+
+        glUseProgram(this->shader_program);
+
+        // the locations are read once from the linked program, the setters below look them up by hash
+        this->uniforms.reflect(this->shader_program);
+
         this->model_matrix = glm::mat4(1.0f);
-        this->model_matrix_location = glGetUniformLocation(this->shader_program, "model");
         this->view_matrix = CoreComponents::camera->get_view_matrix();
-        this->view_matrix_location = glGetUniformLocation(this->shader_program, "view");
-        glUniformMatrix4fv(this->view_matrix_location, 1, GL_FALSE, glm::value_ptr(this->view_matrix));
+        this->uniforms.set(VIEW_UNIFORM, this->view_matrix);
         this->normal_matrix = glm::mat3(glm::inverseTranspose(this->view_matrix * this->model_matrix));
-        this->normal_matrix_location = glGetUniformLocation(this->shader_program, "normalMatrix");
         this->projection_matrix
             = glm::perspective(glm::radians(45.0f),
                                static_cast<float>(CoreComponents::window->width) / static_cast<float>(CoreComponents::window->height),
                                0.1f,
                                40.0f);
-        this->projection_matrix_location = glGetUniformLocation(this->shader_program, "projection");
-        glUniformMatrix4fv(this->projection_matrix_location, 1, GL_FALSE, glm::value_ptr(this->projection_matrix));
+        this->uniforms.set(PROJECTION_UNIFORM, this->projection_matrix);
+
+        // programs declaring the shared blocks read them from the fixed binding points, the uniforms above stay for the others
+        this->uses_frame_block = UniformBuffers::bind_block(this->shader_program, FRAME_BLOCK_NAME);
+        this->uses_object_block = UniformBuffers::bind_block(this->shader_program, OBJECT_BLOCK_NAME);
     }
 
 } // namespace YB
@@ -0,0 +1,137 @@
+///
+/// @file shader_library.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the ShaderLibrary class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include "directional_light_shader.hpp"
+#include "point_light_shader.hpp"
+#include "shader_library.hpp"
+#include "solid_shader.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr GLuint ANY_COMPILER_THREADS = 0xFFFFFFFF; ///< Lets the driver pick the number of compiler threads.
+
+    typedef void (APIENTRY* max_shader_compiler_threads_t)(GLuint count); ///< glMaxShaderCompilerThreadsKHR.
+
+    ///
+    /// @brief Checks whether the context exposes an extension.
+    ///
+    static bool has_extension(const char* name)
+    {
+        GLint extension_count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extension_count);
+
+        for (GLint idx = 0; idx < extension_count; idx++)
+        {
+            const GLubyte* extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(idx));
+
+            if (extension != nullptr && std::strcmp(reinterpret_cast<const char*>(extension), name) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ShaderLibrary::ShaderLibrary()
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        bool parallel = enable_parallel_compile();
+
+        // the constructors only issue the compilations and links
+        this->m_shaders[static_cast<size_t>(SHADER_PROGRAM::DIRECTIONAL_LIGHT)] = std::make_shared<DirectionalLightShader>();
+        this->m_shaders[static_cast<size_t>(SHADER_PROGRAM::POINT_LIGHT)] = std::make_shared<PointLightShader>();
+        this->m_shaders[static_cast<size_t>(SHADER_PROGRAM::SOLID)] = std::make_shared<SolidShader>();
+
+        size_t cached_count = 0;
+
+        // the first init_uniforms() waits for its program, the others have been building meanwhile
+        for (const auto& shader : this->m_shaders)
+        {
+            shader->init_uniforms();
+
+            cached_count += shader->is_from_program_cache() ? 1 : 0;
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << "Shaders : " << PROGRAM_COUNT << " programs in " << elapsed.count() << " ms, "
+                  << cached_count << " from the program cache"
+                  << (parallel ? ", parallel compile" : "") << "\n";
+    }
+
+    std::shared_ptr<Shader> ShaderLibrary::get(SHADER_PROGRAM program) const
+    {
+        return this->m_shaders[static_cast<size_t>(program)];
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    bool ShaderLibrary::enable_parallel_compile()
+    {
+        const char* function_name = nullptr;
+
+        if (has_extension("GL_KHR_parallel_shader_compile"))
+        {
+            function_name = "glMaxShaderCompilerThreadsKHR";
+        }
+        else if (has_extension("GL_ARB_parallel_shader_compile"))
+        {
+            function_name = "glMaxShaderCompilerThreadsARB";
+        }
+        else
+        {
+            return false;
+        }
+
+        auto max_shader_compiler_threads
+            = reinterpret_cast<max_shader_compiler_threads_t>(glfwGetProcAddress(function_name));
+
+        if (max_shader_compiler_threads == nullptr)
+        {
+            return false;
+        }
+
+        max_shader_compiler_threads(ANY_COMPILER_THREADS);
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
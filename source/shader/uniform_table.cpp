@@ -0,0 +1,266 @@
+///
+/// @file uniform_table.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the UniformTable class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "uniform_table.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/gtc/type_ptr.hpp>
+
+namespace YB
+{
+    ///
+    /// @brief Static member initialization for the update counters.
+    ///
+    uniform_stats_t UniformTable::stats{0, 0};
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr const char* ARRAY_SUFFIX = "[0]"; ///< Suffix glGetActiveUniform adds to the names of arrays.
+    constexpr size_t ARRAY_SUFFIX_LENGTH = 3; ///< Length of ARRAY_SUFFIX.
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void UniformTable::reflect(GLuint program)
+    {
+        this->m_entries.clear();
+        this->m_shadow.clear();
+
+        GLint uniform_count = 0;
+        GLint max_name_length = 0;
+
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+
+        std::vector<GLchar> name_buffer(static_cast<size_t>(std::max(max_name_length, 1)));
+
+        for (GLint idx = 0; idx < uniform_count; idx++)
+        {
+            GLsizei name_length = 0;
+            GLint array_size = 0;
+            GLenum type = 0;
+
+            glGetActiveUniform(program,
+                               static_cast<GLuint>(idx),
+                               static_cast<GLsizei>(name_buffer.size()),
+                               &name_length,
+                               &array_size,
+                               &type,
+                               name_buffer.data());
+
+            std::string name(name_buffer.data(), static_cast<size_t>(name_length));
+
+            // members of uniform blocks are active too, but they have no location
+            GLint location = glGetUniformLocation(program, name.c_str());
+
+            if (location < 0)
+            {
+                continue;
+            }
+
+            if (name.size() > ARRAY_SUFFIX_LENGTH
+                && name.compare(name.size() - ARRAY_SUFFIX_LENGTH, ARRAY_SUFFIX_LENGTH, ARRAY_SUFFIX) == 0)
+            {
+                name.resize(name.size() - ARRAY_SUFFIX_LENGTH);
+            }
+
+            uint32_t shadow_size = get_shadow_size(type);
+
+            this->m_entries.push_back({fnv1a_hash(name),
+                                       location,
+                                       type,
+                                       static_cast<uint32_t>(this->m_shadow.size()),
+                                       shadow_size,
+                                       false});
+
+            this->m_shadow.resize(this->m_shadow.size() + shadow_size);
+        }
+
+        std::sort(this->m_entries.begin(),
+                  this->m_entries.end(),
+                  [](const uniform_entry_t& lhs, const uniform_entry_t& rhs)
+                  {
+                      return lhs.name < rhs.name;
+                  });
+
+        for (size_t idx = 1; idx < this->m_entries.size(); idx++)
+        {
+            if (this->m_entries[idx].name == this->m_entries[idx - 1].name)
+            {
+                std::cerr << "WARNING: two uniforms of program " << program << " have the same name hash\n";
+            }
+        }
+    }
+
+    GLint UniformTable::get_location(uint64_t name) const
+    {
+        size_t entry = this->find(name);
+
+        return entry != NO_ENTRY ? this->m_entries[entry].location : -1;
+    }
+
+    void UniformTable::set(uint64_t name, GLint value)
+    {
+        GLint location = this->update_shadow(name, &value, sizeof(value));
+
+        if (location >= 0)
+        {
+            glUniform1i(location, value);
+        }
+    }
+
+    void UniformTable::set(uint64_t name, float value)
+    {
+        GLint location = this->update_shadow(name, &value, sizeof(value));
+
+        if (location >= 0)
+        {
+            glUniform1f(location, value);
+        }
+    }
+
+    void UniformTable::set(uint64_t name, const glm::vec3& value)
+    {
+        GLint location = this->update_shadow(name, glm::value_ptr(value), sizeof(value));
+
+        if (location >= 0)
+        {
+            glUniform3fv(location, 1, glm::value_ptr(value));
+        }
+    }
+
+    void UniformTable::set(uint64_t name, const glm::mat3& value)
+    {
+        GLint location = this->update_shadow(name, glm::value_ptr(value), sizeof(value));
+
+        if (location >= 0)
+        {
+            glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        }
+    }
+
+    void UniformTable::set(uint64_t name, const glm::mat4& value)
+    {
+        GLint location = this->update_shadow(name, glm::value_ptr(value), sizeof(value));
+
+        if (location >= 0)
+        {
+            glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+        }
+    }
+
+    const uniform_stats_t& UniformTable::get_stats() noexcept
+    {
+        return stats;
+    }
+
+    void UniformTable::reset_stats() noexcept
+    {
+        stats = {0, 0};
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    size_t UniformTable::find(uint64_t name) const
+    {
+        auto entry = std::lower_bound(this->m_entries.begin(),
+                                      this->m_entries.end(),
+                                      name,
+                                      [](const uniform_entry_t& lhs, uint64_t rhs)
+                                      {
+                                          return lhs.name < rhs;
+                                      });
+
+        if (entry == this->m_entries.end() || entry->name != name)
+        {
+            return NO_ENTRY;
+        }
+
+        return static_cast<size_t>(entry - this->m_entries.begin());
+    }
+
+    GLint UniformTable::update_shadow(uint64_t name, const void* value, size_t size)
+    {
+        size_t index = this->find(name);
+
+        if (index == NO_ENTRY)
+        {
+            return -1;
+        }
+
+        uniform_entry_t* entry = &this->m_entries[index];
+
+        // a value of another size than the reflected type is sent as it is, without a shadow to compare with
+        if (entry->shadow_size == size)
+        {
+            unsigned char* shadow = this->m_shadow.data() + entry->shadow_offset;
+
+            if (entry->has_value && std::memcmp(shadow, value, size) == 0)
+            {
+                stats.elided_count++;
+                return -1;
+            }
+
+            std::memcpy(shadow, value, size);
+            entry->has_value = true;
+        }
+
+        stats.update_count++;
+
+        return entry->location;
+    }
+
+    uint32_t UniformTable::get_shadow_size(GLenum type) noexcept
+    {
+        switch (type)
+        {
+            case GL_FLOAT:
+            case GL_INT:
+            case GL_UNSIGNED_INT:
+            case GL_BOOL:
+            case GL_SAMPLER_2D:
+            case GL_SAMPLER_3D:
+            case GL_SAMPLER_CUBE:
+            case GL_SAMPLER_2D_SHADOW:
+            case GL_SAMPLER_BUFFER:
+                return sizeof(GLint);
+            case GL_FLOAT_VEC3:
+                return sizeof(glm::vec3);
+            case GL_FLOAT_MAT3:
+                return sizeof(glm::mat3);
+            case GL_FLOAT_MAT4:
+                return sizeof(glm::mat4);
+            default:
+                return 0;
+        }
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
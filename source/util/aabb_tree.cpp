@@ -0,0 +1,425 @@
+///
+/// @file aabb_tree.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the AabbTree class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "aabb_tree.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr float SHRINK_FACTOR = 4.0f; ///< A fat box larger than this many margins around its box is rebuilt.
+
+    ///
+    /// @brief Merges two boxes.
+    ///
+    static aabb_t merge(const aabb_t& lhs, const aabb_t& rhs) noexcept
+    {
+        return {glm::min(lhs.min, rhs.min), glm::max(lhs.max, rhs.max)};
+    }
+
+    ///
+    /// @brief Computes the surface area of a box, the cost of the insertion heuristic.
+    ///
+    static float surface_area(const aabb_t& box) noexcept
+    {
+        glm::vec3 size = box.max - box.min;
+
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    ///
+    /// @brief Checks whether a box lies completely within another one.
+    ///
+    static bool contains(const aabb_t& outer, const aabb_t& inner) noexcept
+    {
+        return glm::all(glm::lessThanEqual(outer.min, inner.min)) && glm::all(glm::lessThanEqual(inner.max, outer.max));
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    AabbTree::AabbTree(float margin)
+        : m_nodes{},
+          m_root{NULL_NODE},
+          m_free_list{NULL_NODE},
+          m_object_count{0},
+          m_margin{margin}
+    {
+    }
+
+    int32_t AabbTree::insert(const aabb_t& box, uint32_t object)
+    {
+        int32_t proxy = this->allocate_node();
+
+        node_t& node = this->m_nodes[proxy];
+        node.box = fatten(box, this->m_margin);
+        node.object = object;
+        node.height = 0;
+
+        this->insert_leaf(proxy);
+        this->m_object_count++;
+
+        return proxy;
+    }
+
+    void AabbTree::remove(int32_t proxy)
+    {
+        this->remove_leaf(proxy);
+        this->free_node(proxy);
+        this->m_object_count--;
+    }
+
+    bool AabbTree::move(int32_t proxy, const aabb_t& box)
+    {
+        const aabb_t& fat_box = this->m_nodes[proxy].box;
+
+        if (contains(fat_box, box))
+        {
+            // an object that shrank a lot would keep reporting a box far too large
+            if (contains(fatten(box, this->m_margin * SHRINK_FACTOR), fat_box))
+            {
+                return false;
+            }
+        }
+
+        this->remove_leaf(proxy);
+
+        this->m_nodes[proxy].box = fatten(box, this->m_margin);
+
+        this->insert_leaf(proxy);
+
+        return true;
+    }
+
+    void AabbTree::clear() noexcept
+    {
+        this->m_nodes.clear();
+        this->m_root = NULL_NODE;
+        this->m_free_list = NULL_NODE;
+        this->m_object_count = 0;
+    }
+
+    const aabb_t& AabbTree::get_fat_box(int32_t proxy) const noexcept
+    {
+        return this->m_nodes[proxy].box;
+    }
+
+    size_t AabbTree::get_object_count() const noexcept
+    {
+        return this->m_object_count;
+    }
+
+    int32_t AabbTree::get_height() const noexcept
+    {
+        return this->m_root == NULL_NODE ? 0 : this->m_nodes[this->m_root].height;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    int32_t AabbTree::allocate_node()
+    {
+        if (this->m_free_list == NULL_NODE)
+        {
+            this->m_nodes.push_back({});
+            this->m_nodes.back().height = -1;
+            this->m_nodes.back().parent = NULL_NODE;
+
+            this->m_free_list = static_cast<int32_t>(this->m_nodes.size() - 1);
+        }
+
+        int32_t node = this->m_free_list;
+
+        this->m_free_list = this->m_nodes[node].parent;
+
+        this->m_nodes[node].parent = NULL_NODE;
+        this->m_nodes[node].child1 = NULL_NODE;
+        this->m_nodes[node].child2 = NULL_NODE;
+        this->m_nodes[node].height = 0;
+        this->m_nodes[node].object = 0;
+
+        return node;
+    }
+
+    void AabbTree::free_node(int32_t node)
+    {
+        this->m_nodes[node].parent = this->m_free_list;
+        this->m_nodes[node].height = -1;
+
+        this->m_free_list = node;
+    }
+
+    void AabbTree::insert_leaf(int32_t leaf)
+    {
+        if (this->m_root == NULL_NODE)
+        {
+            this->m_root = leaf;
+            this->m_nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        const aabb_t leaf_box = this->m_nodes[leaf].box;
+        int32_t sibling = this->m_root;
+
+        // descend while pushing the leaf into a child is cheaper than pairing it with the whole subtree
+        while (this->m_nodes[sibling].height > 0)
+        {
+            const node_t& node = this->m_nodes[sibling];
+
+            float area = surface_area(node.box);
+            float combined_area = surface_area(merge(node.box, leaf_box));
+
+            float cost = 2.0f * combined_area;
+            float inheritance_cost = 2.0f * (combined_area - area);
+
+            float child_costs[2];
+            int32_t children[2] = {node.child1, node.child2};
+
+            for (int child = 0; child < 2; child++)
+            {
+                const node_t& child_node = this->m_nodes[children[child]];
+
+                float merged_area = surface_area(merge(child_node.box, leaf_box));
+
+                child_costs[child] = child_node.height == 0
+                    ? merged_area + inheritance_cost
+                    : merged_area - surface_area(child_node.box) + inheritance_cost;
+            }
+
+            if (cost < child_costs[0] && cost < child_costs[1])
+            {
+                break;
+            }
+
+            sibling = child_costs[0] < child_costs[1] ? children[0] : children[1];
+        }
+
+        int32_t old_parent = this->m_nodes[sibling].parent;
+        int32_t new_parent = this->allocate_node();
+
+        node_t& parent = this->m_nodes[new_parent];
+        parent.parent = old_parent;
+        parent.box = merge(leaf_box, this->m_nodes[sibling].box);
+        parent.height = this->m_nodes[sibling].height + 1;
+        parent.child1 = sibling;
+        parent.child2 = leaf;
+
+        if (old_parent != NULL_NODE)
+        {
+            if (this->m_nodes[old_parent].child1 == sibling)
+            {
+                this->m_nodes[old_parent].child1 = new_parent;
+            }
+            else
+            {
+                this->m_nodes[old_parent].child2 = new_parent;
+            }
+        }
+        else
+        {
+            this->m_root = new_parent;
+        }
+
+        this->m_nodes[sibling].parent = new_parent;
+        this->m_nodes[leaf].parent = new_parent;
+
+        this->refit_ancestors(this->m_nodes[leaf].parent);
+    }
+
+    void AabbTree::remove_leaf(int32_t leaf)
+    {
+        if (leaf == this->m_root)
+        {
+            this->m_root = NULL_NODE;
+            return;
+        }
+
+        int32_t parent = this->m_nodes[leaf].parent;
+        int32_t grand_parent = this->m_nodes[parent].parent;
+        int32_t sibling = this->m_nodes[parent].child1 == leaf
+            ? this->m_nodes[parent].child2
+            : this->m_nodes[parent].child1;
+
+        this->free_node(parent);
+
+        this->m_nodes[sibling].parent = grand_parent;
+
+        if (grand_parent == NULL_NODE)
+        {
+            this->m_root = sibling;
+            return;
+        }
+
+        if (this->m_nodes[grand_parent].child1 == parent)
+        {
+            this->m_nodes[grand_parent].child1 = sibling;
+        }
+        else
+        {
+            this->m_nodes[grand_parent].child2 = sibling;
+        }
+
+        this->refit_ancestors(grand_parent);
+    }
+
+    void AabbTree::refit_ancestors(int32_t node)
+    {
+        while (node != NULL_NODE)
+        {
+            node = this->balance(node);
+
+            node_t& current = this->m_nodes[node];
+            const node_t& child1 = this->m_nodes[current.child1];
+            const node_t& child2 = this->m_nodes[current.child2];
+
+            current.box = merge(child1.box, child2.box);
+            current.height = 1 + std::max(child1.height, child2.height);
+
+            node = current.parent;
+        }
+    }
+
+    int32_t AabbTree::balance(int32_t index_a)
+    {
+        node_t& a = this->m_nodes[index_a];
+
+        if (a.height < 2)
+        {
+            return index_a;
+        }
+
+        int32_t index_b = a.child1;
+        int32_t index_c = a.child2;
+        node_t& b = this->m_nodes[index_b];
+        node_t& c = this->m_nodes[index_c];
+
+        int32_t height_difference = c.height - b.height;
+
+        if (height_difference > 1)
+        {
+            // C takes the place of A, A takes the lower child of C
+            int32_t index_f = c.child1;
+            int32_t index_g = c.child2;
+            node_t& f = this->m_nodes[index_f];
+            node_t& g = this->m_nodes[index_g];
+
+            c.child1 = index_a;
+            c.parent = a.parent;
+            a.parent = index_c;
+
+            if (c.parent != NULL_NODE)
+            {
+                node_t& parent = this->m_nodes[c.parent];
+                (parent.child1 == index_a ? parent.child1 : parent.child2) = index_c;
+            }
+            else
+            {
+                this->m_root = index_c;
+            }
+
+            if (f.height > g.height)
+            {
+                c.child2 = index_f;
+                a.child2 = index_g;
+                g.parent = index_a;
+                a.box = merge(b.box, g.box);
+                c.box = merge(a.box, f.box);
+                a.height = 1 + std::max(b.height, g.height);
+                c.height = 1 + std::max(a.height, f.height);
+            }
+            else
+            {
+                c.child2 = index_g;
+                a.child2 = index_f;
+                f.parent = index_a;
+                a.box = merge(b.box, f.box);
+                c.box = merge(a.box, g.box);
+                a.height = 1 + std::max(b.height, f.height);
+                c.height = 1 + std::max(a.height, g.height);
+            }
+
+            return index_c;
+        }
+
+        if (height_difference < -1)
+        {
+            // B takes the place of A, A takes the lower child of B
+            int32_t index_d = b.child1;
+            int32_t index_e = b.child2;
+            node_t& d = this->m_nodes[index_d];
+            node_t& e = this->m_nodes[index_e];
+
+            b.child1 = index_a;
+            b.parent = a.parent;
+            a.parent = index_b;
+
+            if (b.parent != NULL_NODE)
+            {
+                node_t& parent = this->m_nodes[b.parent];
+                (parent.child1 == index_a ? parent.child1 : parent.child2) = index_b;
+            }
+            else
+            {
+                this->m_root = index_b;
+            }
+
+            if (d.height > e.height)
+            {
+                b.child2 = index_d;
+                a.child1 = index_e;
+                e.parent = index_a;
+                a.box = merge(c.box, e.box);
+                b.box = merge(a.box, d.box);
+                a.height = 1 + std::max(c.height, e.height);
+                b.height = 1 + std::max(a.height, d.height);
+            }
+            else
+            {
+                b.child2 = index_e;
+                a.child1 = index_d;
+                d.parent = index_a;
+                a.box = merge(c.box, d.box);
+                b.box = merge(a.box, e.box);
+                a.height = 1 + std::max(c.height, d.height);
+                b.height = 1 + std::max(a.height, e.height);
+            }
+
+            return index_b;
+        }
+
+        return index_a;
+    }
+
+    aabb_t AabbTree::fatten(const aabb_t& box, float margin) noexcept
+    {
+        glm::vec3 padding = (box.max - box.min) * margin;
+
+        return {box.min - padding, box.max + padding};
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
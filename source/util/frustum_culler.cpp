@@ -0,0 +1,167 @@
+///
+/// @file frustum_culler.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the FrustumCuller class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include "frustum_culler.hpp"
+#include "frustum_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    FrustumCuller::FrustumCuller()
+        : m_center_x{},
+          m_center_y{},
+          m_center_z{},
+          m_radius{},
+          m_visible{},
+          m_culled_count{0}
+    {
+    }
+
+    void FrustumCuller::clear() noexcept
+    {
+        this->m_center_x.clear();
+        this->m_center_y.clear();
+        this->m_center_z.clear();
+        this->m_radius.clear();
+        this->m_visible.clear();
+        this->m_culled_count = 0;
+    }
+
+    size_t FrustumCuller::add(const bounding_sphere_t& sphere)
+    {
+        this->m_center_x.push_back(sphere.center.x);
+        this->m_center_y.push_back(sphere.center.y);
+        this->m_center_z.push_back(sphere.center.z);
+        this->m_radius.push_back(sphere.radius);
+
+        return this->m_radius.size() - 1;
+    }
+
+    size_t FrustumCuller::cull(const frustum_t& frustum)
+    {
+        const size_t count = this->m_radius.size();
+
+        this->m_visible.resize(count);
+        this->m_culled_count = 0;
+
+        size_t first = this->cull_batches(frustum);
+
+        for (size_t idx = first; idx < count; idx++)
+        {
+            glm::vec3 center(this->m_center_x[idx], this->m_center_y[idx], this->m_center_z[idx]);
+
+            bool outside = is_sphere_outside(frustum, center, this->m_radius[idx]);
+
+            this->m_visible[idx] = outside ? 0 : 1;
+            this->m_culled_count += outside ? 1 : 0;
+        }
+
+        return this->m_culled_count;
+    }
+
+    bool FrustumCuller::is_visible(size_t index) const noexcept
+    {
+        return this->m_visible[index] != 0;
+    }
+
+    size_t FrustumCuller::get_count() const noexcept
+    {
+        return this->m_radius.size();
+    }
+
+    bool FrustumCuller::is_simd_enabled() noexcept
+    {
+#if defined(__AVX2__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    size_t FrustumCuller::cull_batches(const frustum_t& frustum)
+    {
+#if defined(__AVX2__)
+        const size_t batch_end = this->m_radius.size() / BATCH_SIZE * BATCH_SIZE;
+
+        __m256 plane_x[6];
+        __m256 plane_y[6];
+        __m256 plane_z[6];
+        __m256 plane_w[6];
+
+        for (int plane = 0; plane < 6; plane++)
+        {
+            plane_x[plane] = _mm256_set1_ps(frustum.planes[plane].x);
+            plane_y[plane] = _mm256_set1_ps(frustum.planes[plane].y);
+            plane_z[plane] = _mm256_set1_ps(frustum.planes[plane].z);
+            plane_w[plane] = _mm256_set1_ps(frustum.planes[plane].w);
+        }
+
+        for (size_t first = 0; first < batch_end; first += BATCH_SIZE)
+        {
+            __m256 center_x = _mm256_loadu_ps(this->m_center_x.data() + first);
+            __m256 center_y = _mm256_loadu_ps(this->m_center_y.data() + first);
+            __m256 center_z = _mm256_loadu_ps(this->m_center_z.data() + first);
+            __m256 negative_radius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(this->m_radius.data() + first));
+
+            __m256 outside = _mm256_setzero_ps();
+
+            for (int plane = 0; plane < 6; plane++)
+            {
+                __m256 distance = _mm256_add_ps(_mm256_mul_ps(center_x, plane_x[plane]), plane_w[plane]);
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(center_y, plane_y[plane]));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(center_z, plane_z[plane]));
+
+                outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negative_radius, _CMP_LT_OQ));
+            }
+
+            int outside_mask = _mm256_movemask_ps(outside);
+
+            for (size_t lane = 0; lane < BATCH_SIZE; lane++)
+            {
+                bool lane_outside = (outside_mask >> lane) & 1;
+
+                this->m_visible[first + lane] = lane_outside ? 0 : 1;
+                this->m_culled_count += lane_outside ? 1 : 0;
+            }
+        }
+
+        return batch_end;
+#else
+        (void) frustum;
+
+        return 0;
+#endif
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
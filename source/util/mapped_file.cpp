@@ -0,0 +1,176 @@
+///
+/// @file mapped_file.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the MappedFile class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef _WIN32
+
+    MappedFile::MappedFile(const std::string& file_path)
+        : m_data{nullptr},
+          m_size{0},
+          m_file_handle{INVALID_HANDLE_VALUE},
+          m_mapping_handle{nullptr}
+    {
+        this->m_file_handle = CreateFileA(file_path.c_str(),
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                          nullptr);
+
+        if (this->m_file_handle == INVALID_HANDLE_VALUE)
+        {
+            return;
+        }
+
+        LARGE_INTEGER file_size{};
+
+        if (!GetFileSizeEx(this->m_file_handle, &file_size) || file_size.QuadPart == 0)
+        {
+            return;
+        }
+
+        this->m_mapping_handle = CreateFileMappingA(this->m_file_handle,
+                                                    nullptr,
+                                                    PAGE_READONLY,
+                                                    0,
+                                                    0,
+                                                    nullptr);
+
+        if (this->m_mapping_handle == nullptr)
+        {
+            return;
+        }
+
+        void* view = MapViewOfFile(this->m_mapping_handle, FILE_MAP_READ, 0, 0, 0);
+
+        if (view != nullptr)
+        {
+            this->m_data = static_cast<const char*>(view);
+            this->m_size = static_cast<size_t>(file_size.QuadPart);
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (this->m_data != nullptr)
+        {
+            UnmapViewOfFile(this->m_data);
+        }
+
+        if (this->m_mapping_handle != nullptr)
+        {
+            CloseHandle(this->m_mapping_handle);
+        }
+
+        if (this->m_file_handle != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(this->m_file_handle);
+        }
+    }
+
+#else
+
+    MappedFile::MappedFile(const std::string& file_path)
+        : m_data{nullptr},
+          m_size{0}
+    {
+        int file_descriptor = open(file_path.c_str(), O_RDONLY);
+
+        if (file_descriptor < 0)
+        {
+            return;
+        }
+
+        struct stat file_status{};
+
+        if (fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0)
+        {
+            void* view = mmap(nullptr,
+                              static_cast<size_t>(file_status.st_size),
+                              PROT_READ,
+                              MAP_PRIVATE,
+                              file_descriptor,
+                              0);
+
+            if (view != MAP_FAILED)
+            {
+                madvise(view, static_cast<size_t>(file_status.st_size), MADV_SEQUENTIAL);
+                this->m_data = static_cast<const char*>(view);
+                this->m_size = static_cast<size_t>(file_status.st_size);
+            }
+        }
+
+        // the mapping keeps its own reference to the file
+        close(file_descriptor);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (this->m_data != nullptr)
+        {
+            munmap(const_cast<char*>(this->m_data), this->m_size);
+        }
+    }
+
+#endif
+
+    bool MappedFile::is_open() const noexcept
+    {
+        return this->m_data != nullptr;
+    }
+
+    const char* MappedFile::data() const noexcept
+    {
+        return this->m_data;
+    }
+
+    size_t MappedFile::size() const noexcept
+    {
+        return this->m_size;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
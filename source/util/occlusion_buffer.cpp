@@ -0,0 +1,431 @@
+///
+/// @file occlusion_buffer.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the OcclusionBuffer class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include "occlusion_buffer.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr float MIN_TRIANGLE_AREA = 1e-6f; ///< Twice the pixel area below which a triangle covers no pixel center.
+
+    ///
+    /// @brief Computes the signed distance of a clip space point to the near plane, non negative in front of it.
+    ///
+    static float near_distance(const glm::vec4& clip) noexcept
+    {
+        return clip.z + clip.w;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    OcclusionBuffer::OcclusionBuffer(uint32_t width, uint32_t height)
+        : m_width{(std::max(width, 1u) + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE},
+          m_height{(std::max(height, 1u) + TILE_SIZE - 1) / TILE_SIZE * TILE_SIZE},
+          m_depth{},
+          m_tile_depth{},
+          m_triangles{}
+    {
+        this->m_depth.assign(static_cast<size_t>(this->m_width) * this->m_height, 1.0f);
+        this->m_tile_depth.assign(static_cast<size_t>(this->m_width / TILE_SIZE) * (this->m_height / TILE_SIZE), 1.0f);
+    }
+
+    void OcclusionBuffer::clear()
+    {
+        this->m_triangles.clear();
+    }
+
+    void OcclusionBuffer::add_occluder(const std::vector<glm::vec3>& vertices,
+                                       const std::vector<uint32_t>& indices,
+                                       const glm::mat4& model_view_projection)
+    {
+        for (size_t idx = 0; idx + 2 < indices.size(); idx += 3)
+        {
+            glm::vec4 clip[3];
+
+            for (size_t corner = 0; corner < 3; corner++)
+            {
+                clip[corner] = model_view_projection * glm::vec4(vertices[indices[idx + corner]], 1.0f);
+            }
+
+            this->add_clipped_triangle(clip);
+        }
+    }
+
+    void OcclusionBuffer::rasterize(ThreadPool* thread_pool)
+    {
+        if (!thread_pool)
+        {
+            for (uint32_t first_row = 0; first_row < this->m_height; first_row += BAND_HEIGHT)
+            {
+                this->rasterize_band(first_row, std::min(first_row + BAND_HEIGHT, this->m_height));
+            }
+
+            return;
+        }
+
+        size_t band_count = (this->m_height + BAND_HEIGHT - 1) / BAND_HEIGHT;
+
+        // the calling thread draws bands too, and only bands, while the workers help
+        thread_pool->parallel_for(band_count, [this](size_t band)
+        {
+            uint32_t first_row = static_cast<uint32_t>(band) * BAND_HEIGHT;
+
+            this->rasterize_band(first_row, std::min(first_row + BAND_HEIGHT, this->m_height));
+        });
+    }
+
+    bool OcclusionBuffer::is_box_visible(const aabb_t& box, const glm::mat4& view_projection) const
+    {
+        glm::vec2 screen_min(1e30f);
+        glm::vec2 screen_max(-1e30f);
+        float nearest_depth = 1e30f;
+
+        for (int corner = 0; corner < 8; corner++)
+        {
+            glm::vec3 position((corner & 1) ? box.max.x : box.min.x,
+                               (corner & 2) ? box.max.y : box.min.y,
+                               (corner & 4) ? box.max.z : box.min.z);
+
+            glm::vec4 clip = view_projection * glm::vec4(position, 1.0f);
+
+            // the projection of a box that crosses the near plane is unbounded
+            if (clip.w <= 0.0f || near_distance(clip) < 0.0f)
+            {
+                return true;
+            }
+
+            glm::vec3 ndc = glm::vec3(clip) / clip.w;
+
+            glm::vec2 screen((ndc.x * 0.5f + 0.5f) * static_cast<float>(this->m_width),
+                             (ndc.y * 0.5f + 0.5f) * static_cast<float>(this->m_height));
+
+            screen_min = glm::min(screen_min, screen);
+            screen_max = glm::max(screen_max, screen);
+            nearest_depth = std::min(nearest_depth, ndc.z * 0.5f + 0.5f);
+        }
+
+        // off screen boxes are left to the frustum culling
+        if (screen_max.x < 0.0f || screen_max.y < 0.0f
+            || screen_min.x >= static_cast<float>(this->m_width) || screen_min.y >= static_cast<float>(this->m_height))
+        {
+            return true;
+        }
+
+        // every pixel the rectangle touches, not only those whose center it covers
+        auto min_x = static_cast<uint32_t>(std::max(screen_min.x, 0.0f));
+        auto min_y = static_cast<uint32_t>(std::max(screen_min.y, 0.0f));
+        auto max_x = static_cast<uint32_t>(std::min(screen_max.x, static_cast<float>(this->m_width - 1)));
+        auto max_y = static_cast<uint32_t>(std::min(screen_max.y, static_cast<float>(this->m_height - 1)));
+
+        const uint32_t tiles_per_row = this->m_width / TILE_SIZE;
+
+        for (uint32_t tile_y = min_y / TILE_SIZE; tile_y <= max_y / TILE_SIZE; tile_y++)
+        {
+            for (uint32_t tile_x = min_x / TILE_SIZE; tile_x <= max_x / TILE_SIZE; tile_x++)
+            {
+                if (this->m_tile_depth[tile_y * tiles_per_row + tile_x] < nearest_depth)
+                {
+                    continue;
+                }
+
+                // the tile has a far pixel somewhere, only the pixels under the box count
+                uint32_t first_y = std::max(min_y, tile_y * TILE_SIZE);
+                uint32_t last_y = std::min(max_y, tile_y * TILE_SIZE + TILE_SIZE - 1);
+                uint32_t first_x = std::max(min_x, tile_x * TILE_SIZE);
+                uint32_t last_x = std::min(max_x, tile_x * TILE_SIZE + TILE_SIZE - 1);
+
+                for (uint32_t y = first_y; y <= last_y; y++)
+                {
+                    const float* row = this->m_depth.data() + static_cast<size_t>(y) * this->m_width;
+
+                    for (uint32_t x = first_x; x <= last_x; x++)
+                    {
+                        if (row[x] >= nearest_depth)
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
+    float OcclusionBuffer::get_depth(uint32_t x, uint32_t y) const noexcept
+    {
+        return this->m_depth[static_cast<size_t>(y) * this->m_width + x];
+    }
+
+    size_t OcclusionBuffer::get_triangle_count() const noexcept
+    {
+        return this->m_triangles.size();
+    }
+
+    uint32_t OcclusionBuffer::get_width() const noexcept
+    {
+        return this->m_width;
+    }
+
+    uint32_t OcclusionBuffer::get_height() const noexcept
+    {
+        return this->m_height;
+    }
+
+    bool OcclusionBuffer::is_simd_enabled() noexcept
+    {
+#if defined(__AVX2__)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void OcclusionBuffer::add_clipped_triangle(const glm::vec4 clip[3])
+    {
+        float distances[3] = {near_distance(clip[0]), near_distance(clip[1]), near_distance(clip[2])};
+
+        if (distances[0] >= 0.0f && distances[1] >= 0.0f && distances[2] >= 0.0f)
+        {
+            this->add_projected_triangle(clip);
+            return;
+        }
+
+        // Sutherland-Hodgman against the near plane leaves at most four corners
+        glm::vec4 polygon[4];
+        size_t corner_count = 0;
+
+        for (size_t idx = 0; idx < 3; idx++)
+        {
+            size_t next = (idx + 1) % 3;
+
+            if (distances[idx] >= 0.0f)
+            {
+                polygon[corner_count++] = clip[idx];
+            }
+
+            if ((distances[idx] >= 0.0f) != (distances[next] >= 0.0f))
+            {
+                float t = distances[idx] / (distances[idx] - distances[next]);
+                polygon[corner_count++] = clip[idx] + (clip[next] - clip[idx]) * t;
+            }
+        }
+
+        for (size_t idx = 1; idx + 1 < corner_count; idx++)
+        {
+            const glm::vec4 triangle[3] = {polygon[0], polygon[idx], polygon[idx + 1]};
+
+            this->add_projected_triangle(triangle);
+        }
+    }
+
+    void OcclusionBuffer::add_projected_triangle(const glm::vec4 clip[3])
+    {
+        glm::vec3 screen[3];
+
+        for (size_t idx = 0; idx < 3; idx++)
+        {
+            // a corner on the near plane with w = 0 only happens for a degenerate projection
+            if (clip[idx].w <= 0.0f)
+            {
+                return;
+            }
+
+            glm::vec3 ndc = glm::vec3(clip[idx]) / clip[idx].w;
+
+            screen[idx] = glm::vec3((ndc.x * 0.5f + 0.5f) * static_cast<float>(this->m_width),
+                                    (ndc.y * 0.5f + 0.5f) * static_cast<float>(this->m_height),
+                                    ndc.z * 0.5f + 0.5f);
+        }
+
+        glm::vec3 edge1 = screen[1] - screen[0];
+        glm::vec3 edge2 = screen[2] - screen[0];
+
+        float area = edge1.x * edge2.y - edge2.x * edge1.y;
+
+        if (std::fabs(area) < MIN_TRIANGLE_AREA)
+        {
+            return;
+        }
+
+        // pixel centers, clamped before the conversion so far off screen corners do not overflow
+        float min_x = std::min(screen[0].x, std::min(screen[1].x, screen[2].x));
+        float max_x = std::max(screen[0].x, std::max(screen[1].x, screen[2].x));
+        float min_y = std::min(screen[0].y, std::min(screen[1].y, screen[2].y));
+        float max_y = std::max(screen[0].y, std::max(screen[1].y, screen[2].y));
+
+        triangle_t triangle{};
+        triangle.min_x = static_cast<int32_t>(std::ceil(std::max(min_x - 0.5f, 0.0f)));
+        triangle.max_x = static_cast<int32_t>(std::floor(std::min(max_x - 0.5f, static_cast<float>(this->m_width - 1))));
+        triangle.min_y = static_cast<int32_t>(std::ceil(std::max(min_y - 0.5f, 0.0f)));
+        triangle.max_y = static_cast<int32_t>(std::floor(std::min(max_y - 0.5f, static_cast<float>(this->m_height - 1))));
+
+        if (triangle.min_x > triangle.max_x || triangle.min_y > triangle.max_y)
+        {
+            return;
+        }
+
+        // both windings are drawn, a clockwise triangle gets its edge functions flipped
+        float winding = area > 0.0f ? 1.0f : -1.0f;
+
+        for (int edge = 0; edge < 3; edge++)
+        {
+            const glm::vec3& from = screen[edge];
+            const glm::vec3& to = screen[(edge + 1) % 3];
+
+            float step_x = -(to.y - from.y) * winding;
+            float step_y = (to.x - from.x) * winding;
+
+            triangle.edge_x[edge] = step_x;
+            triangle.edge_y[edge] = step_y;
+            triangle.edge_origin[edge] = step_x * (0.5f - from.x) + step_y * (0.5f - from.y);
+        }
+
+        float depth_x = (edge1.z * edge2.y - edge2.z * edge1.y) / area;
+        float depth_y = (edge2.z * edge1.x - edge1.z * edge2.x) / area;
+
+        triangle.depth_plane = glm::vec3(depth_x,
+                                         depth_y,
+                                         screen[0].z + depth_x * (0.5f - screen[0].x) + depth_y * (0.5f - screen[0].y));
+
+        this->m_triangles.push_back(triangle);
+    }
+
+    void OcclusionBuffer::rasterize_band(uint32_t first_row, uint32_t last_row)
+    {
+        std::fill(this->m_depth.begin() + static_cast<std::ptrdiff_t>(first_row) * this->m_width,
+                  this->m_depth.begin() + static_cast<std::ptrdiff_t>(last_row) * this->m_width,
+                  1.0f);
+
+        for (const auto& triangle : this->m_triangles)
+        {
+            auto first = static_cast<uint32_t>(std::max(triangle.min_y, static_cast<int32_t>(first_row)));
+            auto last = static_cast<uint32_t>(std::min(triangle.max_y + 1, static_cast<int32_t>(last_row)));
+
+            for (uint32_t row = first; row < last; row++)
+            {
+                this->rasterize_row(triangle, row);
+            }
+        }
+
+        const uint32_t tiles_per_row = this->m_width / TILE_SIZE;
+
+        for (uint32_t tile_y = first_row / TILE_SIZE; tile_y < last_row / TILE_SIZE; tile_y++)
+        {
+            for (uint32_t tile_x = 0; tile_x < tiles_per_row; tile_x++)
+            {
+                float farthest = 0.0f;
+
+                for (uint32_t y = tile_y * TILE_SIZE; y < (tile_y + 1) * TILE_SIZE; y++)
+                {
+                    const float* row = this->m_depth.data() + static_cast<size_t>(y) * this->m_width + tile_x * TILE_SIZE;
+
+                    farthest = std::max(farthest, *std::max_element(row, row + TILE_SIZE));
+                }
+
+                this->m_tile_depth[tile_y * tiles_per_row + tile_x] = farthest;
+            }
+        }
+    }
+
+    void OcclusionBuffer::rasterize_row(const triangle_t& triangle, uint32_t row)
+    {
+        float* depth_row = this->m_depth.data() + static_cast<size_t>(row) * this->m_width;
+
+        const auto y = static_cast<float>(row);
+
+        glm::vec3 row_edges = triangle.edge_origin + triangle.edge_y * y;
+        float row_depth = triangle.depth_plane.z + triangle.depth_plane.y * y;
+
+        // the rows are a multiple of eight pixels wide, so an aligned batch never runs past the row
+        auto first_x = static_cast<uint32_t>(triangle.min_x) & ~7u;
+        auto last_x = static_cast<uint32_t>(triangle.max_x);
+
+#if defined(__AVX2__)
+        const __m256 lanes = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+        const __m256 zero = _mm256_setzero_ps();
+
+        __m256 step_x[3];
+
+        for (int edge = 0; edge < 3; edge++)
+        {
+            step_x[edge] = _mm256_set1_ps(triangle.edge_x[edge]);
+        }
+
+        __m256 depth_step_x = _mm256_set1_ps(triangle.depth_plane.x);
+
+        for (uint32_t x = first_x; x <= last_x; x += 8)
+        {
+            __m256 columns = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), lanes);
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (int edge = 0; edge < 3; edge++)
+            {
+                __m256 value = _mm256_add_ps(_mm256_set1_ps(row_edges[edge]), _mm256_mul_ps(step_x[edge], columns));
+
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(value, zero, _CMP_GE_OQ));
+            }
+
+            if (_mm256_movemask_ps(inside) == 0)
+            {
+                continue;
+            }
+
+            __m256 depth = _mm256_add_ps(_mm256_set1_ps(row_depth), _mm256_mul_ps(depth_step_x, columns));
+            __m256 current = _mm256_loadu_ps(depth_row + x);
+
+            _mm256_storeu_ps(depth_row + x, _mm256_blendv_ps(current, _mm256_min_ps(current, depth), inside));
+        }
+#else
+        for (uint32_t x = first_x; x <= last_x; x++)
+        {
+            const auto column = static_cast<float>(x);
+
+            glm::vec3 edges = row_edges + triangle.edge_x * column;
+
+            if (edges.x < 0.0f || edges.y < 0.0f || edges.z < 0.0f)
+            {
+                continue;
+            }
+
+            depth_row[x] = std::min(depth_row[x], row_depth + triangle.depth_plane.x * column);
+        }
+#endif
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -0,0 +1,185 @@
+///
+/// @file thread_pool.cpp
+/// @author Yasin BASAR
+/// @brief Implementation of the ThreadPool class methods.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include "thread_pool.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace YB
+{
+////////////////////////////////////////////////////////////////////////////////
+// Public Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    ThreadPool::ThreadPool(size_t thread_count)
+        : m_stopping{false}
+    {
+        if (thread_count == 0)
+        {
+            thread_count = 1;
+        }
+
+        this->m_workers.reserve(thread_count);
+
+        for (size_t idx = 0; idx < thread_count; idx++)
+        {
+            this->m_workers.emplace_back(&ThreadPool::worker_loop, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(this->m_mutex);
+            this->m_stopping = true;
+        }
+
+        this->m_condition.notify_all();
+
+        for (auto& worker: this->m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::parallel_for(size_t count, const std::function<void(size_t)>& body)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        auto batch = std::make_shared<parallel_batch_t>();
+        batch->body = body;
+        batch->count = count;
+
+        // the caller takes one share, a helper that starts after all indices are claimed returns at once
+        size_t helper_count = std::min(count - 1, this->m_workers.size());
+
+        if (helper_count > 0)
+        {
+            {
+                std::lock_guard lock(this->m_mutex);
+
+                for (size_t idx = 0; idx < helper_count; idx++)
+                {
+                    this->m_tasks.emplace_back([batch]() { run_batch(*batch); });
+                }
+            }
+
+            this->m_condition.notify_all();
+        }
+
+        run_batch(*batch);
+
+        std::unique_lock lock(batch->mutex);
+
+        batch->condition.wait(lock, [&batch]()
+        {
+            return batch->finished == batch->count;
+        });
+    }
+
+    size_t ThreadPool::get_thread_count() const noexcept
+    {
+        return this->m_workers.size();
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Private Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    void ThreadPool::worker_loop()
+    {
+        while (true)
+        {
+            std::function<void()> task{};
+
+            {
+                std::unique_lock lock(this->m_mutex);
+
+                this->m_condition.wait(lock, [this]()
+                {
+                    return this->m_stopping || !this->m_tasks.empty();
+                });
+
+                if (this->m_tasks.empty())
+                {
+                    // stopping and nothing left to do
+                    return;
+                }
+
+                task = std::move(this->m_tasks.front());
+                this->m_tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    void ThreadPool::run_batch(parallel_batch_t& batch)
+    {
+        size_t finished = 0;
+
+        for (size_t idx = batch.next.fetch_add(1); idx < batch.count; idx = batch.next.fetch_add(1))
+        {
+            batch.body(idx);
+            finished++;
+        }
+
+        if (finished == 0)
+        {
+            return;
+        }
+
+        std::lock_guard lock(batch.mutex);
+
+        batch.finished += finished;
+
+        if (batch.finished == batch.count)
+        {
+            batch.condition.notify_all();
+        }
+    }
+
+    bool ThreadPool::run_pending_task()
+    {
+        std::function<void()> task{};
+
+        {
+            std::lock_guard lock(this->m_mutex);
+
+            if (this->m_tasks.empty())
+            {
+                return false;
+            }
+
+            task = std::move(this->m_tasks.front());
+            this->m_tasks.pop_front();
+        }
+
+        task();
+
+        return true;
+    }
+
+////////////////////////////////////////////////////////////////////////////////
+// Protected Functions
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace YB
+
+/* End of File */
@@ -23,6 +23,12 @@
 
 namespace YB
 {
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+    constexpr int CONTEXT_VERSIONS[][2] = {{4, 3}, {3, 3}}; ///< 4.3 enables GPU-driven rendering, 3.3 is the minimum.
+
 ////////////////////////////////////////////////////////////////////////////////
 // Public Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -41,8 +47,6 @@ namespace YB
         }
 
         // window hints
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
@@ -52,12 +56,23 @@ namespace YB
         // for multisampling/anti-aliasing
         glfwWindowHint(GLFW_SAMPLES, 4);
 
-        /* Create a windowed mode window and its OpenGL context */
-        this->m_window = glfwCreateWindow(window_width,
-                                          window_height,
-                                          window_name,
-                                          nullptr,
-                                          nullptr);
+        /* Create a windowed mode window and its OpenGL context, the newest version the driver offers */
+        for (const auto& context_version: CONTEXT_VERSIONS)
+        {
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, context_version[0]);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, context_version[1]);
+
+            this->m_window = glfwCreateWindow(window_width,
+                                              window_height,
+                                              window_name,
+                                              nullptr,
+                                              nullptr);
+
+            if (this->m_window)
+            {
+                break;
+            }
+        }
 
         if (!this->m_window)
         {
@@ -12,8 +12,11 @@
 // Project Includes
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <iostream>
 #include "default_world.hpp"
 #include "draw_components.hpp"
+#include "frustum_utils.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Third Party Includes
@@ -37,74 +40,641 @@ namespace YB
                                  bool rotatable,
                                  bool scalable)
     {
-        this->m_objs.emplace_back(file_name, model_name, position, rotatable, scalable);
+        model_handle_t model = CoreComponents::asset_manager->acquire(file_name);
+
+        if (!model)
+        {
+            return;
+        }
+
+        this->add_placement(std::move(model), model_name, position, rotatable, scalable);
+    }
+
+    std::shared_ptr<ModelLoadRequest> DefaultWorld::add_model_async(const std::string& file_name,
+                                                                    const std::string& model_name,
+                                                                    const glm::vec3& position,
+                                                                    bool rotatable,
+                                                                    bool scalable,
+                                                                    const model_load_callbacks_t& callbacks)
+    {
+        auto request = std::make_shared<ModelLoadRequest>(file_name,
+                                                          model_name,
+                                                          position,
+                                                          rotatable,
+                                                          scalable,
+                                                          callbacks);
+
+        if (CoreComponents::thread_pool)
+        {
+            CoreComponents::thread_pool->submit([request]() { request->load(); });
+        }
+        else
+        {
+            request->load();
+        }
+
+        this->m_pending_models.push_back(request);
+
+        return request;
+    }
+
+    size_t DefaultWorld::add_instanced_model(const std::string& file_name, const std::string& model_name)
+    {
+        std::string file_path = AssetManager::canonicalize(file_name);
+
+        auto loaded = std::find_if(this->m_instanced_models.begin(),
+                                   this->m_instanced_models.end(),
+                                   [&file_path](const std::shared_ptr<InstancedModel>& model)
+                                   {
+                                       return model->get_file_path() == file_path;
+                                   });
+
+        if (loaded != this->m_instanced_models.end())
+        {
+            return static_cast<size_t>(loaded - this->m_instanced_models.begin());
+        }
+
+        this->m_instanced_models.push_back(std::make_shared<InstancedModel>(file_name));
+
+        return this->m_instanced_models.size() - 1;
+    }
+
+    size_t DefaultWorld::add_model_instance(size_t model, const glm::mat4& transform)
+    {
+        return this->m_instanced_models[model]->add_instance(transform);
+    }
+
+    void DefaultWorld::add_occluder(const std::vector<glm::vec3>& vertices,
+                                    const std::vector<uint32_t>& indices,
+                                    const glm::mat4& transform)
+    {
+        this->m_occluders.push_back({vertices, indices, transform});
     }
 
     void DefaultWorld::render_models()
     {
-        for (auto & obj : this->m_objs)
+        this->update_pending_models();
+
+        UniformTable::reset_stats();
+
+        update_frame_block();
+
+        // uploads and released models may have changed the texture and vertex array bindings since the last frame
+        Material::reset_bindings();
+        CoreComponents::geometry_arena->reset_bindings();
+
+        this->m_triangle_count = 0;
+        this->m_culled_count = 0;
+        this->m_occluded_count = 0;
+
+        // the indirect draw pass has its own program, which only stands in for the directional light shader
+        bool directional = DrawComponents::shader == DrawComponents::shader_library->get(SHADER_PROGRAM::DIRECTIONAL_LIGHT);
+
+        if (this->m_gpu_driven && directional && this->create_indirect_pass())
         {
-            DrawComponents::shader->use_shader_program();
+            this->render_models_indirect();
+        }
+        else
+        {
+            this->render_models_direct();
+        }
 
-            // Apply transformations to the model matrix.
-            DrawComponents::shader->model_matrix = glm::translate(glm::mat4(1.0f), obj.obj_position);
+        this->render_instanced_models();
 
-            if (obj.is_rotatable)
-            {
-                DrawComponents::shader->model_matrix
-                    = glm::rotate(DrawComponents::shader->model_matrix,
-                                  glm::radians(this->m_rotate_angle),
-                                  glm::vec3(0, 1, 0));
-            }
+        this->render_placeholders();
 
-            if (obj.is_scalable)
-            {
-                DrawComponents::shader->model_matrix
-                    = glm::scale(DrawComponents::shader->model_matrix,
-                                 this->m_scale_factor + glm::vec3(1.0f, 1.0f, 1.0f));
-            }
+        this->m_uniform_stats = UniformTable::get_stats();
+    }
+
+    void DefaultWorld::set_lod_settings(const lod_settings_t& settings) noexcept
+    {
+        this->m_lod_settings = settings;
+    }
+
+    void DefaultWorld::set_meshlet_culling(bool enabled) noexcept
+    {
+        this->m_meshlet_culling = enabled;
+    }
+
+    void DefaultWorld::set_gpu_driven(bool enabled) noexcept
+    {
+        this->m_gpu_driven = enabled;
+    }
+
+    void DefaultWorld::set_occlusion_culling(bool enabled) noexcept
+    {
+        this->m_occlusion_culling = enabled;
+    }
 
-            DrawComponents::shader->view_matrix = CoreComponents::camera->get_view_matrix();
+    void DefaultWorld::set_occlusion_queries(bool enabled) noexcept
+    {
+        this->m_occlusion_queries = enabled;
+    }
 
-            glm::mat4 inverse_transpose
-                = glm::inverseTranspose(DrawComponents::shader->view_matrix * DrawComponents::shader->model_matrix);
+    size_t DefaultWorld::get_triangle_count() const noexcept
+    {
+        return this->m_triangle_count;
+    }
 
-            DrawComponents::shader->normal_matrix = glm::mat3(inverse_transpose);
+    size_t DefaultWorld::get_culled_count() const noexcept
+    {
+        return this->m_culled_count;
+    }
 
-            // Send matrices to the shader.
-            glUniformMatrix4fv(DrawComponents::shader->model_matrix_location,
-                               1,
-                               GL_FALSE,
-                               glm::value_ptr(DrawComponents::shader->model_matrix));
+    size_t DefaultWorld::get_occluded_count() const noexcept
+    {
+        return this->m_occluded_count;
+    }
 
-            glUniformMatrix3fv(DrawComponents::shader->normal_matrix_location,
-                               1,
-                               GL_FALSE,
-                               glm::value_ptr(DrawComponents::shader->normal_matrix));
+    const render_queue_stats_t& DefaultWorld::get_render_queue_stats() const noexcept
+    {
+        return this->m_render_queue.get_stats();
+    }
 
-            glUniformMatrix4fv(DrawComponents::shader->view_matrix_location,
-                               1,
-                               GL_FALSE,
-                               glm::value_ptr(DrawComponents::shader->view_matrix));
+    const uniform_stats_t& DefaultWorld::get_uniform_stats() const noexcept
+    {
+        return this->m_uniform_stats;
+    }
 
-            obj.draw(DrawComponents::shader->shader_program);
+    occlusion_query_stats_t DefaultWorld::get_occlusion_query_stats() const noexcept
+    {
+        if (!this->m_query_pass)
+        {
+            return {0, 0, 0, 0.0f, 0};
         }
+
+        return this->m_query_pass->get_stats();
     }
 
     void DefaultWorld::increase_rotate_angle(float value)
     {
         World::increase_rotate_angle(value);
+
+        this->refit_placements();
     }
 
     void DefaultWorld::increase_scale_factor(float value)
     {
         World::increase_scale_factor(value);
+
+        this->refit_placements();
     }
 
 ////////////////////////////////////////////////////////////////////////////////
 // Private Functions
 ////////////////////////////////////////////////////////////////////////////////
 
+    void DefaultWorld::render_models_direct()
+    {
+        glm::mat4 view_projection = DrawComponents::shader->projection_matrix * CoreComponents::camera->get_view_matrix();
+        frustum_t frustum = extract_frustum(view_projection);
+
+        this->m_visible_objs.clear();
+        this->m_border_objs.clear();
+        this->m_culler.clear();
+
+        this->m_render_queue.begin_frame(CoreComponents::camera->get_view_matrix());
+
+        // boxes completely inside need no further test, the spheres of those crossing a plane are tighter than their boxes
+        this->m_tree.query_frustum(frustum, [this](uint32_t object, bool inside)
+        {
+            if (inside)
+            {
+                this->m_visible_objs.push_back(object);
+                return;
+            }
+
+            const model_placement_t& obj = this->m_objs[object];
+
+            this->m_border_objs.push_back(object);
+            this->m_culler.add(transform_sphere(obj.model->get_bounding_sphere(), this->m_model_matrices[object]));
+        });
+
+        this->m_culler.cull(frustum);
+
+        for (size_t idx = 0; idx < this->m_border_objs.size(); idx++)
+        {
+            if (this->m_culler.is_visible(idx))
+            {
+                this->m_visible_objs.push_back(this->m_border_objs[idx]);
+            }
+        }
+
+        this->m_culled_count += this->m_objs.size() - this->m_visible_objs.size();
+
+        this->cull_occluded(view_projection);
+
+        if (this->m_occlusion_queries && this->create_query_pass())
+        {
+            this->m_query_boxes.resize(this->m_visible_objs.size());
+
+            for (size_t idx = 0; idx < this->m_visible_objs.size(); idx++)
+            {
+                this->m_query_boxes[idx] = this->m_tree.get_fat_box(this->m_objs[this->m_visible_objs[idx]].proxy);
+            }
+
+            this->m_query_pass->resize(this->m_objs.size());
+            occlusion_query_callbacks_t callbacks{};
+
+            // the placements without a query come in one list and are sorted together, the others come one by one
+            callbacks.draw = [this](const std::vector<uint32_t>& objects)
+            {
+                for (uint32_t idx : objects)
+                {
+                    this->draw_placement(idx);
+                }
+
+                this->m_render_queue.submit();
+            };
+
+            // the boxes were drawn with the program of the pass, the queue has to switch back
+            callbacks.on_program_changed = [this]()
+            {
+                this->m_render_queue.reset_bindings();
+            };
+
+            this->m_query_pass->render(this->m_visible_objs, this->m_query_boxes, view_projection, callbacks);
+            return;
+        }
+
+        for (uint32_t idx : this->m_visible_objs)
+        {
+            this->draw_placement(idx);
+        }
+
+        this->m_render_queue.submit();
+    }
+
+    void DefaultWorld::draw_placement(uint32_t idx)
+    {
+        model_placement_t& obj = this->m_objs[idx];
+        const glm::mat4& model_matrix = this->m_model_matrices[idx];
+
+        // placements of the same file share the model, every placement keeps its own selection
+        obj.model->select_lod(compute_pixels_per_unit(obj.model->get_bounds(), model_matrix), this->m_lod_settings, obj.draws);
+
+        glm::vec3 world_camera_position = CoreComponents::camera->get_camera_position();
+
+        if (this->m_meshlet_culling)
+        {
+            glm::mat4 model_view_projection
+                = DrawComponents::shader->projection_matrix * CoreComponents::camera->get_view_matrix() * model_matrix;
+
+            glm::vec3 camera_position = glm::vec3(glm::inverse(model_matrix) * glm::vec4(world_camera_position, 1.0f));
+
+            obj.model->cull_meshlets(model_view_projection, camera_position, obj.draws);
+        }
+
+        uint32_t transform = this->m_render_queue.add_transform(model_matrix);
+        const std::vector<Mesh>& meshes = obj.model->get_meshes();
+
+        for (size_t mesh = 0; mesh < meshes.size(); mesh++)
+        {
+            bounding_sphere_t sphere = transform_sphere(meshes[mesh].get_bounding_sphere(), model_matrix);
+
+            this->m_render_queue.add_mesh(*DrawComponents::shader,
+                                          meshes[mesh],
+                                          obj.draws[mesh],
+                                          transform,
+                                          glm::length(sphere.center - world_camera_position));
+        }
+
+        this->m_triangle_count += Model3D::get_triangle_count(obj.draws);
+    }
+
+    void DefaultWorld::cull_occluded(const glm::mat4& view_projection)
+    {
+        if (!this->m_occlusion_culling || this->m_occluders.empty() || this->m_visible_objs.empty())
+        {
+            return;
+        }
+
+        this->m_occlusion_buffer.clear();
+
+        for (const auto& occluder : this->m_occluders)
+        {
+            this->m_occlusion_buffer.add_occluder(occluder.vertices, occluder.indices, view_projection * occluder.transform);
+        }
+
+        this->m_occlusion_buffer.rasterize(CoreComponents::thread_pool.get());
+
+        auto hidden = std::remove_if(this->m_visible_objs.begin(),
+                                     this->m_visible_objs.end(),
+                                     [this, &view_projection](uint32_t idx)
+                                     {
+                                         const model_placement_t& obj = this->m_objs[idx];
+
+                                         aabb_t box = transform_aabb(obj.model->get_bounds(), this->m_model_matrices[idx]);
+
+                                         return !this->m_occlusion_buffer.is_box_visible(box, view_projection);
+                                     });
+
+        this->m_occluded_count += static_cast<size_t>(this->m_visible_objs.end() - hidden);
+
+        this->m_visible_objs.erase(hidden, this->m_visible_objs.end());
+    }
+
+    void DefaultWorld::render_models_indirect()
+    {
+        this->m_models.resize(this->m_objs.size());
+
+        for (size_t idx = 0; idx < this->m_objs.size(); idx++)
+        {
+            this->m_models[idx] = this->m_objs[idx].model;
+        }
+
+        this->m_indirect_pass->render(this->m_models, this->m_model_matrices, this->m_lod_settings);
+
+        this->m_triangle_count = this->m_indirect_pass->get_triangle_count();
+    }
+
+    void DefaultWorld::render_instanced_models()
+    {
+        if (this->m_instanced_models.empty())
+        {
+            return;
+        }
+
+        if (!this->m_instanced_shader)
+        {
+            this->m_instanced_shader = std::make_shared<InstancedShader>();
+            this->m_instanced_shader->init_uniforms();
+        }
+
+        this->m_instanced_shader->use_shader_program();
+
+        // the view projection matrix and the camera position come from the per-frame block
+        glm::mat4 view_matrix = CoreComponents::camera->get_view_matrix();
+        glm::mat4 projection_matrix = DrawComponents::shader->projection_matrix;
+        glm::vec3 camera_position = CoreComponents::camera->get_camera_position();
+
+        float pixels_per_unit_at_one = projection_matrix[1][1] * static_cast<float>(CoreComponents::window->height) * 0.5f;
+
+        for (const auto& model : this->m_instanced_models)
+        {
+            model->render(*this->m_instanced_shader,
+                          projection_matrix * view_matrix,
+                          camera_position,
+                          pixels_per_unit_at_one,
+                          this->m_lod_settings);
+
+            this->m_triangle_count += model->get_triangle_count();
+            this->m_culled_count += model->get_culled_count();
+        }
+    }
+
+    bool DefaultWorld::create_indirect_pass()
+    {
+        if (this->m_indirect_pass)
+        {
+            return true;
+        }
+
+        if (!IndirectDrawPass::is_supported())
+        {
+            this->m_gpu_driven = false;
+            return false;
+        }
+
+        this->m_indirect_pass = std::make_shared<IndirectDrawPass>();
+
+        if (!this->m_indirect_pass->is_valid())
+        {
+            std::cerr << "WARNING: GPU-driven rendering is not available, drawing from the CPU\n";
+
+            this->m_indirect_pass.reset();
+            this->m_gpu_driven = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool DefaultWorld::create_query_pass()
+    {
+        if (this->m_query_pass)
+        {
+            return true;
+        }
+
+        if (!OcclusionQueryPass::is_supported())
+        {
+            this->m_occlusion_queries = false;
+            return false;
+        }
+
+        this->m_query_pass = std::make_shared<OcclusionQueryPass>();
+
+        if (!this->m_query_pass->is_valid())
+        {
+            std::cerr << "WARNING: occlusion queries are not available, drawing every model in the frustum\n";
+
+            this->m_query_pass.reset();
+            this->m_occlusion_queries = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    void DefaultWorld::add_placement(model_handle_t model,
+                                     const std::string& model_name,
+                                     const glm::vec3& position,
+                                     bool rotatable,
+                                     bool scalable)
+    {
+        glm::mat4 model_matrix = this->compute_model_matrix(position, rotatable, scalable);
+
+        auto object = static_cast<uint32_t>(this->m_objs.size());
+        int32_t proxy = this->m_tree.insert(transform_aabb(model->get_bounds(), model_matrix), object);
+
+        this->m_objs.push_back({std::move(model), model_name, position, rotatable, scalable, proxy, {}});
+        this->m_model_matrices.push_back(model_matrix);
+    }
+
+    void DefaultWorld::refit_placements()
+    {
+        for (size_t idx = 0; idx < this->m_objs.size(); idx++)
+        {
+            const model_placement_t& obj = this->m_objs[idx];
+
+            if (!obj.rotatable && !obj.scalable)
+            {
+                continue;
+            }
+
+            this->m_model_matrices[idx] = this->compute_model_matrix(obj.position, obj.rotatable, obj.scalable);
+
+            this->m_tree.move(obj.proxy, transform_aabb(obj.model->get_bounds(), this->m_model_matrices[idx]));
+        }
+    }
+
+    void DefaultWorld::update_pending_models()
+    {
+        for (size_t idx = 0; idx < this->m_pending_models.size();)
+        {
+            std::shared_ptr<ModelLoadRequest>& request = this->m_pending_models[idx];
+
+            request->report_progress();
+
+            LOAD_STATE state = request->get_state();
+
+            if (state == LOAD_STATE::READY)
+            {
+                model_handle_t model = CoreComponents::asset_manager->acquire(request->get_file_path());
+
+                if (model)
+                {
+                    this->add_placement(model,
+                                        request->model_name,
+                                        request->obj_position,
+                                        request->is_rotatable,
+                                        request->is_scalable);
+                }
+
+                request->complete(model != nullptr);
+            }
+            else if (state == LOAD_STATE::FAILED)
+            {
+                request->complete(false);
+            }
+            else
+            {
+                idx++;
+                continue;
+            }
+
+            this->m_pending_models.erase(this->m_pending_models.begin() + static_cast<std::ptrdiff_t>(idx));
+        }
+    }
+
+    void DefaultWorld::render_placeholders()
+    {
+        // an empty material unbinds the textures the last mesh left bound
+        const Material untextured(std::vector<texture_t>{});
+
+        for (const auto& request : this->m_pending_models)
+        {
+            aabb_t bounds{};
+
+            if (!request->get_bounds(bounds))
+            {
+                continue;
+            }
+
+            if (!this->m_placeholder_box)
+            {
+                this->m_placeholder_box = std::make_shared<BoxMesh>();
+            }
+
+            DrawComponents::shader->use_shader_program();
+
+            untextured.bind(DrawComponents::shader->uniforms);
+
+            DrawComponents::shader->model_matrix
+                = this->compute_model_matrix(request->obj_position, request->is_rotatable, request->is_scalable);
+
+            // the box matrix only goes into the model matrix, a flat box would make the normal matrix singular
+            upload_matrices(DrawComponents::shader->model_matrix * BoxMesh::get_box_matrix(bounds));
+
+            this->m_placeholder_box->draw_wireframe();
+        }
+    }
+
+    glm::mat4 DefaultWorld::compute_model_matrix(const glm::vec3& position, bool rotatable, bool scalable) const
+    {
+        glm::mat4 model_matrix = glm::translate(glm::mat4(1.0f), position);
+
+        if (rotatable)
+        {
+            model_matrix = glm::rotate(model_matrix,
+                                       glm::radians(this->m_rotate_angle),
+                                       glm::vec3(0, 1, 0));
+        }
+
+        if (scalable)
+        {
+            model_matrix = glm::scale(model_matrix,
+                                      this->m_scale_factor + glm::vec3(1.0f, 1.0f, 1.0f));
+        }
+
+        return model_matrix;
+    }
+
+    float DefaultWorld::compute_pixels_per_unit(const aabb_t& bounds, const glm::mat4& model_matrix)
+    {
+        glm::vec3 center = glm::vec3(model_matrix * glm::vec4((bounds.min + bounds.max) * 0.5f, 1.0f));
+
+        float scale = std::max(glm::length(glm::vec3(model_matrix[0])),
+                               std::max(glm::length(glm::vec3(model_matrix[1])),
+                                        glm::length(glm::vec3(model_matrix[2]))));
+
+        float radius = glm::length(bounds.max - bounds.min) * 0.5f * scale;
+        float distance = glm::length(center - CoreComponents::camera->get_camera_position()) - radius;
+
+        // inside the bounds the full level is always picked
+        distance = std::max(distance, 0.001f);
+
+        // projection[1][1] is cot(fov / 2), which maps a unit at distance 1 to half the viewport height
+        float pixels_per_unit_at_one = DrawComponents::shader->projection_matrix[1][1] *
+                                       static_cast<float>(CoreComponents::window->height) * 0.5f;
+
+        return pixels_per_unit_at_one * scale / distance;
+    }
+
+    void DefaultWorld::upload_matrices(const glm::mat4& draw_matrix)
+    {
+        DrawComponents::shader->view_matrix = CoreComponents::camera->get_view_matrix();
+
+        glm::mat4 inverse_transpose
+            = glm::inverseTranspose(DrawComponents::shader->view_matrix * DrawComponents::shader->model_matrix);
+
+        DrawComponents::shader->normal_matrix = glm::mat3(inverse_transpose);
+
+        if (DrawComponents::shader->uses_object_block && DrawComponents::uniform_buffers)
+        {
+            std::vector<object_block_t> objects{{draw_matrix, glm::mat4(DrawComponents::shader->normal_matrix)}};
+            std::vector<GLintptr> offsets{};
+
+            DrawComponents::uniform_buffers->write_objects(objects, offsets);
+
+            if (!offsets.empty())
+            {
+                DrawComponents::uniform_buffers->bind_object(offsets[0]);
+            }
+
+            return;
+        }
+
+        // Send matrices to the shader.
+        DrawComponents::shader->uniforms.set(MODEL_UNIFORM, draw_matrix);
+        DrawComponents::shader->uniforms.set(NORMAL_MATRIX_UNIFORM, DrawComponents::shader->normal_matrix);
+
+        if (!DrawComponents::shader->uses_frame_block)
+        {
+            DrawComponents::shader->uniforms.set(VIEW_UNIFORM, DrawComponents::shader->view_matrix);
+        }
+    }
+
+    void DefaultWorld::update_frame_block()
+    {
+        if (!DrawComponents::uniform_buffers)
+        {
+            return;
+        }
+
+        frame_block_t block{};
+
+        block.view = CoreComponents::camera->get_view_matrix();
+        block.projection = DrawComponents::shader->projection_matrix;
+        block.view_projection = block.projection * block.view;
+        block.camera_position = glm::vec4(CoreComponents::camera->get_camera_position(), 1.0f);
+
+        DrawComponents::shader->write_lights(block);
+
+        DrawComponents::uniform_buffers->update_frame(block);
+    }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Protected Functions
 ////////////////////////////////////////////////////////////////////////////////
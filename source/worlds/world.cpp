@@ -34,6 +34,33 @@ namespace YB
 
     }
 
+    std::shared_ptr<ModelLoadRequest> World::add_model_async(const std::string& file_name,
+                                                             const std::string& model_name,
+                                                             const glm::vec3& position,
+                                                             bool rotatable,
+                                                             bool scalable,
+                                                             const model_load_callbacks_t& callbacks)
+    {
+        return nullptr;
+    }
+
+    size_t World::add_instanced_model(const std::string& file_name, const std::string& model_name)
+    {
+        return 0;
+    }
+
+    size_t World::add_model_instance(size_t model, const glm::mat4& transform)
+    {
+        return 0;
+    }
+
+    void World::add_occluder(const std::vector<glm::vec3>& vertices,
+                             const std::vector<uint32_t>& indices,
+                             const glm::mat4& transform)
+    {
+
+    }
+
     void World::render_models()
     {
 
@@ -0,0 +1,129 @@
+///
+/// @file texture_cook.cpp
+/// @author Yasin BASAR
+/// @brief Offline tool that converts texture images into block compressed `.ybtex` files.
+/// @version 1.0.0
+/// @date 17/10/2026
+/// @copyright (c) 2026 All rights reserved.
+///
+
+////////////////////////////////////////////////////////////////////////////////
+// Project Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "block_compressor.hpp"
+#include "compressed_texture.hpp"
+#include "hash_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Third Party Includes
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stb_image.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Helper Functions
+////////////////////////////////////////////////////////////////////////////////
+
+///
+/// @brief Cooks one source image next to itself.
+/// @return True if the cooked texture was written.
+///
+static bool cook_texture(const std::string& source_path)
+{
+    std::ifstream file(source_path, std::ios::binary);
+    std::vector<unsigned char> file_bytes((std::istreambuf_iterator<char>(file)),
+                                          std::istreambuf_iterator<char>());
+
+    int width, height, channels;
+    unsigned char* data = stbi_load_from_memory(file_bytes.data(),
+                                                static_cast<int>(file_bytes.size()),
+                                                &width,
+                                                &height,
+                                                &channels,
+                                                4);
+
+    if (!data)
+    {
+        std::fprintf(stderr, "ERROR: could not load %s\n", source_path.c_str());
+        return false;
+    }
+
+    YB::rgba_image_t base_level{width, height, std::vector<unsigned char>(data, data + static_cast<size_t>(width) * height * 4)};
+    stbi_image_free(data);
+
+    // store the rows bottom-up, the way the engine uploads them
+    const size_t row_size = static_cast<size_t>(width) * 4;
+
+    for (int row = 0; row < height / 2; row++)
+    {
+        std::swap_ranges(base_level.pixels.begin() + static_cast<std::ptrdiff_t>(row * row_size),
+                         base_level.pixels.begin() + static_cast<std::ptrdiff_t>((row + 1) * row_size),
+                         base_level.pixels.begin() + static_cast<std::ptrdiff_t>((height - row - 1) * row_size));
+    }
+
+    YB::compressed_image_t cooked_image{};
+    cooked_image.internal_format = YB::BlockCompressor::choose_format(base_level);
+    cooked_image.source_hash = YB::fnv1a_hash(file_bytes.data(), file_bytes.size());
+
+    std::vector<YB::rgba_image_t> mip_chain = YB::BlockCompressor::build_mip_chain(base_level);
+    std::vector<std::vector<unsigned char>> level_blocks{};
+    size_t uncompressed_size = 0;
+
+    level_blocks.reserve(mip_chain.size());
+
+    for (const auto& level: mip_chain)
+    {
+        level_blocks.push_back(YB::BlockCompressor::compress(level, cooked_image.internal_format));
+        cooked_image.levels.push_back({level.width, level.height, level_blocks.back().data(), level_blocks.back().size()});
+        uncompressed_size += level.pixels.size();
+    }
+
+    if (!YB::CompressedTexture::save(source_path, cooked_image))
+    {
+        return false;
+    }
+
+    size_t cooked_size = YB::CompressedTexture::get_byte_size(cooked_image);
+
+    std::printf("%s: %dx%d %s, %zu levels, %.2f MB -> %.2f MB\n",
+                source_path.c_str(),
+                width,
+                height,
+                cooked_image.internal_format == YB::COMPRESSED_SRGB_ALPHA_BC3 ? "BC3" : "BC1",
+                cooked_image.levels.size(),
+                static_cast<double>(uncompressed_size) / (1024.0 * 1024.0),
+                static_cast<double>(cooked_size) / (1024.0 * 1024.0));
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <image>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int failures = 0;
+
+    for (int idx = 1; idx < argc; idx++)
+    {
+        if (!cook_texture(argv[idx]))
+        {
+            failures++;
+        }
+    }
+
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* End of File */